@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "anssipki-crypto.h"
+
+/* Audit d'un ensemble de clés RSA : recherche des modules partageant un
+   facteur premier (voir findSharedFactors). Les clés sont lues dans les
+   fichiers donnés en arguments, ou dont les noms sont lus sur l'entrée
+   standard (un par ligne) en l'absence d'arguments. Un fichier contient
+   soit une clé encodée en DER, soit un ou plusieurs blocs PEM (tels que
+   ceux produits par anssipki-genrsa). */
+
+#define BEGIN "-----BEGIN "
+#define END   "-----END "
+#define MAX_REPORTED_PAIRS 4096
+
+static unsigned int	nKeys = 0;
+static unsigned int	maxKeys = 0;
+static mpz_t*		moduli = NULL;
+static char**		labels = NULL;
+
+static inline int	B64Value(char c)
+{
+  if (c >= 'A' && c <= 'Z')
+    return (c - 'A');
+  if (c >= 'a' && c <= 'z')
+    return (c - 'a' + 26);
+  if (c >= '0' && c <= '9')
+    return (c - '0' + 52);
+  if (c == '+')
+    return (62);
+  if (c == '/')
+    return (63);
+  return (-1);
+}
+
+/* Décodage base64 de src[0 .. len-1] dans dst (au moins 3 len / 4
+   octets), les blancs étant ignorés. Retourne la taille décodée, ou -1
+   si un caractère est invalide */
+static long	PEMDecode(unsigned char* dst, const char* src, size_t len)
+{
+  unsigned int acc = 0, nbits = 0;
+  long j = 0;
+
+  for (size_t i = 0; i < len && src[i] != '='; i++)
+    {
+      int v = B64Value(src[i]);
+      if (v < 0)
+	{
+	  if (src[i] == '\n' || src[i] == '\r' || src[i] == ' ' || src[i] == '\t')
+	    continue;
+	  return (-1);
+	}
+      acc = (acc << 6) | (unsigned int) v;
+      nbits += 6;
+      if (nbits >= 8)
+	{
+	  nbits -= 8;
+	  dst[j++] = (unsigned char) (acc >> nbits);
+	  acc &= (1U << nbits) - 1;
+	}
+    }
+  return (j);
+}
+
+static char*	readFile(const char* name, size_t* size)
+{
+  FILE* f = fopen(name, "rb");
+  char* buf = NULL;
+  size_t cap = 0, n;
+
+  *size = 0;
+  if (f == NULL)
+    return (NULL);
+  do
+    {
+      if (*size == cap)
+	{
+	  char* tmp;
+	  cap = (cap == 0) ? 4096 : 2 * cap;
+	  if ((tmp = (char*)realloc(buf, cap + 1)) == NULL)
+	    {
+	      free(buf);
+	      fclose(f);
+	      return (NULL);
+	    }
+	  buf = tmp;
+	}
+      n = fread(buf + *size, 1, cap - *size, f);
+      *size += n;
+    }
+  while (n > 0);
+  fclose(f);
+  buf[*size] = '\0';
+  return (buf);
+}
+
+static void	addKey(const char* der, size_t size, const char* label)
+{
+  if (nKeys == maxKeys)
+    {
+      maxKeys = (maxKeys == 0) ? 1024 : 2 * maxKeys;
+      moduli = (mpz_t*)realloc(moduli, maxKeys * sizeof(mpz_t));
+      labels = (char**)realloc(labels, maxKeys * sizeof(char*));
+      if (moduli == NULL || labels == NULL)
+	{
+	  perror("realloc");
+	  exit(EXIT_FAILURE);
+	}
+    }
+  mpz_init(moduli[nKeys]);
+  if (!getRSAModulus(moduli[nKeys], String(der, size)) || mpz_sgn(moduli[nKeys]) <= 0)
+    {
+      fprintf(stderr, "%s : clé RSA non reconnue, ignorée\n", label);
+      mpz_clear(moduli[nKeys]);
+      return;
+    }
+  labels[nKeys] = strdup(label);
+  nKeys++;
+}
+
+/* Lecture des clés d'un fichier. Les blocs PEM sont désignés par
+   "fichier:k" (k-ième bloc du fichier) */
+static bool	loadFile(const char* name)
+{
+  size_t size;
+  char* buf = readFile(name, &size);
+
+  if (buf == NULL)
+    {
+      perror(name);
+      return (false);
+    }
+
+  char* begin = strstr(buf, BEGIN);
+  if (begin == NULL)
+    addKey(buf, size, name);
+  for (unsigned int k = 1; begin != NULL; k++)
+    {
+      char* body = strchr(begin, '\n');
+      char* end = (body == NULL) ? NULL : strstr(body, END);
+      if (end == NULL)
+	{
+	  fprintf(stderr, "%s : bloc PEM %u incomplet\n", name, k);
+	  break;
+	}
+
+      char* label = (char*)malloc(strlen(name) + 16);
+      unsigned char* der = (unsigned char*)malloc((size_t) (end - body));
+      long derLen;
+      if (label == NULL || der == NULL)
+	{
+	  perror("malloc");
+	  exit(EXIT_FAILURE);
+	}
+      sprintf(label, "%s:%u", name, k);
+      if ((derLen = PEMDecode(der, body, (size_t) (end - body))) < 0)
+	fprintf(stderr, "%s : encodage base64 invalide, ignoré\n", label);
+      else
+	addKey((const char*) der, (size_t) derLen, label);
+      free(der);
+      free(label);
+      begin = strstr(end + strlen(END), BEGIN);
+    }
+  free(buf);
+  return (true);
+}
+
+int	main(int argc, char** argv)
+{
+  unsigned int nThreads = 0;
+  bool ok = true;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:")) != -1)
+    {
+      if (opt == 't')
+	nThreads = (unsigned int) atoi(optarg);
+      else
+	{
+	  fprintf(stderr, " Usage : %s [-t nThreads] [fichier ...]\n"
+		  "   (noms de fichiers lus sur l'entrée standard en l'absence d'arguments)\n"
+		  "   Code de retour : 0 sans facteur commun, 2 si des paires sont trouvées\n",
+		  argv[0]);
+	  return (EXIT_FAILURE);
+	}
+    }
+
+  if (optind < argc)
+    for (int i = optind; i < argc; i++)
+      ok = loadFile(argv[i]) && ok;
+  else
+    {
+      char* line = NULL;
+      size_t cap = 0;
+      ssize_t len;
+      while ((len = getline(&line, &cap, stdin)) > 0)
+	{
+	  if (line[len - 1] == '\n')
+	    line[--len] = '\0';
+	  if (len > 0)
+	    ok = loadFile(line) && ok;
+	}
+      free(line);
+    }
+  if (!ok)
+    return (EXIT_FAILURE);
+
+  rsa_shared_pair_t pairs[MAX_REPORTED_PAIRS];
+  unsigned int nPairs;
+  mpz_t d;
+
+  try
+    {
+      nPairs = findSharedFactors(moduli, nKeys, pairs, MAX_REPORTED_PAIRS, nThreads);
+    }
+  catch (std::exception& e)
+    {
+      fprintf(stderr, "Erreur : %s\n", e.what());
+      return (EXIT_FAILURE);
+    }
+
+  mpz_init(d);
+  for (unsigned int k = 0; k < nPairs && k < MAX_REPORTED_PAIRS; k++)
+    {
+      mpz_gcd(d, moduli[pairs[k].i], moduli[pairs[k].j]);
+      printf("%s %s : facteur commun de %u bits\n", labels[pairs[k].i], labels[pairs[k].j],
+	     (unsigned int) mpz_sizeinbase(d, 2));
+    }
+  if (nPairs > MAX_REPORTED_PAIRS)
+    printf("... %u paires au total\n", nPairs);
+  fprintf(stderr, "%u modules, %u paires avec un facteur commun\n", nKeys, nPairs);
+  mpz_clear(d);
+
+  for (unsigned int i = 0; i < nKeys; i++)
+    {
+      mpz_clear(moduli[i]);
+      free(labels[i]);
+    }
+  free(moduli);
+  free(labels);
+  return ((nPairs > 0) ? 2 : EXIT_SUCCESS);
+}
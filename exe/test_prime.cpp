@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
 
 
 #define TEST_LEN 512
@@ -43,6 +44,166 @@ const char *list_primes[] = {
 NULL };
 
 
+void test_TrialDivision () {
+  BarakHaleviPRNG s;
+  mpz_t n;
+  bool expected, res;
+
+  // Les trois méthodes coïncident lorsque tous les premiers sont testés
+  mpz_init (n);
+  for (int i=0; i<200; i++) {
+    s.getRandomInt (n, 512, false);
+    mpz_setbit (n, 0);
+    expected = isPrime_TrialDivision (n, TRIAL_DIVISION_MAX_PRIMES, TRIAL_DIVISION_MOD_1);
+    if (isPrime_TrialDivision (n, TRIAL_DIVISION_MAX_PRIMES, TRIAL_DIVISION_GCD) != expected
+	|| isPrime_TrialDivision (n, TRIAL_DIVISION_MAX_PRIMES, TRIAL_DIVISION_TREE) != expected) {
+      fprintf (stderr, "Trial division methods disagree on:\n%s\n", mpz_get_str (NULL, 16, n));
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  // 1048573 est le plus grand premier inférieur à 2^20 et 8167 le
+  // 1024e premier impair
+  mpz_set_str (n, list_primes[0], 16);
+  mpz_mul_ui (n, n, 1048573);
+  res = isPrime_TrialDivision (n, 1024, TRIAL_DIVISION_MOD_1)
+    && !isPrime_TrialDivision (n, TRIAL_DIVISION_MAX_PRIMES, TRIAL_DIVISION_MOD_1)
+    && !isPrime_TrialDivision (n, TRIAL_DIVISION_MAX_PRIMES, TRIAL_DIVISION_GCD)
+    && !isPrime_TrialDivision (n, TRIAL_DIVISION_MAX_PRIMES, TRIAL_DIVISION_TREE);
+  mpz_set_str (n, list_primes[0], 16);
+  mpz_mul_ui (n, n, 8167);
+  res = res && isPrime_TrialDivision (n, 1023, TRIAL_DIVISION_MOD_1)
+    && !isPrime_TrialDivision (n, 1024, TRIAL_DIVISION_MOD_1)
+    && !isPrime_TrialDivision (n, 1024, TRIAL_DIVISION_TREE)
+    && !isPrime_Sieve (n, 8168);
+  if (!res) {
+    fprintf (stderr, "Wrong trial division bound\n");
+    exit (EXIT_FAILURE);
+  }
+
+  mpz_clear (n);
+}
+
+
+void test_SieveBatch () {
+  BarakHaleviPRNG s;
+  const unsigned int count = 64;
+  const unsigned int nPrimes = sizeof (list_primes) / sizeof (list_primes[0]) - 1;
+  const sieve_batch_t impls[] = {SIEVE_BATCH_AUTO, SIEVE_BATCH_SCALAR, SIEVE_BATCH_AVX2};
+  mpz_t n[count];
+  bool expected[count], res[count];
+
+  // Tailles variées : impairs aléatoires, pairs, multiples de 65521 (le
+  // plus grand premier du crible) et premiers
+  for (unsigned int i = 0; i < count; i++) {
+    mpz_init (n[i]);
+    s.getRandomInt (n[i], 64 + 61 * i, false);
+    switch (i % 4) {
+    case 0:
+      mpz_setbit (n[i], 0);
+      break;
+    case 1:
+      mpz_clrbit (n[i], 0);
+      break;
+    case 2:
+      mpz_setbit (n[i], 0);
+      mpz_mul_ui (n[i], n[i], 65521);
+      break;
+    default:
+      mpz_set_str (n[i], list_primes[i % nPrimes], 16);
+    }
+    expected[i] = isPrime_TrialDivision (n[i], SIEVE_BATCH_PRIMES);
+  }
+
+  // Lots complet et incomplet (dernier registre partiellement rempli)
+  for (unsigned int k = 0; k < sizeof (impls) / sizeof (impls[0]); k++) {
+    if (!isSieveBatchSupported (impls[k]))
+      continue;
+    for (unsigned int c = count - 3; c <= count; c += 3) {
+      isPrime_SieveBatch (n, c, res, impls[k]);
+      for (unsigned int i = 0; i < c; i++)
+	if (res[i] != expected[i]) {
+	  fprintf (stderr, "Batch sieve (%u) disagrees on:\n%s\n", k, mpz_get_str (NULL, 16, n[i]));
+	  exit (EXIT_FAILURE);
+	}
+    }
+
+    // Groupes de deux entiers n[i] et n[i + count/2]
+    isPrime_SieveBatch (n, count / 2, res, impls[k], 2);
+    for (unsigned int i = 0; i < count / 2; i++)
+      if (res[i] != (expected[i] && expected[i + count / 2])) {
+	fprintf (stderr, "Batch sieve (%u) disagrees on group %u\n", k, i);
+	exit (EXIT_FAILURE);
+      }
+  }
+  printf ("Batch sieve OK (AVX2 %s)\n",
+	  isSieveBatchSupported (SIEVE_BATCH_AVX2) ? "available" : "not available");
+
+  for (unsigned int i = 0; i < count; i++)
+    mpz_clear (n[i]);
+}
+
+
+void test_SmoothBatch () {
+  BarakHaleviPRNG s;
+  const unsigned int count = 48;
+  mpz_t n[count], a[count], sp[count], p;
+  bool res[count];
+
+  // n = a c, où a est un produit de petits premiers de taille voisine de
+  // la limite de isSmooth (128 bits), et c un cofacteur aléatoire
+  mpz_init (p);
+  for (unsigned int i = 0; i < count; i++) {
+    mpz_init (n[i]);
+    mpz_init (sp[i]);
+    mpz_init_set_ui (a[i], 1);
+    while (mpz_sizeinbase (a[i], 2) < 112 + i % 32) {
+      s.getRandomInt (p, (i % 2) ? 16 : 20, false);
+      mpz_nextprime (p, p);
+      if (mpz_sizeinbase (p, 2) <= 20)
+	mpz_mul (a[i], a[i], p);
+    }
+    if (i % 8 == 0)
+      mpz_mul (a[i], a[i], a[i]);
+    s.getRandomInt (n[i], 16 + 37 * i, false);
+    mpz_setbit (n[i], 0);
+    mpz_mul (n[i], n[i], a[i]);
+  }
+  mpz_set_ui (n[0], 1);
+  mpz_set_ui (a[0], 1);
+
+  isSmoothBatch (n, count, res);
+  for (unsigned int i = 0; i < count; i++)
+    if (res[i] != isSmooth (n[i])) {
+      fprintf (stderr, "Batch smoothness disagrees on:\n%s\n", mpz_get_str (NULL, 16, n[i]));
+      exit (EXIT_FAILURE);
+    }
+
+  // Premiers inférieurs à 2^20 : a divise la partie friable, et le
+  // cofacteur impair n'a plus de petit facteur
+  smoothParts (sp, n, count, TRIAL_DIVISION_MAX_PRIMES);
+  for (unsigned int i = 0; i < count; i++) {
+    if (!mpz_divisible_p (n[i], sp[i]) || !mpz_divisible_p (sp[i], a[i])) {
+      fprintf (stderr, "Invalid smooth part of:\n%s\n", mpz_get_str (NULL, 16, n[i]));
+      exit (EXIT_FAILURE);
+    }
+    mpz_divexact (p, n[i], sp[i]);
+    if (!isPrime_TrialDivision (p, TRIAL_DIVISION_MAX_PRIMES)) {
+      fprintf (stderr, "Incomplete smooth part of:\n%s\n", mpz_get_str (NULL, 16, n[i]));
+      exit (EXIT_FAILURE);
+    }
+  }
+  printf ("Batch smoothness OK\n");
+
+  for (unsigned int i = 0; i < count; i++) {
+    mpz_clear (n[i]);
+    mpz_clear (a[i]);
+    mpz_clear (sp[i]);
+  }
+  mpz_clear (p);
+}
+
+
 void test_Prime () {
   BarakHaleviPRNG s;
 
@@ -76,19 +237,408 @@ void test_Smoothness () {
 }
 
 
-void test_RSAFactor (size_t len) {
+void test_PrimeFT (size_t len) {
+  BarakHaleviPRNG s;
+
+  // Le second appel réutilise les paramètres calculés pour cette taille
+  for (int i=0; i<2; i++) {
+    genPrimeFT (entier, len, s, true);
+    printf ("FT prime found:\n%s\n", mpz_get_str (NULL, 16, entier));
+    if (mpz_sizeinbase (entier, 2) != len || !isPrime (entier)) {
+      fprintf (stderr, "Invalid FT prime\n");
+      exit (EXIT_FAILURE);
+    }
+    mpz_shred (entier);
+  }
+}
+
+
+// Certificat construit à la main : premier p0, puis étapes (R, a)
+static String primeCertificate (unsigned long p0, const unsigned long* steps, int nSteps) {
+  mpz_t x;
+  String res;
+
+  mpz_init_set_ui (x, p0);
+  res = ANSSIPKI_ASN1::ASN1_INTEGER (x).toDER ();
+  for (int i = 0; i < nSteps; i++) {
+    mpz_set_ui (x, steps[2*i]);
+    String step (ANSSIPKI_ASN1::ASN1_INTEGER (x).toDER ());
+    mpz_set_ui (x, steps[2*i + 1]);
+    step += ANSSIPKI_ASN1::ASN1_INTEGER (x).toDER ();
+    res += encapsulate (step, T_SEQU);
+  }
+  mpz_clear (x);
+
+  return encapsulate (res, T_SEQU);
+}
+
+
+void test_ProvablePrime () {
+  BarakHaleviPRNG s;
+  const size_t sizes[] = {2, 17, 32, 33, 60, 100, 256, 512, TEST_LEN};
+  String certificate;
+  mpz_t p;
+
+  mpz_init (p);
+  for (unsigned int i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++) {
+    genProvablePrime (entier, sizes[i], s, true, &certificate);
+    if (mpz_sizeinbase (entier, 2) != sizes[i] || !mpz_probab_prime_p (entier, 40)
+	|| !checkPrimeCertificate (p, certificate) || mpz_cmp (p, entier) != 0) {
+      fprintf (stderr, "Invalid provable prime of %u bits:\n%s\n", (unsigned int) sizes[i],
+	       mpz_get_str (NULL, 16, entier));
+      exit (EXIT_FAILURE);
+    }
+    mpz_shred (entier);
+  }
+
+  // Certificat tronqué ou suivi de données
+  if (checkPrimeCertificate (p, String (certificate.toChar (), certificate.size () - 1))
+      || checkPrimeCertificate (p, certificate + String ("\x02\x01\x01", 3))) {
+    fprintf (stderr, "Malformed prime certificate accepted\n");
+    exit (EXIT_FAILURE);
+  }
+
+  // 3 -> 7 -> 43 ; 15 = 2 * 1 * 7 + 1 est composé, 6^2 = 1 mod 7 ne
+  // prouve rien, et 61 = 2 * 10 * 3 + 1 est trop grand par rapport à 3
+  const unsigned long valid[] = {1, 2, 3, 2};
+  const unsigned long composite[] = {1, 2, 1, 2};
+  const unsigned long noWitness[] = {1, 6};
+  const unsigned long tooLarge[] = {10, 2};
+  if (!checkPrimeCertificate (p, primeCertificate (3, valid, 2)) || mpz_cmp_ui (p, 43) != 0
+      || !checkPrimeCertificate (p, primeCertificate (4294967291UL, NULL, 0))
+      || checkPrimeCertificate (p, primeCertificate (4294967311UL, NULL, 0))
+      || checkPrimeCertificate (p, primeCertificate (4, valid, 1))
+      || checkPrimeCertificate (p, primeCertificate (3, composite, 2))
+      || checkPrimeCertificate (p, primeCertificate (3, noWitness, 1))
+      || checkPrimeCertificate (p, primeCertificate (3, tooLarge, 1))) {
+    fprintf (stderr, "Wrong prime certificate verification\n");
+    exit (EXIT_FAILURE);
+  }
+  mpz_shred (p);
+  printf ("Provable primes OK\n");
+}
+
+
+void test_RSAFactor (size_t len,
+		     rsa_factor_search_t mode = RSA_FACTOR_SEARCH_RANDOM) {
   BarakHaleviPRNG s;
 
-  findRSAFactor (entier, len, s, true);
+  findRSAFactor (entier, len, s, true, mode);
   printf ("RSA factor found:\n%s\n", mpz_get_str (NULL, 16, entier));
   mpz_shred (entier);
 
-  findRSAFactor (entier, len, s, true);
+  findRSAFactor (entier, len, s, true, mode);
   printf ("RSA factor found:\n%s\n", mpz_get_str (NULL, 16, entier));  
   mpz_shred (entier);
 }
 
 
+void test_RSAFactorPair (size_t len, unsigned int nThreads) {
+  BarakHaleviPRNG s;
+  mpz_t p, q, m, diff, diffMin;
+
+  mpz_init (p);
+  mpz_init (q);
+  mpz_init (m);
+  mpz_init (diff);
+  mpz_init (diffMin);
+  mpz_ui_pow_ui (diffMin, 2, len - 20);
+
+  findRSAFactorPair (p, q, len, s, diffMin, nThreads);
+  printf ("RSA factors found (%u threads):\n%s\n%s\n", nThreads,
+	  mpz_get_str (NULL, 16, p), mpz_get_str (NULL, 16, q));
+
+  mpz_sub (diff, p, q);
+  mpz_abs (diff, diff);
+  if (mpz_sizeinbase (p, 2) != len || mpz_sizeinbase (q, 2) != len
+      || mpz_cmp (diff, diffMin) <= 0) {
+    fprintf (stderr, "Invalid RSA factor pair\n");
+    exit (EXIT_FAILURE);
+  }
+
+  mpz_t* factors[2] = { &p, &q };
+  for (int i=0; i<2; i++) {
+    mpz_sub_ui (m, *factors[i], 1);
+    mpz_fdiv_q_2exp (m, m, 1);
+    if (!isPrime (*factors[i]) || !isPrime (m)) {
+      fprintf (stderr, "RSA factor is not a safe prime\n");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  mpz_shred (p);
+  mpz_shred (q);
+  mpz_shred (m);
+  mpz_shred (diff);
+  mpz_shred (diffMin);
+}
+
+
+// Carmichael numbers and strong pseudoprimes to small bases
+const char *list_composites[] = {
+"561", "41041", "825265", "321197185", "2047", "3215031751",
+"3825123056546413051", "318665857834031151167461",
+"3317044064679887385961981",
+NULL };
+
+
+void test_RSAFactorPipeline (size_t len, unsigned int nThreads) {
+  BarakHaleviPRNG s;
+  PrimeContext ctx (s);
+  mpz_t p, q, m, diffMin;
+  // Ordre historique, sans les tests en base 2
+  const rsa_factor_stage_t order[] = {
+    RSA_FACTOR_STAGE_MR_M, RSA_FACTOR_STAGE_MR_N,
+    RSA_FACTOR_STAGE_LUCAS_M, RSA_FACTOR_STAGE_LUCAS_N,
+    RSA_FACTOR_STAGE_SMOOTHNESS
+  };
+  const rsa_factor_stage_t duplicate[] = {
+    RSA_FACTOR_STAGE_MR_M, RSA_FACTOR_STAGE_MR_N,
+    RSA_FACTOR_STAGE_LUCAS_M, RSA_FACTOR_STAGE_LUCAS_M,
+    RSA_FACTOR_STAGE_SMOOTHNESS
+  };
+
+  if (ctx.setRSAFactorPipeline (order, 4)
+      || ctx.setRSAFactorPipeline (duplicate, 5)
+      || ctx.nRSAFactorStages () != RSA_FACTOR_NB_STAGES) {
+    fprintf (stderr, "Invalid RSA factor pipeline accepted\n");
+    exit (EXIT_FAILURE);
+  }
+  if (!ctx.setRSAFactorPipeline (order, 5)) {
+    fprintf (stderr, "Valid RSA factor pipeline rejected\n");
+    exit (EXIT_FAILURE);
+  }
+
+  mpz_init (p);
+  mpz_init (q);
+  mpz_init (m);
+  mpz_init (diffMin);
+  mpz_ui_pow_ui (diffMin, 2, len - 20);
+
+  findRSAFactorPair (p, q, len, s, diffMin, nThreads,
+		     RSA_FACTOR_SEARCH_INCREMENTAL, &ctx);
+
+  const rsa_factor_stats_t& stats = ctx.rsaFactorStats ();
+  unsigned long total = stats.accepted;
+  for (int i=0; i<RSA_FACTOR_NB_STAGES; i++)
+    total += stats.rejected[i];
+  printf ("RSA factor pipeline (%u threads): %lu candidates, %lu accepted\n",
+	  nThreads, stats.candidates, stats.accepted);
+  if (stats.accepted < 2 || total != stats.candidates
+      || stats.rejected[RSA_FACTOR_STAGE_MR2_M] != 0
+      || stats.rejected[RSA_FACTOR_STAGE_MR2_N] != 0) {
+    fprintf (stderr, "Inconsistent RSA factor pipeline counters\n");
+    exit (EXIT_FAILURE);
+  }
+
+  mpz_t* factors[2] = { &p, &q };
+  for (int i=0; i<2; i++) {
+    mpz_sub_ui (m, *factors[i], 1);
+    mpz_fdiv_q_2exp (m, m, 1);
+    if (!isPrime (*factors[i]) || !isPrime (m)) {
+      fprintf (stderr, "RSA factor is not a safe prime\n");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  ctx.resetRSAFactorStats ();
+  if (ctx.rsaFactorStats ().candidates != 0) {
+    fprintf (stderr, "RSA factor pipeline counters not reset\n");
+    exit (EXIT_FAILURE);
+  }
+
+  mpz_shred (p);
+  mpz_shred (q);
+  mpz_shred (m);
+  mpz_shred (diffMin);
+}
+
+
+void test_MillerRabin () {
+  BarakHaleviPRNG s;
+  PrimeContext ctx (s);
+  mpz_t n;
+
+  mpz_init (n);
+  for (const char **p = list_primes; *p != NULL; p++) {
+    mpz_set_str (n, *p, 16);
+    if (!isPrime_MillerRabin (n, 0, ctx)) {
+      fprintf (stderr, "Prime must be a Miller-Rabin pseudoprime:\n%s\n", *p);
+      exit (EXIT_FAILURE);
+    }
+  }
+  for (const char **p = list_composites; *p != NULL; p++) {
+    mpz_set_str (n, *p, 10);
+    if (isPrime_MillerRabin (n, 20, ctx)) {
+      fprintf (stderr, "Composite passed Miller-Rabin:\n%s\n", *p);
+      exit (EXIT_FAILURE);
+    }
+  }
+  mpz_clear (n);
+  printf ("Miller-Rabin tests OK\n");
+}
+
+
+// Strong Lucas pseudoprimes (Selfridge parameters) below 2^17, and Lucas
+// pseudoprimes which are not strong ones
+static const unsigned long strongLucasPseudoprimes[] = {
+  5459, 5777, 10877, 16109, 18971, 22499, 24569, 25199, 40309, 58519,
+  75077, 97439, 100127, 113573, 115639, 130139, 0 };
+static const unsigned long lucasPseudoprimes[] = {
+  323, 377, 1159, 1829, 3827, 5459, 5777, 9071, 9179, 10877, 0 };
+
+void test_StrongLucas () {
+  mpz_t n;
+
+  mpz_init (n);
+  for (unsigned long x = 1; x < (1UL << 17); x++) {
+    mpz_set_ui (n, x);
+    bool prime = (mpz_probab_prime_p (n, 25) != 0);
+    if (isPrime_Lucas (n) == prime)
+      continue;
+    const unsigned long* p = strongLucasPseudoprimes;
+    while (*p != 0 && *p != x)
+      p++;
+    if (prime || *p == 0) {
+      fprintf (stderr, "Strong Lucas test wrong for %lu\n", x);
+      exit (EXIT_FAILURE);
+    }
+  }
+  for (const unsigned long* p = lucasPseudoprimes; *p != 0; p++) {
+    bool strong = false;
+    for (const unsigned long* q = strongLucasPseudoprimes; *q != 0; q++)
+      strong = strong || (*p == *q);
+    mpz_set_ui (n, *p);
+    if (!strong && isPrime_Lucas (n)) {
+      fprintf (stderr, "Lucas pseudoprime passed the strong Lucas test: %lu\n", *p);
+      exit (EXIT_FAILURE);
+    }
+  }
+  // BPSW : no strong pseudoprime to base 2 is a strong Lucas pseudoprime
+  for (const char **p = list_composites; *p != NULL; p++) {
+    mpz_set_str (n, *p, 10);
+    if (isPrime_Lucas (n)) {
+      fprintf (stderr, "Composite passed the strong Lucas test:\n%s\n", *p);
+      exit (EXIT_FAILURE);
+    }
+  }
+  mpz_clear (n);
+  printf ("Strong Lucas tests OK\n");
+}
+
+
+void test_AssuranceProfiles () {
+  BarakHaleviPRNG s;
+  PrimeContext ctx (s);
+  prime_assurance_t a;
+  mpz_t n;
+
+  for (int i = 0; i < PRIME_ASSURANCE_NB_PROFILES; i++)
+    if (!primeAssuranceFromName (primeAssuranceName ((prime_assurance_t) i), &a) || a != i) {
+      fprintf (stderr, "Wrong assurance profile name for %d\n", i);
+      exit (EXIT_FAILURE);
+    }
+  if (primeAssuranceFromName ("FIPS-186-4", &a)) {
+    fprintf (stderr, "Unknown assurance profile name accepted\n");
+    exit (EXIT_FAILURE);
+  }
+
+  // FIPS 186-4 C.3 with a Lucas test: 4 rounds for 1024-bit factors, 3
+  // for 1536-bit ones
+  if (primeAssuranceRounds (PRIME_ASSURANCE_FIPS186_5, 1024) != 4
+      || primeAssuranceRounds (PRIME_ASSURANCE_FIPS186_5, 1536) != 3) {
+    fprintf (stderr, "Wrong number of Miller-Rabin rounds for FIPS 186-5\n");
+    exit (EXIT_FAILURE);
+  }
+  for (size_t bits = 64; bits <= 8192; bits += 64)
+    if (primeAssuranceRounds (PRIME_ASSURANCE_FIPS186_5, bits) > primeAssuranceRounds (PRIME_ASSURANCE_CURRENT, bits)
+	|| primeAssuranceRounds (PRIME_ASSURANCE_CURRENT, bits) > primeAssuranceRounds (PRIME_ASSURANCE_PARANOID, bits)
+	|| primeAssuranceRounds (PRIME_ASSURANCE_FIPS186_5, bits) < 2) {
+      fprintf (stderr, "Inconsistent assurance profiles for %u bits\n", (unsigned int) bits);
+      exit (EXIT_FAILURE);
+    }
+
+  mpz_init (n);
+  for (int i = 0; i < PRIME_ASSURANCE_NB_PROFILES; i++) {
+    ctx.setAssurance ((prime_assurance_t) i);
+    for (const char **p = list_primes; *p != NULL; p++) {
+      mpz_set_str (n, *p, 16);
+      if (!isPrime (n, ctx) || !isPrime (n, (prime_assurance_t) i)) {
+	fprintf (stderr, "Prime rejected with profile %s:\n%s\n", primeAssuranceName ((prime_assurance_t) i), *p);
+	exit (EXIT_FAILURE);
+      }
+    }
+    for (const char **p = list_composites; *p != NULL; p++) {
+      mpz_set_str (n, *p, 10);
+      if (isPrime (n, ctx) || isPrime (n, ctx, (prime_assurance_t) i)) {
+	fprintf (stderr, "Composite accepted with profile %s:\n%s\n", primeAssuranceName ((prime_assurance_t) i), *p);
+	exit (EXIT_FAILURE);
+      }
+    }
+  }
+
+  ctx.setAssurance (PRIME_ASSURANCE_FIPS186_5);
+  findRSAFactor (n, TEST_LEN, s, ctx);
+  if (!isPrime (n, PRIME_ASSURANCE_PARANOID)) {
+    fprintf (stderr, "Non-prime RSA factor with profile FIPS-186-5-with-Lucas\n");
+    exit (EXIT_FAILURE);
+  }
+  mpz_clear (n);
+  printf ("Assurance profiles OK\n");
+}
+
+
+// Each thread checks the reference primes and their (composite)
+// products, alternately with its own context and the default one
+#define NB_THREADS 4
+
+static void* primalityWorker (void* arg) {
+  int* failed = (int*) arg;
+  BarakHaleviPRNG s;
+  PrimeContext ctx (s);
+  mpz_t n, c;
+
+  mpz_init (n);
+  mpz_init (c);
+  for (int round = 0; round < 10; round++) {
+    for (const char **p = list_primes; *p != NULL; p++) {
+      mpz_set_str (n, *p, 16);
+      bool prime = (round & 1) ? isPrime (n, ctx) : isPrime (n);
+      mpz_mul (c, n, n);
+      bool composite = !isPrime_MillerRabin (c, 0, ctx);
+      if (!prime || !composite)
+	*failed = 1;
+    }
+  }
+  mpz_clear (n);
+  mpz_clear (c);
+
+  return NULL;
+}
+
+
+void test_ConcurrentPrimality () {
+  pthread_t threads[NB_THREADS];
+  int failed[NB_THREADS];
+
+  for (int i = 0; i < NB_THREADS; i++) {
+    failed[i] = 0;
+    if (pthread_create (&threads[i], NULL, primalityWorker, &failed[i]) != 0) {
+      fprintf (stderr, "Unable to create thread\n");
+      exit (EXIT_FAILURE);
+    }
+  }
+  for (int i = 0; i < NB_THREADS; i++) {
+    pthread_join (threads[i], NULL);
+    if (failed[i]) {
+      fprintf (stderr, "Concurrent primality test failed\n");
+      exit (EXIT_FAILURE);
+    }
+  }
+  printf ("Concurrent primality tests OK\n");
+}
+
+
 int main (int argc __attribute__((unused)), char* argv[] __attribute__((unused))) {
 
   // Checking that isPrime_Lucas returns 0 when it should
@@ -110,11 +660,26 @@ int main (int argc __attribute__((unused)), char* argv[] __attribute__((unused))
     
     initPrimes (s);
     
+    test_MillerRabin ();
+    test_StrongLucas ();
+    test_AssuranceProfiles ();
+    test_TrialDivision ();
+    test_SieveBatch ();
+    test_SmoothBatch ();
     test_Prime ();
+    test_ConcurrentPrimality ();
     test_Smoothness ();
+    test_PrimeFT (256);
+    test_PrimeFT (TEST_LEN);
+    test_ProvablePrime ();
     test_RSAFactor (128);
     test_RSAFactor (256);
+    test_RSAFactor (256, RSA_FACTOR_SEARCH_INCREMENTAL);
     test_RSAFactor (TEST_LEN);
+    test_RSAFactorPair (256, 1);
+    test_RSAFactorPair (256, 4);
+    test_RSAFactorPipeline (256, 1);
+    test_RSAFactorPipeline (256, 4);
  
     return 0;
   } catch (std::exception& e) {
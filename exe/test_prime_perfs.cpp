@@ -108,6 +108,213 @@ void test_RSAFactorFT (int n, size_t len) {
 }
 
 
+/* Durée moyenne (en secondes) de isPrime_TrialDivision (ou d'un tour de
+   Miller-Rabin si method < 0) sur les entiers de batch, mesurée sur au
+   moins reps passes */
+double time_TrialDivision (mpz_t* batch, int batchSize, int reps,
+			   unsigned int nPrimes, int method) {
+  clock_t t = clock ();
+  int passes = 0;
+
+  do {
+    for (int i=0; i<batchSize; i++) {
+      if (method < 0)
+	isPrime_MillerRabin (batch[i], 1);
+      else
+	isPrime_TrialDivision (batch[i], nPrimes, (trial_division_t) method);
+    }
+    passes++;
+  } while (passes < reps || clock () - t < CLOCKS_PER_SEC / 20);
+
+  return (double) (clock () - t) / CLOCKS_PER_SEC / (passes * batchSize);
+}
+
+
+/* Calibration de la table trial_division_tuning.h : pour chaque taille,
+   la borne et la méthode minimisant le coût moyen par candidat impair
+   de la division suivie d'un tour de Miller-Rabin sur les survivants */
+void test_TuneTrialDivision (int reps) {
+  static const size_t sizes[] = {256, 512, 768, 1024, 1536, 2048, 3072, 4096};
+  static const unsigned int bounds[] = {
+    64, 128, 256, 512, 1024, 2048, 4096, 6541,
+    12250, 22999, 43389, TRIAL_DIVISION_MAX_PRIMES
+  };
+  static const char* methods[] = {
+    "TRIAL_DIVISION_MOD_1", "TRIAL_DIVISION_GCD", "TRIAL_DIVISION_TREE"
+  };
+  const int nSizes = sizeof (sizes) / sizeof (sizes[0]);
+  const int nBounds = sizeof (bounds) / sizeof (bounds[0]);
+  const int batchSize = 64;
+  const int survivalSamples = 20000;
+  double survival[nBounds];
+  mpz_t batch[batchSize];
+
+  // Proportion d'entiers impairs survivant à la division, qui ne dépend
+  // pas de leur taille
+  for (int b=0; b<nBounds; b++) {
+    int n = 0;
+    for (int i=0; i<survivalSamples; i++) {
+      s.getRandomInt (entier, 256, false);
+      mpz_setbit (entier, 0);
+      if (isPrime_TrialDivision (entier, bounds[b]))
+	n++;
+    }
+    survival[b] = (double) n / survivalSamples;
+  }
+
+  for (int i=0; i<batchSize; i++)
+    mpz_init (batch[i]);
+
+  printf ("static const unsigned int trial_division_table_len = %d;\n\n", nSizes);
+  printf ("static const trialDivisionTuning trial_division_table[trial_division_table_len] = {\n");
+
+  for (int k=0; k<nSizes; k++) {
+    for (int i=0; i<batchSize; i++) {
+      s.getRandomInt (batch[i], sizes[k], false);
+      mpz_setbit (batch[i], sizes[k] - 1);
+      mpz_setbit (batch[i], 0);
+    }
+
+    double mr = time_TrialDivision (batch, batchSize, 1, 0, -1);
+    double best = 0;
+    int bestBound = 0, bestMethod = 0;
+
+    for (int b=0; b<nBounds; b++)
+      for (int m=0; m<3; m++) {
+	// Construction préalable des tables et arbres
+	isPrime_TrialDivision (batch[0], bounds[b], (trial_division_t) m);
+	double cost = time_TrialDivision (batch, batchSize, reps, bounds[b], m)
+	  + survival[b] * mr;
+	fprintf (stderr, "%u bits, %u primes, %s: %.2f us\n",
+		 (unsigned int) sizes[k], bounds[b], methods[m], cost * 1e6);
+	if ((b == 0 && m == 0) || cost < best) {
+	  best = cost;
+	  bestBound = b;
+	  bestMethod = m;
+	}
+      }
+
+    // Entrée valable à mi-chemin de la taille précédente
+    size_t from = (k == 0) ? 0 : (sizes[k-1] + sizes[k]) / 2;
+    printf ("{%u, %u, %s}%s\n", (unsigned int) from, bounds[bestBound],
+	    methods[bestMethod], (k == nSizes - 1) ? "};" : ",");
+  }
+
+  for (int i=0; i<batchSize; i++)
+    mpz_clear (batch[i]);
+}
+
+
+/* Débit du crible par lots, par mise en oeuvre disponible, sur des
+   entiers impairs aléatoires de len bits */
+void test_SieveBatch (int n, size_t len) {
+  static const sieve_batch_t impls[] = {SIEVE_BATCH_SCALAR, SIEVE_BATCH_AVX2};
+  static const char* names[] = {"scalar", "AVX2"};
+  const unsigned int batchSize = 1024;
+  mpz_t batch[batchSize];
+  bool res[batchSize];
+
+  for (unsigned int i=0; i<batchSize; i++) {
+    mpz_init (batch[i]);
+    s.getRandomInt (batch[i], len, false);
+    mpz_setbit (batch[i], len - 1);
+    mpz_setbit (batch[i], 0);
+  }
+
+  for (unsigned int k=0; k<sizeof (impls) / sizeof (impls[0]); k++) {
+    if (!isSieveBatchSupported (impls[k]))
+      continue;
+    clock_t t = clock ();
+    for (int j=0; j<n; j++)
+      isPrime_SieveBatch (batch, batchSize, res, impls[k]);
+    printf ("Batch sieve (%s): %.2f us per candidate\n", names[k],
+	    (double) (clock () - t) / CLOCKS_PER_SEC / (n * batchSize) * 1e6);
+  }
+
+  for (unsigned int i=0; i<batchSize; i++)
+    mpz_clear (batch[i]);
+}
+
+
+/* Friabilité d'un lot d'entiers aléatoires de len bits : isSmooth
+   entier par entier, puis isSmoothBatch avec la borne de isSmooth et
+   avec les premiers inférieurs à 2^20 */
+void test_SmoothBatch (int n, size_t len) {
+  const unsigned int batchSize = 256;
+  mpz_t batch[batchSize];
+  bool res[batchSize];
+  clock_t t;
+
+  for (unsigned int i=0; i<batchSize; i++) {
+    mpz_init (batch[i]);
+    s.getRandomInt (batch[i], len, false);
+    mpz_setbit (batch[i], len - 1);
+  }
+
+  t = clock ();
+  for (int j=0; j<n; j++)
+    for (unsigned int i=0; i<batchSize; i++)
+      res[i] = isSmooth (batch[i]);
+  printf ("isSmooth: %.2f us per integer\n",
+	  (double) (clock () - t) / CLOCKS_PER_SEC / (n * batchSize) * 1e6);
+
+  t = clock ();
+  for (int j=0; j<n; j++)
+    isSmoothBatch (batch, batchSize, res);
+  printf ("isSmoothBatch: %.2f us per integer\n",
+	  (double) (clock () - t) / CLOCKS_PER_SEC / (n * batchSize) * 1e6);
+
+  t = clock ();
+  for (int j=0; j<n; j++)
+    isSmoothBatch (batch, batchSize, res, TRIAL_DIVISION_MAX_PRIMES);
+  printf ("isSmoothBatch (2^20): %.2f us per integer\n",
+	  (double) (clock () - t) / CLOCKS_PER_SEC / (n * batchSize) * 1e6);
+
+  for (unsigned int i=0; i<batchSize; i++)
+    mpz_clear (batch[i]);
+}
+
+
+/* Premiers prouvés de len bits : génération (à comparer avec
+   genPrimeFT et la recherche d'un premier probable), puis vérification
+   du certificat (à comparer avec isPrime) */
+void test_ProvablePrime (int n, size_t len) {
+  String certificate;
+  size_t certSize = 0;
+  mpz_t p;
+  clock_t t, tGen, tCheck = 0, tIsPrime = 0;
+
+  printf ("Generating %d provable primes of %zu bits...\n", n, len);
+  mpz_init (p);
+  tGen = clock ();
+  for (int i=0; i<n; i++) {
+    genProvablePrime (entier, len, s, false, &certificate);
+    certSize += certificate.size ();
+    fprintf (stderr, ".");
+  }
+  tGen = clock () - tGen;
+  printf ("\n");
+
+  for (int i=0; i<n; i++) {
+    t = clock ();
+    for (int j=0; j<10; j++)
+      if (!checkPrimeCertificate (p, certificate))
+	printf ("Invalid certificate\n");
+    tCheck += clock () - t;
+    t = clock ();
+    for (int j=0; j<10; j++)
+      isPrime (entier);
+    tIsPrime += clock () - t;
+  }
+  printf ("Generation: %.2f ms per prime, certificate: %u bytes\n",
+	  (double) tGen / CLOCKS_PER_SEC / n * 1e3, (unsigned int) (certSize / n));
+  printf ("checkPrimeCertificate: %.2f ms, isPrime: %.2f ms\n",
+	  (double) tCheck / CLOCKS_PER_SEC / (10 * n) * 1e3,
+	  (double) tIsPrime / CLOCKS_PER_SEC / (10 * n) * 1e3);
+  mpz_clear (p);
+}
+
+
 int main (int argc, char* argv[]) {
   try {
     //init Barak-Halevi PRNG with time
@@ -183,6 +390,18 @@ int main (int argc, char* argv[]) {
       printf("Time elapsed: %f\n", (double) (clock() - t)/CLOCKS_PER_SEC);
     }
 
+    if (tests & 128)
+      test_TuneTrialDivision (n);
+
+    if (tests & 256)
+      test_SieveBatch (n, len);
+
+    if (tests & 512)
+      test_SmoothBatch (n, len);
+
+    if (tests & 1024)
+      test_ProvablePrime (n, len);
+
     return 0;
   } catch (std::exception& e) {
     printf ("Exception caught: %s\n", e.what());
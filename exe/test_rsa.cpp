@@ -7,13 +7,344 @@
 #include <string.h>
 
 #define TEST_LEN 1024
+#define BATCH_LEN 64
+
+using namespace ANSSIPKI_ASN1;
+
+
+/* Bloc de données à signer minimal, pour tester la signature par lot
+   (TBS n'ayant pas de destructeur virtuel, les blocs sont alloués sur
+   la pile) */
+class TestTBS : public TBS {
+ public:
+  void init (int i) { _content = encapsulate (String ((uint) i, 8), T_OSTR); }
+
+  virtual const String toString () const { return _content; }
+  virtual const String toDER () const { return _content; }
+  virtual sign_algo get_sign_algo () const { return S_ALGO_SHA256RSA; }
+
+ private:
+  String _content;
+};
+
+
+void testBatch (const RSAKey& k) {
+  TestTBS blocks[BATCH_LEN];
+  const TBS* tbs[BATCH_LEN];
+  RSABatchSignResult results[BATCH_LEN];
+
+  printf ("Tests signature par lot\n");
+
+  for (int i=0; i<BATCH_LEN; i++) {
+    blocks[i].init (i);
+    tbs[i] = &blocks[i];
+  }
+  // Un bloc invalide ne doit pas empêcher la signature des autres
+  tbs[BATCH_LEN / 2] = NULL;
+
+  k.signBatch (tbs, results, BATCH_LEN, 4);
+
+  for (int i=0; i<BATCH_LEN; i++) {
+    if (tbs[i] == NULL) {
+      if (results[i].ok || results[i].errNo != E_UNEXPECTED_ERROR) {
+	printf ("  NOK\n");
+	exit (EXIT_FAILURE);
+      }
+      continue;
+    }
+
+    if (!results[i].ok || results[i].signedDER != k.sign (*tbs[i])) {
+      printf ("  NOK\n");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  printf ("  OK\n");
+}
+
+void testSignDigest (RSAKey& k) {
+  const char data[] = "abc";
+  char digest[32];
+  unsigned char em[TEST_LEN / 4], sig[TEST_LEN / 4];
+  size_t emLen = (mpz_sizeinbase (k.n(), 2) + 7) / 8;
+  size_t sigLen = 0;
+  mpz_t m, x, y;
+
+  printf ("Tests signature de condensat\n");
+
+  // Signature de référence calculée sans CRT ni espace de travail
+  sha256 (data, strlen (data), digest);
+  k.pkcs1_v1_5_encode (em, emLen, (const unsigned char*) digest, 32, ANSSIPKI_HASH::sha256);
+  mpz_init (m);
+  mpz_init (x);
+  mpz_init (y);
+  mpz_import (m, emLen, 1, 1, 0, 0, em);
+  mpz_powm (x, m, k.d(), k.n());
+
+  // Tampon trop petit : la taille requise est retournée
+  if (k.signDigest (ANSSIPKI_HASH::sha256, (const unsigned char*) digest, sig, &sigLen) != -3 ||
+      sigLen != emLen) {
+    printf ("  NOK (taille)\n");
+    exit (EXIT_FAILURE);
+  }
+
+  if (k.signDigest (ANSSIPKI_HASH::invalid, (const unsigned char*) digest, sig, &sigLen) != -2) {
+    printf ("  NOK (fonction de hachage)\n");
+    exit (EXIT_FAILURE);
+  }
+
+  for (int i=0; i<2; i++) {
+    sigLen = sizeof (sig);
+    if (k.signDigest (ANSSIPKI_HASH::sha256, (const unsigned char*) digest, sig, &sigLen) != 0 ||
+	sigLen != emLen) {
+      printf ("  NOK\n");
+      exit (EXIT_FAILURE);
+    }
+    mpz_import (y, sigLen, 1, 1, 0, 0, sig);
+    if (mpz_cmp (x, y) != 0) {
+      printf ("  NOK\n");
+      exit (EXIT_FAILURE);
+    }
+  }
+  printf ("  OK\n");
+
+  mpz_clear (m);
+  mpz_clear (x);
+  mpz_clear (y);
+}
+
+
+/* Lecture du module sous les quatre encodages, puis recherche de
+   facteurs communs dans un ensemble de modules construit autour de la
+   clé : n1 et n5 partagent p ou q avec n et un facteur entre eux, n4
+   est un doublon de n2 */
+void testSharedFactors (const RSAKey& k, gmp_randstate_t GMP_state) {
+  const unsigned int count = 7;
+  const rsa_shared_pair_t expected[] = {{0, 1}, {0, 5}, {1, 5}, {2, 4}};
+  const unsigned int nExpected = sizeof (expected) / sizeof (expected[0]);
+  rsa_shared_pair_t pairs[count * count];
+  mpz_t n[count], p, q, r[7];
+
+  printf ("Tests facteurs communs\n");
+
+  const String encodings[] = {k.ASN1PublicKey (), k.ASN1PubKeyInfo (),
+			      k.ASN1PrivateKey (), k.ASN1PrivateKeyInfo ()};
+  for (unsigned int i = 0; i < count; i++)
+    mpz_init (n[i]);
+  for (unsigned int i = 0; i < 4; i++)
+    if (!getRSAModulus (n[0], encodings[i]) || mpz_cmp (n[0], k.n()) != 0) {
+      printf ("  NOK (encodage %u)\n", i);
+      exit (EXIT_FAILURE);
+    }
+  if (getRSAModulus (n[0], String ("\x30\x03\x02\x01", 4))) {
+    printf ("  NOK (encodage invalide)\n");
+    exit (EXIT_FAILURE);
+  }
+
+  k.copyP (&p);
+  k.copyQ (&q);
+  for (unsigned int i = 0; i < 7; i++) {
+    mpz_init (r[i]);
+    mpz_urandomb (r[i], GMP_state, mpz_sizeinbase (p, 2));
+    mpz_nextprime (r[i], r[i]);
+  }
+  mpz_set (n[0], k.n());
+  mpz_mul (n[1], p, r[1]);
+  mpz_mul (n[2], r[2], r[3]);
+  mpz_mul (n[3], r[4], r[5]);
+  mpz_set (n[4], n[2]);
+  mpz_mul (n[5], q, r[1]);
+  mpz_mul (n[6], r[6], r[0]);
+
+  for (unsigned int nThreads = 1; nThreads <= 4; nThreads += 3) {
+    unsigned int nPairs = findSharedFactors (n, count, pairs, count * count, nThreads);
+    if (nPairs != nExpected) {
+      printf ("  NOK (%u paires)\n", nPairs);
+      exit (EXIT_FAILURE);
+    }
+    for (unsigned int i = 0; i < nExpected; i++)
+      if (pairs[i].i != expected[i].i || pairs[i].j != expected[i].j) {
+	printf ("  NOK (paire %u)\n", i);
+	exit (EXIT_FAILURE);
+      }
+  }
+  printf ("  OK\n");
+
+  for (unsigned int i = 0; i < count; i++)
+    mpz_clear (n[i]);
+  for (unsigned int i = 0; i < 7; i++)
+    mpz_clear (r[i]);
+  mpz_shred (p);
+  mpz_shred (q);
+}
+
+
+/* Génération de clés avec chaque stratégie de génération des facteurs
+   (avec un puis deux fils d'exécution) : taille des facteurs et du
+   module, et primalité de (p-1)/2 pour les stratégies de premiers sûrs */
+void testPrimeStrategies (size_t nBits) {
+  BarakHaleviPRNG s;
+  rsa_prime_strategy_t strategy;
+  mpz_t p, h;
+
+  printf ("Tests strategies de generation\n");
+  mpz_init (h);
+  for (int i = 0; i < RSA_PRIME_NB_STRATEGIES; i++) {
+    if (!rsaPrimeStrategyFromName (rsaPrimeStrategyName ((rsa_prime_strategy_t) i), &strategy)
+	|| strategy != i) {
+      printf ("  NOK (nom de la stratégie %d)\n", i);
+      exit (EXIT_FAILURE);
+    }
+    for (unsigned int nThreads = 1; nThreads <= 2; nThreads++) {
+      RSAKey k (s, nBits, true, nThreads, strategy);
+      for (int j = 0; j < 2; j++) {
+	if (j == 0)
+	  k.copyP (&p);
+	else
+	  k.copyQ (&p);
+	mpz_fdiv_q_2exp (h, p, 1);
+	if (mpz_sizeinbase (p, 2) != nBits / 2 || !mpz_tstbit (p, nBits / 2 - 2)
+	    || !isPrime (p)
+	    || (rsaPrimeStrategyIsSafe (strategy) && !isPrime (h))) {
+	  printf ("  NOK (%s)\n", rsaPrimeStrategyName (strategy));
+	  exit (EXIT_FAILURE);
+	}
+	mpz_shred (p);
+      }
+      if (mpz_sizeinbase (k.n(), 2) != nBits) {
+	printf ("  NOK (%s, taille du module)\n", rsaPrimeStrategyName (strategy));
+	exit (EXIT_FAILURE);
+      }
+    }
+    printf ("  OK (%s)\n", rsaPrimeStrategyName (strategy));
+  }
+  mpz_clear (h);
+}
+
+
+/* Clé de TEST_LEN bits de facteurs p = small et q premier aléatoire.
+   Les entiers sont initialisés ici ; le constructeur RSAKey qui les
+   reçoit ensuite les efface (mpz_shred), qu'il réussisse ou non. */
+static void smallFactorKey (PRNG& s, unsigned long small,
+			    mpz_t n, mpz_t d, mpz_t e, mpz_t p, mpz_t q) {
+  mpz_t phi, t;
+
+  mpz_init (phi);
+  mpz_init (t);
+  mpz_init_set_ui (p, small);
+  mpz_init_set_ui (e, 65537);
+  mpz_init (q);
+  mpz_init (n);
+  mpz_init (d);
+  do {
+    s.getRandomInt (q, TEST_LEN - 20, false);
+    mpz_nextprime (q, q);
+    mpz_sub_ui (phi, p, 1);
+    mpz_sub_ui (t, q, 1);
+    mpz_mul (phi, phi, t);
+  } while (mpz_invert (d, e, phi) == 0);
+  mpz_mul (n, p, q);
+  mpz_clear (phi);
+  mpz_clear (t);
+}
+
+/* Auto-test de friabilité du module : un facteur 2^19 - 1 (premier)
+   doit être détecté, pas le premier suivant 2^19 */
+void testSmoothModulus () {
+  BarakHaleviPRNG s;
+  const unsigned long small[] = {524287, 524309};
+  mpz_t n, d, e, p, q;
+
+  printf ("Tests module friable\n");
+  for (int i = 0; i < 2; i++) {
+    smallFactorKey (s, small[i], n, d, e, p, q);
+
+    bool rejected = false;
+    try {
+      RSAKey k (s, n, d, e, p, q);
+    } catch (std::exception& ex) {
+      rejected = true;
+    }
+    if (rejected != (i == 0)) {
+      printf ("  NOK (facteur %lu)\n", small[i]);
+      exit (EXIT_FAILURE);
+    }
+  }
+  printf ("  OK\n");
+}
+
+/* Niveaux d'auto-test : une clé au module friable est rejetée par le
+   niveau rapide, et par le niveau différé à sa première signature
+   seulement ; une clé dont d est faux est rejetée par le niveau
+   rapide. */
+void testSelfTestTiers () {
+  BarakHaleviPRNG s;
+  unsigned char digest[32], sig[TEST_LEN / 8];
+  size_t sigLen;
+  mpz_t n, d, e, p, q;
+  bool ok = true;
+
+  printf ("Tests niveaux d'auto-test\n");
+  memset (digest, 0x5a, sizeof (digest));
+
+  smallFactorKey (s, 524287, n, d, e, p, q);
+  try {
+    RSAKey smoothFast (s, n, d, e, p, q, RSA_SELF_TEST_FAST);
+    ok = false;
+  } catch (std::exception& ex) {
+  }
+
+  smallFactorKey (s, 524309, n, d, e, p, q);
+  RSAKey fast (s, n, d, e, p, q, RSA_SELF_TEST_FAST);
+  sigLen = sizeof (sig);
+  ok = ok && fast.selfTest () == RSA_SELF_TEST_FAST && !fast.selfTestPending () &&
+    fast.signDigest (ANSSIPKI_HASH::sha256, digest, sig, &sigLen) == 0;
+
+  smallFactorKey (s, 524287, n, d, e, p, q);
+  RSAKey smooth (s, n, d, e, p, q, RSA_SELF_TEST_DEFERRED);
+  ok = ok && smooth.selfTest () == RSA_SELF_TEST_DEFERRED && smooth.selfTestPending ();
+  sigLen = sizeof (sig);
+  ok = ok && smooth.signDigest (ANSSIPKI_HASH::sha256, digest, sig, &sigLen) == -6 &&
+    !smooth.selfTestPending ();
+
+  smallFactorKey (s, 524309, n, d, e, p, q);
+  RSAKey deferred (s, n, d, e, p, q, RSA_SELF_TEST_DEFERRED);
+  sigLen = sizeof (sig);
+  ok = ok && deferred.selfTestPending () &&
+    deferred.signDigest (ANSSIPKI_HASH::sha256, digest, sig, &sigLen) == 0 &&
+    !deferred.selfTestPending ();
+
+  // Import DER de la même clé avec chacun des niveaux (la lecture
+  // consomme la chaîne, d'où un encodage par import)
+  for (int t = RSA_SELF_TEST_FULL; t <= RSA_SELF_TEST_DEFERRED; t++) {
+    RSAKey k (s, deferred.ASN1PrivateKey (), (rsa_self_test_t) t);
+    sigLen = sizeof (sig);
+    ok = ok && k.selfTest () == t &&
+      k.signDigest (ANSSIPKI_HASH::sha256, digest, sig, &sigLen) == 0;
+  }
+
+  smallFactorKey (s, 524309, n, d, e, p, q);
+  mpz_add_ui (d, d, 2);
+  try {
+    RSAKey bad (s, n, d, e, p, q, RSA_SELF_TEST_FAST);
+    ok = false;
+  } catch (std::exception& ex) {
+  }
+
+  if (!ok) {
+    printf ("  NOK\n");
+    exit (EXIT_FAILURE);
+  }
+  printf ("  OK\n");
+}
+
 
 void testKey (size_t nBits, bool useF4) {
   printf ("TEST avec nBits=%d et useF4=%s\n", nBits, useF4 ? "true" : "false");
 
   BarakHaleviPRNG s;
 
-  const RSAKey k (s, nBits, useF4);
+  RSAKey k (s, nBits, useF4);
 
   printf ("Cle generee:\n  n=%s\n  e=%s\n  d=%s\n",
 	  mpz_get_str (NULL, 16, k.n()),
@@ -45,10 +376,125 @@ void testKey (size_t nBits, bool useF4) {
       printf ("  OK\n");
   }
 
+  printf ("Tests CRT\n");
+  for (int i=0; i<10; i++) {
+    mpz_t y;
+    mpz_urandomm (m, GMP_state, k.n());
+    mpz_powm (x, m, k.d(), k.n());
+
+    if (k.private_exponentiation (&y, &m) != 0 || mpz_cmp (x, y) != 0) {
+      printf ("  NOK\n");
+      exit (EXIT_FAILURE);
+    }
+    printf ("  OK\n");
+    mpz_clear (y);
+  }
+
+  testSignDigest (k);
+
+  testBatch (k);
+
+  testSharedFactors (k, GMP_state);
+
   printf ("\n");
 }
 
 
+/* Clés multi-premiers : exponentiation privée par le CRT
+   multi-premiers comparée à m ^ d mod n, et import / export DER du
+   champ otherPrimeInfos */
+/* Encodage DER d'une clé dont le champ version est remplacé par v */
+static String withVersion (const String& der, char v) {
+  size_t i = 2;
+  while (i + 2 < der.size () && (der.toChar ()[i] != 0x02 || der.toChar ()[i+1] != 0x01))
+    i++;
+  return der.substring (0, i + 2) + String (&v, 1) + der.substring (i + 3, der.size () - i - 3);
+}
+
+void testMultiPrime () {
+  BarakHaleviPRNG s;
+  const size_t sizes[] = {TEST_LEN, TEST_LEN * 4};
+  const unsigned int primes[] = {3, 4};
+  gmp_randstate_t GMP_state;
+  mpz_t m, x, y, v[5];
+  bool ok = true;
+
+  printf ("Tests clés multi-premiers\n");
+  gmp_randinit_default (GMP_state);
+  mpz_init (m);
+  mpz_init (x);
+  for (int i = 0; ok && i < 2; i++) {
+    RSAKey k (s, sizes[i], true, 1, RSA_PRIME_FT, RSA_SELF_TEST_FULL, primes[i]);
+    ok = (k.nPrimes () == primes[i] && mpz_sizeinbase (k.n (), 2) == sizes[i]);
+
+    for (int j = 0; ok && j < 4; j++) {
+      mpz_urandomm (m, GMP_state, k.n ());
+      mpz_powm (x, m, k.d (), k.n ());
+      ok = (k.private_exponentiation (&y, &m) == 0 && mpz_cmp (x, y) == 0);
+      mpz_clear (y);
+    }
+
+    String der = k.ASN1PrivateKey ();
+    RSAKey k2 (s, k.ASN1PrivateKey (), RSA_SELF_TEST_FAST);
+    RSAKey k3;
+    ok = ok && k2.nPrimes () == primes[i] && k2.ASN1PrivateKey () == der &&
+      k3.setFromASN1PrivateKey (der) && k3.nPrimes () == primes[i];
+
+    // Réutilisation de l'objet après forgetKey
+    k3.forgetKey ();
+    ok = ok && k3.setFromASN1PrivateKey (k.ASN1PrivateKey ()) && k3.nPrimes () == primes[i] &&
+      k3.ASN1PrivateKey () == der;
+
+    // Puis par les accesseurs : seuls p et q sont repris, n n'étant pas
+    // leur produit, l'exponentiation se fait sans CRT
+    k3.forgetKey ();
+    k.copyP (&v[0]);
+    k.copyQ (&v[1]);
+    k.copyD (&v[2]);
+    k.copyE (&v[3]);
+    k.copyN (&v[4]);
+    k3.setP (&v[0]);
+    k3.setQ (&v[1]);
+    k3.setD (&v[2]);
+    k3.setE (&v[3]);
+    k3.setN (&v[4]);
+    for (int j = 0; j < 5; j++)
+      mpz_shred (v[j]);
+    mpz_urandomm (m, GMP_state, k.n ());
+    mpz_powm (x, m, k.d (), k.n ());
+    ok = ok && k3.private_exponentiation (&y, &m) == 0 && mpz_cmp (x, y) == 0;
+    mpz_clear (y);
+    if (ok && i == 0)
+      testSignDigest (k2);
+  }
+
+  // La version doit valoir 1 si et seulement si otherPrimeInfos est
+  // présent
+  RSAKey two (s, TEST_LEN, true, 1, RSA_PRIME_FT);
+  RSAKey three (s, TEST_LEN * 2, true, 1, RSA_PRIME_FT, RSA_SELF_TEST_FULL, 3);
+  RSAKey k4, k5, k6;
+  ok = ok && k4.setFromASN1PrivateKey (withVersion (three.ASN1PrivateKey (), 1)) &&
+    !k5.setFromASN1PrivateKey (withVersion (three.ASN1PrivateKey (), 0)) &&
+    !k6.setFromASN1PrivateKey (withVersion (two.ASN1PrivateKey (), 1));
+
+  // Trop de facteurs pour la taille du module
+  try {
+    RSAKey bad (s, TEST_LEN, true, 1, RSA_PRIME_FT, RSA_SELF_TEST_FULL, 4);
+    ok = false;
+  } catch (std::exception& ex) {
+  }
+
+  gmp_randclear (GMP_state);
+  mpz_clear (m);
+  mpz_clear (x);
+  if (!ok) {
+    printf ("  NOK\n");
+    exit (EXIT_FAILURE);
+  }
+  printf ("  OK\n");
+}
+
+
 int main (int argc __attribute__((unused)), char* argv[] __attribute__((unused))) {
   try {
     BarakHaleviPRNG s;
@@ -64,6 +510,11 @@ int main (int argc __attribute__((unused)), char* argv[] __attribute__((unused))
     testKey (TEST_LEN * 2, true);
     testKey (TEST_LEN * 2, false);
 
+    testPrimeStrategies (TEST_LEN);
+    testSmoothModulus ();
+    testSelfTestTiers ();
+    testMultiPrime ();
+
     return 0;
   } catch (std::exception& e) {
     printf ("Exception caught: %s\n", e.what());
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2018 ANSSI. All Rights Reserved.
+#include <anssipki-crypto.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Comparatif des stratégies de génération des facteurs RSA (voir
+   rsa_prime_strategy_t) : pour chaque taille et chaque stratégie,
+   nKeys clés sont générées, et le débit (clés par seconde) ainsi que
+   les percentiles de la durée de génération d'une clé sont affichés.
+   La durée d'une génération étant très dispersée, il faut plusieurs
+   dizaines de clés pour que les percentiles élevés aient un sens.
+   L'option -k donne le nombre de facteurs premiers du module (voir
+   rsaMaxPrimes). */
+
+#define MAX_SIZES 16
+
+static double now () {
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static int compareDouble (const void* a, const void* b) {
+  double x = *(const double*) a, y = *(const double*) b;
+  return (x > y) - (x < y);
+}
+
+// Percentile (rang le plus proche) d'un tableau trié
+static double percentile (const double* sorted, int n, int pct) {
+  int rank = (pct * n + 99) / 100;
+  return sorted[(rank > 0) ? rank - 1 : 0];
+}
+
+static void benchStrategy (PRNG& prng, size_t nBits, rsa_prime_strategy_t strategy,
+			   int nKeys, unsigned int nThreads, unsigned int nPrimes) {
+  double* latency = new double[nKeys];
+  double start = now (), t;
+
+  for (int i = 0; i < nKeys; i++) {
+    t = now ();
+    RSAKey k (prng, nBits, true, nThreads, strategy, RSA_SELF_TEST_FULL, nPrimes);
+    latency[i] = now () - t;
+    fprintf (stderr, ".");
+  }
+  t = now () - start;
+  fprintf (stderr, "\n");
+
+  qsort (latency, nKeys, sizeof (double), compareDouble);
+  printf ("%5u/%u %-9s %8.3f keys/s   p50 %8.1f ms   p90 %8.1f ms   p99 %8.1f ms   max %8.1f ms\n",
+	  (unsigned int) nBits, nPrimes, rsaPrimeStrategyName (strategy), nKeys / t,
+	  percentile (latency, nKeys, 50) * 1e3, percentile (latency, nKeys, 90) * 1e3,
+	  percentile (latency, nKeys, 99) * 1e3, latency[nKeys - 1] * 1e3);
+  fflush (stdout);
+  delete[] latency;
+}
+
+int main (int argc, char* argv[]) {
+  bool selected[RSA_PRIME_NB_STRATEGIES];
+  bool anySelected = false;
+  size_t sizes[MAX_SIZES] = {2048, 3072, 4096};
+  int nSizes = 3;
+  int nKeys = 10;
+  unsigned int nThreads = 1;
+  unsigned int nPrimes = 2;
+  rsa_prime_strategy_t s;
+  int opt;
+
+  for (int i = 0; i < RSA_PRIME_NB_STRATEGIES; i++)
+    selected[i] = false;
+  while ((opt = getopt (argc, argv, "n:t:k:s:")) != -1) {
+    if (opt == 'n')
+      nKeys = atoi (optarg);
+    else if (opt == 't')
+      nThreads = (unsigned int) atoi (optarg);
+    else if (opt == 'k')
+      nPrimes = (unsigned int) atoi (optarg);
+    else if (opt == 's' && rsaPrimeStrategyFromName (optarg, &s))
+      selected[s] = anySelected = true;
+    else {
+      fprintf (stderr, " Usage : %s [-n nKeys] [-t nThreads] [-k nPrimes] [-s stratégie ...] [taille ...]\n"
+	       "   stratégies : classic, FT-safe, FT, provable (toutes par défaut)\n"
+	       "   tailles : 2048 3072 4096 par défaut\n", argv[0]);
+      return (EXIT_FAILURE);
+    }
+  }
+  if (nKeys < 1) {
+    fprintf (stderr, "nKeys doit être strictement positif\n");
+    return (EXIT_FAILURE);
+  }
+  if (optind < argc) {
+    nSizes = 0;
+    for (int i = optind; i < argc && nSizes < MAX_SIZES; i++)
+      sizes[nSizes++] = (size_t) atoi (argv[i]);
+  }
+
+  try {
+    BarakHaleviPRNG prng;
+    DevUrandomPRNG urandom;
+
+    prng.PRNG::refresh (urandom, BARAK_HALEVI_STATE_BYTE_SIZE);
+    initPrimes (prng);
+
+    printf ("%d keys per strategy, %u thread(s)\n", nKeys, nThreads);
+    for (int j = 0; j < nSizes; j++)
+      for (int i = 0; i < RSA_PRIME_NB_STRATEGIES; i++)
+	if (!anySelected || selected[i])
+	  benchStrategy (prng, sizes[j], (rsa_prime_strategy_t) i, nKeys, nThreads, nPrimes);
+
+    return 0;
+  } catch (std::exception& e) {
+    printf ("Exception caught: %s\n", e.what());
+    return 1;
+  }
+}
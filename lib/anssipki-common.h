@@ -672,6 +672,14 @@ ssize_t reallyRead (int fd, char* data, size_t len);
  */
 void mpz_shred (mpz_t n);
 
+/**
+ * Overwrites the limbs of a GMP integer and sets it to 0, keeping its
+ * allocation so that it can be reused without calling the allocator.
+ *
+ * @param n the integer to erase.
+ */
+void mpz_wipe (mpz_t n);
+
 /**
  * Overwrites a memory area with 0s and 1s to clear its value.
  *
@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include <sys/types.h>
 #include <gmp.h>
+#include <pthread.h>
 
 #include "anssipki-common.h"
 #include "anssipki-asn1.h"
@@ -248,16 +249,240 @@ class StatefulBarakHaleviPRNG : public BarakHaleviPRNG {
 
 
 /* Génération des variables globales (à appeler avant toute
-   utilisation des fonctions sur les nombres premiers !) */
+   utilisation des fonctions sur les nombres premiers !)
+   Les tables de petits premiers ne sont construites qu'une fois, quel
+   que soit le nombre de fils d'exécution appelants ; chaque appel
+   réinitialise la graine à partir de laquelle sont initialisés les
+   contextes de test de primalité par défaut (voir PrimeContext). */
 void initPrimes (PRNG& rng);
 
+/* Profils d'assurance des tests de primalité (isPrime et recherche
+   de facteurs RSA), qui fixent le nombre de tours de Miller-Rabin à
+   bases aléatoires, le test fort de Lucas étant toujours effectué. Les
+   probabilités d'erreur indiquées sont celles des seuls tours de
+   Miller-Rabin, majorées par la formule de Damgård, Landrock et
+   Pomerance (voir nb_iter_MR.h) pour un entier tiré au hasard : le
+   test de Lucas, qui forme avec eux le test BPSW, n'y est pas compté. */
+typedef enum {
+  PRIME_ASSURANCE_CURRENT,     /* "current" : erreur < 2^-128 (défaut) */
+  PRIME_ASSURANCE_FIPS186_5,   /* "FIPS-186-5-with-Lucas" : erreur < 2^-100, soit
+				  le nombre de tours des tables de FIPS 186-4/186-5
+				  lorsqu'un test de Lucas est aussi effectué (4 tours
+				  pour 1024 bits, 3 pour 1536 bits) */
+  PRIME_ASSURANCE_PARANOID,    /* "paranoid" : 64 tours, erreur < 4^-64 = 2^-128
+				  quel que soit l'entier testé (borne de Rabin),
+				  par exemple pour un entier choisi par un tiers */
+  PRIME_ASSURANCE_NB_PROFILES
+} prime_assurance_t;
+
+/* Nombre de tours de Miller-Rabin du profil a pour un entier de
+   nBits bits */
+unsigned int primeAssuranceRounds (prime_assurance_t a, size_t nBits);
+
+/* Nom du profil, et profil correspondant à un nom (retourne false si
+   le nom est inconnu) */
+const char* primeAssuranceName (prime_assurance_t a);
+bool primeAssuranceFromName (const char* name, prime_assurance_t* a);
+
+class MillerRabinWorkspace;
+class RSAFactorPipeline;
+
+/* Étapes des tests appliqués par findRSAFactor à un candidat m ayant
+   passé le crible, n = 2m+1 étant le facteur RSA candidat */
+typedef enum {
+  RSA_FACTOR_STAGE_MR2_M,       /* Test fort de Miller-Rabin en base 2 de m */
+  RSA_FACTOR_STAGE_MR2_N,       /* Test fort de Miller-Rabin en base 2 de n */
+  RSA_FACTOR_STAGE_MR_M,        /* Tours de Miller-Rabin à bases aléatoires sur m */
+  RSA_FACTOR_STAGE_MR_N,        /* Tours de Miller-Rabin à bases aléatoires sur n */
+  RSA_FACTOR_STAGE_LUCAS_M,     /* Test de Lucas de m */
+  RSA_FACTOR_STAGE_LUCAS_N,     /* Test de Lucas de n */
+  RSA_FACTOR_STAGE_SMOOTHNESS,  /* m-1, m+1 et n+1 ne sont pas friables */
+  RSA_FACTOR_NB_STAGES
+} rsa_factor_stage_t;
+
+/* Compteurs des étapes de findRSAFactor */
+typedef struct {
+  unsigned long candidates;                      /* Candidats ayant passé le crible */
+  unsigned long rejected[RSA_FACTOR_NB_STAGES];  /* Candidats rejetés par chaque étape */
+  unsigned long accepted;                        /* Facteurs retournés */
+} rsa_factor_stats_t;
+
+/* Contexte de test de primalité : générateur d'aléa non sensible
+   tirant les témoins de Miller-Rabin et espace de travail réutilisé
+   d'un candidat à l'autre. Un contexte
+   ne doit être utilisé que par un fil d'exécution à la fois ; les
+   tables de petits premiers sont partagées en lecture seule.
+   Les fonctions ci-dessous ne prenant pas de contexte utilisent celui
+   du fil d'exécution appelant, créé au premier usage et initialisé à
+   partir de la graine fournie à initPrimes : elles peuvent donc être
+   appelées simultanément depuis plusieurs fils. */
+class PrimeContext {
+ public:
+  /* Contexte initialisé à partir de rng */
+  PrimeContext (PRNG& rng);
+
+  /* Contexte initialisé à partir de la graine fournie à initPrimes
+     (qui doit avoir été appelée) */
+  PrimeContext ();
+
+  ~PrimeContext ();
+
+  void reseed (PRNG& rng);
+
+  /* Ordre des étapes de findRSAFactor. Les étapes en base 2 sont
+     facultatives (elles ne font qu'écarter plus tôt les candidats
+     composés) ; les autres doivent toutes figurer, une seule fois.
+     Retourne false (sans modifier le contexte) si l'ordre est invalide.
+     Par défaut : MR2_M, MR2_N, MR_M, MR_N, LUCAS_M, LUCAS_N, SMOOTHNESS. */
+  bool setRSAFactorPipeline (const rsa_factor_stage_t* order, unsigned int nStages);
+  unsigned int nRSAFactorStages () const { return _nStages; }
+  const rsa_factor_stage_t* rsaFactorStages () const { return _stages; }
+
+  /* Profil d'assurance des tests de primalité menés avec ce contexte
+     (isPrime, isPrime_MillerRabin sans nombre de tours explicite,
+     findRSAFactor). Par défaut : PRIME_ASSURANCE_CURRENT. */
+  void setAssurance (prime_assurance_t a);
+  prime_assurance_t assurance () const { return _assurance; }
+
+  /* Compteurs des étapes des recherches menées avec ce contexte */
+  const rsa_factor_stats_t& rsaFactorStats () const { return _stats; }
+  void resetRSAFactorStats ();
+
+ private:
+  gmp_randstate_t _witnessState;
+  MillerRabinWorkspace* _mr;
+  unsigned long _seedGeneration;
+  rsa_factor_stage_t _stages[RSA_FACTOR_NB_STAGES];
+  unsigned int _nStages;
+  rsa_factor_stats_t _stats;
+  prime_assurance_t _assurance;
+
+  void init ();
+  void seed (mpz_t seed);
+
+  friend bool isPrime_MillerRabin (mpz_t n, int iter, PrimeContext& ctx);
+  friend PrimeContext& threadPrimeContext ();
+  friend class RSAFactorPipeline;
+
+  PrimeContext (const PrimeContext&);
+  PrimeContext operator= (const PrimeContext&);
+};
+
+/* Contexte du fil d'exécution appelant */
+PrimeContext& threadPrimeContext ();
+
 bool isPrime (mpz_t n);
+bool isPrime (mpz_t n, PrimeContext& ctx);
+/* Test avec le profil a, quel que soit celui du contexte */
+bool isPrime (mpz_t n, prime_assurance_t a);
+bool isPrime (mpz_t n, PrimeContext& ctx, prime_assurance_t a);
+/* Sans borne explicite (bound=0), la borne et la méthode de division
+   sont celles de la table de réglage pour la taille de n (voir
+   isPrime_TrialDivision) */
 bool isPrime_Sieve (mpz_t n, size_t bound=0);
+
+/* Méthodes de division d'un entier par les petits premiers */
+typedef enum {
+  TRIAL_DIVISION_MOD_1,  /* Une division mpn_mod_1 par produit de premiers tenant dans un limbe */
+  TRIAL_DIVISION_GCD,    /* Un pgcd avec le produit des premiers */
+  TRIAL_DIVISION_TREE    /* Arbre des restes au-dessus des produits de premiers */
+} trial_division_t;
+
+/* Nombre de premiers impairs (inférieurs à 2^20) disponibles */
+#define TRIAL_DIVISION_MAX_PRIMES 82024
+
+/* Retourne false si n est pair ou divisible par l'un des nPrimes premiers
+   nombres premiers impairs (les méthodes GCD et TREE peuvent en tester
+   quelques-uns de plus, jusqu'à la fin du dernier produit). Si nPrimes
+   est nul, la borne et la méthode sont lues, selon la taille de n, dans
+   la table trial_division_tuning.h (régénérée par test_prime_perfs). */
+bool isPrime_TrialDivision (mpz_t n, unsigned int nPrimes=0,
+			    trial_division_t method=TRIAL_DIVISION_MOD_1);
+
+/* Mises en oeuvre du crible par lots */
+typedef enum {
+  SIEVE_BATCH_AUTO,    /* La plus rapide disponible sur le processeur courant */
+  SIEVE_BATCH_SCALAR,  /* Un candidat à la fois (isPrime_TrialDivision) */
+  SIEVE_BATCH_AVX2     /* Quatre candidats par registre AVX2 (x86-64) */
+} sieve_batch_t;
+
+/* Nombre de premiers impairs (inférieurs à 2^16) du crible par lots */
+#define SIEVE_BATCH_PRIMES 6541
+
+/* Vrai si la mise en oeuvre impl est utilisable sur ce processeur */
+bool isSieveBatchSupported (sieve_batch_t impl);
+/* Crible d'un lot de count groupes de width entiers, le groupe i étant
+   formé de n[i], n[i + count], ..., n[i + (width-1) count] (par exemple
+   m et 2m+1) : res[i] vaut true si isPrime_TrialDivision (x,
+   SIEVE_BATCH_PRIMES) est vrai pour chaque entier x du groupe. Le crible
+   d'un groupe s'arrête dès que l'un de ses entiers est éliminé. Lève une
+   exception si impl n'est pas utilisable (voir isSieveBatchSupported). */
+void isPrime_SieveBatch (mpz_t* n, unsigned int count, bool* res,
+			 sieve_batch_t impl=SIEVE_BATCH_AUTO, unsigned int width=1);
+/* Sans nombre de tours explicite (iter=0), celui du profil d'assurance
+   du contexte */
 bool isPrime_MillerRabin (mpz_t n, int iter=0);
+bool isPrime_MillerRabin (mpz_t n, int iter, PrimeContext& ctx);
+/* Test fort de Lucas (paramètres de Selfridge) : associé à
+   isPrime_MillerRabin, il forme le test BPSW */
 bool isPrime_Lucas (mpz_t n);
 bool isSmooth (mpz_t n);
+/* Parties friables d'un lot de count entiers strictement positifs, par
+   arbres des produits et des restes : s[i] est le plus grand diviseur
+   de n[i] formé de 2 et des nPrimes premiers nombres premiers impairs
+   (quelques-uns de plus peuvent être pris en compte, comme pour
+   isPrime_TrialDivision, sauf pour nPrimes = SIEVE_BATCH_PRIMES ou
+   TRIAL_DIVISION_MAX_PRIMES). s et n peuvent coïncider. */
+void smoothParts (mpz_t* s, mpz_t* n, unsigned int count, unsigned int nPrimes);
+/* res[i] = isSmooth (n[i]) pour un lot de count entiers strictement
+   positifs, plus rapide que des appels successifs dès quelques entiers.
+   Une borne nPrimes non nulle (au plus TRIAL_DIVISION_MAX_PRIMES)
+   remplace celle de isSmooth, la règle de décision restant la même. */
+void isSmoothBatch (mpz_t* n, unsigned int count, bool* res, unsigned int nPrimes=0);
 
 void genPrimeFT(mpz_t p, const size_t n, PRNG& generator, bool init_mpz);
+/* Premier p de nbits bits prouvé par la méthode de Maurer (chaîne de
+   critères de Pocklington, voir provable_prime.cpp) ; p n'est pas un
+   premier sûr. Si certificate n'est pas NULL, il reçoit le certificat
+   de primalité encodé en DER, qui contient p et doit donc être protégé
+   comme lui. */
+void genProvablePrime (mpz_t p, const size_t nbits, PRNG& generator, bool init_mpz,
+		       String* certificate = NULL);
+/* Vérification d'un certificat produit par genProvablePrime : retourne
+   true et le premier certifié dans p (initialisé) si le certificat est
+   valide. N'utilise ni aléa ni les tables des tests probabilistes. */
+bool checkPrimeCertificate (mpz_t p, const String& certificate);
+/* Parcours des candidats par findRSAFactor : nouveau tirage pour
+   chaque candidat (par défaut), ou crible incrémental à partir d'un
+   tirage (plus rapide, au prix d'un léger biais documenté dans
+   prime.cpp) */
+typedef enum {RSA_FACTOR_SEARCH_RANDOM, RSA_FACTOR_SEARCH_INCREMENTAL} rsa_factor_search_t;
+
+/* Stratégie de génération des facteurs RSA (voir genRSAFactor et le
+   comparatif de test_rsa_perfs). Toutes les stratégies donnent des
+   facteurs p de nbits bits vérifiant 3 x 2^(nbits-2) <= p.
+     - RSA_PRIME_CLASSIC : findRSAFactor (historique)
+     - RSA_PRIME_FT_SAFE : findRSAFactorFT, mêmes propriétés que
+       findRSAFactor par la méthode de Fouque-Tibouchi
+     - RSA_PRIME_FT : premier quelconque, par la méthode de
+       Fouque-Tibouchi (voir genPrimeFT)
+     - RSA_PRIME_PROVABLE : premier prouvé, qui n'est pas un premier
+       sûr (voir genProvablePrime) */
+typedef enum {
+  RSA_PRIME_CLASSIC,
+  RSA_PRIME_FT_SAFE,
+  RSA_PRIME_FT,
+  RSA_PRIME_PROVABLE,
+  RSA_PRIME_NB_STRATEGIES
+} rsa_prime_strategy_t;
+
+/* Nom d'une stratégie ("classic", "FT-safe", "FT", "provable"), et
+   stratégie d'après son nom (retourne false si le nom est inconnu) */
+const char* rsaPrimeStrategyName (rsa_prime_strategy_t s);
+bool rsaPrimeStrategyFromName (const char* name, rsa_prime_strategy_t* s);
+/* Vrai si la stratégie produit des premiers sûrs ((p-1)/2 premier) */
+bool rsaPrimeStrategyIsSafe (rsa_prime_strategy_t s);
+
 /* Extraction d'aléa au format "entier GMP" (mpz_t) jusqu'à obtenir un
    entier p vérifiant certaines propriétés :
      - p est premier
@@ -266,9 +491,40 @@ void genPrimeFT(mpz_t p, const size_t n, PRNG& generator, bool init_mpz);
      - (p-1)/2 - 1 n'est pas friable
      - (p-1)/2 + 1 n'est pas friable
 */
-void findRSAFactor (mpz_t factor, const size_t nbits, PRNG& generator, bool init_mpz);
+void findRSAFactor (mpz_t factor, const size_t nbits, PRNG& generator, bool init_mpz,
+		    rsa_factor_search_t mode = RSA_FACTOR_SEARCH_RANDOM);
+/* Idem avec un contexte explicite (ordre des étapes et compteurs), factor
+   devant être initialisé */
+void findRSAFactor (mpz_t factor, const size_t nbits, PRNG& generator, PrimeContext& ctx,
+		    rsa_factor_search_t mode = RSA_FACTOR_SEARCH_RANDOM);
+/* Facteur RSA de nbits bits selon la stratégie donnée, factor devant
+   être initialisé ; ctx n'est utilisé que par RSA_PRIME_CLASSIC, les
+   autres stratégies prenant le contexte du fil appelant */
+void genRSAFactor (mpz_t factor, const size_t nbits, PRNG& generator,
+		   rsa_prime_strategy_t strategy, PrimeContext& ctx);
+/* Recherche de deux facteurs RSA p et q (au sens de findRSAFactor,
+   p et q devant être initialisés) tels que | p - q | > diffMin.
+   La recherche est répartie sur nThreads fils d'exécution (par défaut
+   un seul ; 0 : un par processeur disponible), chacun tirant son aléa d'un générateur
+   Barak-Halevi initialisé à partir de generator. Le premier facteur
+   trouvé devient p ; tous les fils cherchent ensuite q. Avec un seul
+   fil, generator est utilisé directement, comme dans la recherche
+   séquentielle historique. L'ordre des étapes est pris dans ctx (par
+   défaut, le contexte du fil appelant), auquel sont ajoutés les
+   compteurs de tous les fils. Avec une autre stratégie que
+   RSA_PRIME_CLASSIC, les facteurs sont produits par genRSAFactor et
+   mode est ignoré. */
+void findRSAFactorPair (mpz_t p, mpz_t q, const size_t nbits, PRNG& generator,
+			const mpz_t diffMin, unsigned int nThreads = 1,
+			rsa_factor_search_t mode = RSA_FACTOR_SEARCH_RANDOM,
+			PrimeContext* ctx = NULL,
+			rsa_prime_strategy_t strategy = RSA_PRIME_CLASSIC);
 //TODO LCR supprimer cet api quand la nouvelle implem aura remplacée la vieille
 void findRSAFactorFT (mpz_t factor, const size_t nbits, PRNG& generator, bool init_mpz);
+/* Premier prouvé de nbits bits dont les deux bits de poids fort valent
+   1 (voir genProvablePrime) */
+void findRSAFactorProvable (mpz_t factor, const size_t nbits, PRNG& generator, bool init_mpz,
+			    String* certificate = NULL);
 
 
 
@@ -278,6 +534,57 @@ void findRSAFactorFT (mpz_t factor, const size_t nbits, PRNG& generator, bool in
  *******************************************/
 
 
+/* Résultat individuel d'une signature par lot (voir RSAKey::signBatch).
+   errNo et details ne sont significatifs que si ok est faux. */
+class RSABatchSignResult {
+ public:
+  RSABatchSignResult () : ok (false), errNo (E_UNKNOWN_ERROR) {}
+
+  bool ok;               /* vrai si le bloc a été signé */
+  String signedDER;      /* bloc signé (TBS, algorithme et signature) */
+  exception_t errNo;     /* type de l'erreur rencontrée si ok est faux */
+  String details;        /* détails de l'erreur rencontrée si ok est faux */
+};
+
+
+/* Niveau d'auto-test d'une clé RSA à sa génération ou à son import :
+     - RSA_SELF_TEST_FULL : bornes de n, e et d, taille du module,
+       friabilité du module et 10 chiffrements / déchiffrements ;
+     - RSA_SELF_TEST_FAST : bornes, taille et friabilité du module,
+       puis, si p et q sont connus, n = pq et ed = 1 mod lambda(n)
+       (lambda(n) = ppcm (p-1, q-1), étendus aux autres facteurs d'une
+       clé multi-premiers), et un seul chiffrement / déchiffrement (par
+       le CRT si possible). Adapté au chargement de nombreuses clés
+       déjà vérifiées à leur génération ;
+     - RSA_SELF_TEST_DEFERRED : seules les bornes et la taille sont
+       vérifiées à la construction ; le reste de l'auto-test complet
+       est mené lors de la première opération privée, qui échoue s'il
+       ne passe pas ;
+     - RSA_SELF_TEST_NONE : aucun auto-test (clé construite vide ou
+       par setFromASN1PrivateKey). */
+typedef enum {
+  RSA_SELF_TEST_FULL,
+  RSA_SELF_TEST_FAST,
+  RSA_SELF_TEST_DEFERRED,
+  RSA_SELF_TEST_NONE
+} rsa_self_test_t;
+
+
+/* Nombre maximal de facteurs premiers d'un module RSA (PKCS#1 v2.x
+   multi-premiers). Le nombre de facteurs autorisé dépend de la taille
+   du module (voir rsaMaxPrimes). */
+#define RSA_MAX_PRIMES 4
+
+/* Nombre maximal de facteurs d'un module de nBits bits pour que la
+   factorisation par ECM d'un facteur ne soit pas plus facile que
+   celle du module entier : 2 en deçà de 1024 bits, 3 en deçà de 4096
+   bits, RSA_MAX_PRIMES au-delà */
+unsigned int rsaMaxPrimes (const size_t nBits);
+
+
+/* Espace de travail des opérations privées (défini dans rsa.cpp) */
+class RSAWorkspace;
+
 class RSAKey {
  public:
 
@@ -292,18 +599,36 @@ class RSAKey {
        - e < n et d < n
        - si e vaut 65537 (càd si useF4 vaut vrai), d > 2^(nbits/2)
        - si e est choisi aléatoirement, e, d > 2^(nbits - 10)
-  */
-  RSAKey (PRNG& prng, const size_t nBits, bool useF4);
+     Les facteurs p et q sont cherchés sur nThreads fils d'exécution
+     (par défaut un seul ; 0 : un par processeur disponible, voir
+     findRSAFactorPair), selon
+     la stratégie donnée : seules RSA_PRIME_CLASSIC et
+     RSA_PRIME_FT_SAFE donnent des facteurs RSA au sens de
+     findRSAFactor. La clé est vérifiée selon le niveau selfTest
+     (voir rsa_self_test_t).
+     Avec nPrimes > 2 (au plus rsaMaxPrimes (nBits)), le module est le
+     produit de nPrimes facteurs de nBits / nPrimes bits environ, deux
+     à deux distants de plus de 2^(nBits/nPrimes - 20) : p et q sont
+     cherchés comme ci-dessus, les suivants par genRSAFactor dans le
+     fil appelant. Les opérations privées passent alors par le CRT
+     multi-premiers de PKCS#1 v2.x. */
+  RSAKey (PRNG& prng, const size_t nBits, bool useF4, unsigned int nThreads = 1,
+	  rsa_prime_strategy_t strategy = RSA_PRIME_CLASSIC,
+	  rsa_self_test_t selfTest = RSA_SELF_TEST_FULL,
+	  unsigned int nPrimes = 2);
 
   /* Création de l'objet RSAPrivateKey à partir d'entiers
      GMP. Attention, les entiers passés en arguments seront
      détruits. Le générateur d'aléa à fournir n'est là que pour les
      tests de chiffrement/déchiffrement */
-  RSAKey (PRNG& prng, mpz_t n, mpz_t d, mpz_t e, mpz_t p, mpz_t q);
+  RSAKey (PRNG& prng, mpz_t n, mpz_t d, mpz_t e, mpz_t p, mpz_t q,
+	  rsa_self_test_t selfTest = RSA_SELF_TEST_FULL);
 
   /* Création de l'objet RSAPrivateKey à partir d'un objet ASN.1
-     standard, encodé en DER */
-  RSAKey (PRNG& prng, const String& DERString);
+     standard, encodé en DER (éventuellement multi-premiers, voir
+     ASN1PrivateKey) */
+  RSAKey (PRNG& prng, const String& DERString,
+	  rsa_self_test_t selfTest = RSA_SELF_TEST_FULL);
   
 
   void forgetKey ();
@@ -312,6 +637,34 @@ class RSAKey {
 
   const String sign (const ANSSIPKI_ASN1::TBS& tbs) const;
 
+  /* Signature PKCS#1 v1.5 d'un condensat déjà calculé avec la
+     fonction hashFunc (digest a la longueur de sortie de celle-ci).
+     La signature, de la taille du module, est écrite dans out ; *outLen
+     donne en entrée la taille du tampon et reçoit en sortie celle de
+     la signature. L'encodage et les entiers GMP utilisent un espace de
+     travail propre au fil d'exécution appelant : passé le premier
+     appel, aucune allocation sur le tas n'est réalisée.
+     retourne :
+       0 en cas de succès
+       -1 si un pointeur est nul
+       -2 si la fonction de hachage est inconnue
+       -3 si le tampon est trop petit (*outLen reçoit la taille requise)
+       -4 si le module est trop petit pour l'encodage
+       -5 si une faute a été détectée lors de l'exponentiation
+       -6 si l'auto-test différé de la clé a échoué */
+  int signDigest (ANSSIPKI_HASH::hash_function_t hashFunc, const unsigned char *digest,
+		  unsigned char *out, size_t *outLen) const;
+
+  /* Signature d'un lot de count blocs de données. Le hachage, le
+     bourrage et l'exponentiation sont répartis sur nThreads fils
+     d'exécution (le fil appelant compris ; 0 signifie autant que de
+     processeurs disponibles). results[i] reçoit le résultat de la
+     signature de tbs[i] ; une erreur sur un bloc n'interrompt pas le
+     traitement des autres. L'auto-test différé éventuel est mené
+     avant le lancement des fils. */
+  void signBatch (const ANSSIPKI_ASN1::TBS* const tbs[], RSABatchSignResult results[],
+		  const size_t count, unsigned int nThreads = 0) const;
+
   bool verify (const mpz_t msg, const mpz_t sig) const;
 
   /*
@@ -350,6 +703,14 @@ class RSAKey {
     | INTEGER (d mod (p-1))
     | INTEGER (d mod (q-1))
     | INTEGER ((inverse of q) mod p)
+    | SEQUENCE (otherPrimeInfos, clés multi-premiers seulement)
+    | | SEQUENCE
+    | | | INTEGER (r_i, i >= 3)
+    | | | INTEGER (d mod (r_i - 1))
+    | | | INTEGER ((inverse of r_1 ... r_(i-1)) mod r_i)
+    | | ...
+    La version vaut 1 pour une clé multi-premiers, 0 sinon. À l'import,
+    les paramètres CRT sont ignorés et recalculés.
   */
   const String ASN1PrivateKey () const;
   bool setFromASN1PrivateKey (const String& DERString);
@@ -375,6 +736,14 @@ class RSAKey {
 
 
   bool isInitialized () const { return _initialized; }
+
+  /* Nombre de facteurs premiers du module (2 à RSA_MAX_PRIMES) */
+  unsigned int nPrimes () const { return _nPrimes; }
+
+  /* Niveau d'auto-test appliqué à la clé, et indication qu'un
+     auto-test différé reste à mener */
+  rsa_self_test_t selfTest () const { return _selfTest; }
+  bool selfTestPending () const;
   int copyN (mpz_t *) const;
   int copyE (mpz_t *) const;
   int copyD (mpz_t *) const;
@@ -391,10 +760,14 @@ class RSAKey {
 
 
   // Calcule res = data ^ d mod (n)
+  // Lorsque p et q sont connus, le calcul passe par le CRT (voir
+  // crtExponentiation).
   // conditions : 
   // 0 <= data <= n, sinon retourne -1
   // objet initialise sinon retourne -2
   // pointeurs res et data non nuls, sinon retourne -3
+  // resultat incoherent (faute detectee), retourne -4
+  // echec de l'auto-test differe de la cle, retourne -5
   int private_exponentiation (mpz_t *res, mpz_t *data);
   int private_exponentiation (unsigned char *res, size_t *resLen, const unsigned char *data, const size_t dataLen);
 
@@ -403,7 +776,7 @@ class RSAKey {
   int public_exponentiation (unsigned char *res, size_t *resLen, const unsigned char *data, const size_t dataLen);
 
 
-  int pkcs1_v1_5_encode (unsigned char *res, const size_t emLen, const unsigned char *data, const size_t dataLen, ANSSIPKI_HASH::hash_function_t hashFunc = ANSSIPKI_HASH::invalid);
+  int pkcs1_v1_5_encode (unsigned char *res, const size_t emLen, const unsigned char *data, const size_t dataLen, ANSSIPKI_HASH::hash_function_t hashFunc = ANSSIPKI_HASH::invalid) const;
 
  private:
   bool _initialized;
@@ -413,9 +786,66 @@ class RSAKey {
   mpz_t _q;
   mpz_t _e;
 
+  /* Paramètres CRT précalculés (PKCS#1) : dP = d mod (p-1),
+     dQ = d mod (q-1) et qInv = q^-1 mod p. Ils ne sont valides que si
+     _crt vaut vrai, c'est-à-dire si p, q et d sont connus. */
+  bool _crt;
+  mpz_t _dP;
+  mpz_t _dQ;
+  mpz_t _qInv;
+
+  /* Facteurs au-delà de p et q d'un module multi-premiers
+     (r_3 ... r_nPrimes de PKCS#1, les _nPrimes - 2 premiers éléments
+     sont utilisés) et leurs paramètres CRT : d mod (r_i - 1) et
+     (p q r_3 ... r_(i-1))^-1 mod r_i */
+  unsigned int _nPrimes;
+  mpz_t _r[RSA_MAX_PRIMES - 2];
+  mpz_t _dR[RSA_MAX_PRIMES - 2];
+  mpz_t _tR[RSA_MAX_PRIMES - 2];
+
+  /* Niveau d'auto-test de la clé et, pour RSA_SELF_TEST_DEFERRED,
+     état de l'auto-test (voir rsa.cpp) et graine des chiffrements /
+     déchiffrements qu'il réalisera */
+  rsa_self_test_t _selfTest;
+  mutable int _selfTestState;
+  mpz_t _selfTestSeed;
+  /* Sérialise l'auto-test différé de cette clé, mené au plus une fois
+     par le premier fil qui en a besoin */
+  mutable pthread_mutex_t _selfTestLock;
+
+  /* Initialisation (à vide) des facteurs au-delà de p et q */
+  void initOtherPrimes ();
+
+  /* (Re)calcul des paramètres CRT à partir de p, q, des r_i et de d */
+  void updateCRT ();
+
+  /* Exponentiation privée res = m ^ d mod n par recombinaison de
+     Garner, étendue aux facteurs r_i le cas échéant (nécessite _crt).
+     Les intermédiaires sont pris dans ws. */
+  void crtExponentiation (mpz_t res, const mpz_t m, RSAWorkspace& ws) const;
+
+  /* Exponentiation privée res = m ^ d mod n (CRT si possible), suivie
+     d'une vérification du résultat pour détecter une éventuelle
+     faute. Retourne false si la vérification échoue. */
+  bool privateOperation (mpz_t res, const mpz_t m, RSAWorkspace& ws) const;
+
+  /* Exponentiation publique res = m ^ e mod n */
+  void publicOperation (mpz_t res, const mpz_t m) const;
+
   /* Réalisation de tests de correction de la clé générée, et création
-     de l'objet pubkey */
-  void checkKey (const size_t nbits, const mpz_t randomSeed);
+     de l'objet pubkey, selon le niveau d'auto-test donné */
+  void checkKey (const size_t nbits, const mpz_t randomSeed, rsa_self_test_t selfTest);
+
+  /* Vérification de n = pq (r_3 ... r_nPrimes) et ed = 1 mod lambda(n) */
+  void checkKeyStructure () const;
+
+  /* nRounds chiffrements / déchiffrements de messages tirés à partir
+     de randomSeed */
+  void checkKeyRoundTrips (const mpz_t randomSeed, int nRounds) const;
+
+  /* Réalisation de l'auto-test différé s'il est en attente. Retourne
+     false si la clé ne peut être utilisée. */
+  bool runDeferredSelfTest () const;
 
   //  RSAKey ();
   RSAKey (const RSAKey&);
@@ -423,4 +853,36 @@ class RSAKey {
 };
 
 
+
+/*****************************************************
+ * Recherche de facteurs communs entre modules RSA   *
+ *****************************************************/
+
+/* Lecture du module d'une clé RSA encodée en DER, sous l'une des formes
+   produites par RSAKey : ASN1PublicKey, ASN1PubKeyInfo, ASN1PrivateKey
+   ou ASN1PrivateKeyInfo. n doit être initialisé. Retourne false si
+   l'encodage n'est pas reconnu. */
+bool getRSAModulus (mpz_t n, const String& DERString);
+
+/* Pgcd par lots (arbres des produits et des restes, voir
+   batch_gcd.cpp) : g[i] reçoit le pgcd de n[i] et du produit des
+   autres modules, qui vaut 1 si n[i] ne partage aucun facteur avec
+   eux. Les g[i] doivent être initialisés. Le calcul est réparti sur
+   nThreads fils d'exécution (0 : un par processeur disponible). */
+void batchGcd (mpz_t* g, mpz_t* n, unsigned int count, unsigned int nThreads = 0);
+
+/* Paire de modules n[i] et n[j] (i < j) ayant un facteur commun */
+typedef struct {
+  unsigned int i;
+  unsigned int j;
+} rsa_shared_pair_t;
+
+/* Recherche des paires de modules ayant un facteur commun : batchGcd,
+   puis pgcd deux à deux des seuls modules signalés. Les maxPairs
+   premières paires (dans l'ordre lexicographique) sont écrites dans
+   pairs ; la valeur retournée est le nombre total de paires. */
+unsigned int findSharedFactors (mpz_t* n, unsigned int count, rsa_shared_pair_t* pairs,
+				unsigned int maxPairs, unsigned int nThreads = 0);
+
+
 #endif // ifndef ANSSIPKI_CRYPTO_H
@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Recherche de facteurs communs entre modules RSA
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "anssipki-common.h"
+#include "anssipki-asn1.h"
+#include "anssipki-crypto.h"
+#include <new>
+#include <pthread.h>
+#include <unistd.h>
+
+using namespace ANSSIPKI_ASN1;
+
+/* Deux modules RSA générés avec un aléa défaillant peuvent partager un
+   facteur premier, que l'on retrouve par un simple pgcd. Les pgcd deux
+   à deux coûtent k^2 opérations pour k modules ; le pgcd par lots de
+   Bernstein ("How to find smooth parts of integers", 2004, et Heninger
+   et al., "Mining your Ps and Qs", 2012) ramène ce coût à un nombre
+   d'opérations quasi linéaire en la taille totale des modules :
+   + l'arbre des produits donne N = n_1 ... n_k ;
+   + l'arbre des restes donne N mod n_i^2 : N est réduit modulo le carré
+   de chacun des deux sous-produits, etc. ;
+   + pgcd (n_i, (N mod n_i^2) / n_i) est le pgcd de n_i avec le produit
+   des autres modules.
+   Chaque niveau des arbres est réparti entre les fils d'exécution. Les
+   derniers niveaux (quelques produits de très grande taille) restent
+   séquentiels ; l'essentiel du calcul se fait toutefois dans les
+   niveaux inférieurs lorsque les modules sont nombreux.
+   Les niveaux de l'arbre occupent chacun la taille totale des modules :
+   pour 100 000 modules de 2048 bits, compter environ 25 Mo par niveau
+   et 17 niveaux. Les restes remplacent les produits au fil de la
+   descente, sans mémoire supplémentaire. */
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Lecture du module d'une clé encodée en DER
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// Lecture d'un INTEGER positif
+static bool getNextModulus (const String& DERString, mpz_t n) {
+  ASN1_BASIC asn1Integer (DERString);
+
+  if (asn1Integer.classe != C_UNIV || asn1Integer.tagNumber != T_INTG
+      || asn1Integer.value.size () == 0 || (asn1Integer.value.toChar ()[0] & 0x80))
+    return false;
+
+  mpz_import (n, asn1Integer.value.size (), 1, 1, 0, 0, asn1Integer.value.toChar ());
+  return true;
+}
+
+
+// RSAPublicKey (n, e) ou RSAPrivateKey (version, n, e, d, ...), voir
+// RSAKey::ASN1PublicKey et RSAKey::ASN1PrivateKey
+static bool getModulusFromKey (const String& DERString, mpz_t n) {
+  String content (decapsulate (DERString, T_SEQU));
+  mpz_t first;
+  bool res;
+
+  mpz_init (first);
+  res = getNextModulus (content, first) && !content.eof () && getNextModulus (content, n);
+  if (res && content.eof ())
+    mpz_set (n, first);
+  mpz_clear (first);
+
+  return res;
+}
+
+
+bool getRSAModulus (mpz_t n, const String& DERString) {
+  try {
+    DERString.initIndex ();
+    String content (decapsulate (DERString, T_SEQU));
+    ASN1_BASIC first (content);
+
+    // SubjectPublicKeyInfo : algorithme, puis BIT STRING contenant
+    // RSAPublicKey précédée du nombre de bits inutilisés (nul)
+    if (first.tagNumber == T_SEQU) {
+      ASN1_BASIC pubKey (content);
+      if (pubKey.tagNumber != T_BSTR || pubKey.value.size () < 1 || pubKey.value.popChar () != 0)
+	return false;
+      return getModulusFromKey (pubKey.value.popSubstring (pubKey.value.size () - 1), n);
+    }
+
+    if (first.tagNumber != T_INTG || content.eof ())
+      return false;
+
+    // PrivateKeyInfo : version, algorithme, puis OCTET STRING contenant
+    // RSAPrivateKey
+    ASN1_BASIC second (content);
+    if (second.tagNumber == T_SEQU) {
+      ASN1_BASIC privKey (content);
+      if (privKey.tagNumber != T_OSTR)
+	return false;
+      return getModulusFromKey (privKey.value, n);
+    }
+
+    DERString.initIndex ();
+    return getModulusFromKey (DERString, n);
+  } catch (ANSSIPKIException& e) {
+    return false;
+  }
+}
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Pgcd par lots
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+typedef enum {
+  BATCH_GCD_PRODUCT,    /* levels[l][i] = levels[l-1][2i] levels[l-1][2i+1] */
+  BATCH_GCD_REMAINDER,  /* levels[l][i] = levels[l+1][i/2] mod levels[l][i]^2 */
+  BATCH_GCD_LEAF        /* g[i] = pgcd (n[i], (levels[1][i/2] mod n[i]^2) / n[i]) */
+} batchGcdStep;
+
+
+/* Contexte partagé par les fils d'exécution de batchGcd, pour le
+   traitement d'un niveau (voir batchSignContext dans rsa.cpp) */
+typedef struct {
+  mpz_t** levels;       /* levels[0] est le tableau des modules */
+  unsigned int* levelSize;
+  mpz_t* g;
+  unsigned int level;
+  batchGcdStep step;
+  unsigned int next;    /* Prochain noeud à traiter (accès atomique) */
+  int outOfMemory;      /* Positionné si un fil a rencontré std::bad_alloc */
+} batchGcdContext;
+
+
+static void* batchGcdWorker (void* arg) {
+  batchGcdContext* ctx = (batchGcdContext*) arg;
+  const unsigned int l = ctx->level;
+  mpz_t** levels = ctx->levels;
+  unsigned int i;
+  mpz_t tmp;
+
+  mpz_init (tmp);
+  try {
+    while (!ctx->outOfMemory &&
+	   (i = __sync_fetch_and_add (&ctx->next, 1)) < ctx->levelSize[l]) {
+      switch (ctx->step) {
+      case BATCH_GCD_PRODUCT:
+	if (2*i + 1 < ctx->levelSize[l-1])
+	  mpz_mul (levels[l][i], levels[l-1][2*i], levels[l-1][2*i+1]);
+	else
+	  mpz_set (levels[l][i], levels[l-1][2*i]);
+	break;
+
+      case BATCH_GCD_REMAINDER:
+	mpz_mul (tmp, levels[l][i], levels[l][i]);
+	mpz_tdiv_r (levels[l][i], levels[l+1][i/2], tmp);
+	break;
+
+      case BATCH_GCD_LEAF:
+	mpz_mul (tmp, levels[0][i], levels[0][i]);
+	mpz_tdiv_r (tmp, levels[1][i/2], tmp);
+	mpz_divexact (tmp, tmp, levels[0][i]);
+	mpz_gcd (ctx->g[i], tmp, levels[0][i]);
+	break;
+      }
+    }
+  } catch (std::bad_alloc& e) {
+    // Relancée dans le fil appelant
+    __sync_fetch_and_or (&ctx->outOfMemory, 1);
+  }
+  mpz_clear (tmp);
+
+  return NULL;
+}
+
+
+// Traitement d'un niveau : le fil appelant participe, avec au plus
+// nThreads - 1 fils supplémentaires
+static void batchGcdLevel (batchGcdContext* ctx, unsigned int level,
+			   batchGcdStep step, unsigned int nThreads) {
+  pthread_t* threads;
+  unsigned int i, nStarted = 0;
+
+  ctx->level = level;
+  ctx->step = step;
+  ctx->next = 0;
+  if (nThreads > ctx->levelSize[level])
+    nThreads = ctx->levelSize[level];
+
+  threads = new pthread_t[nThreads];
+  for (i = 1; i < nThreads; i++) {
+    if (pthread_create (&threads[nStarted], NULL, batchGcdWorker, ctx) != 0)
+      break;
+    nStarted++;
+  }
+
+  batchGcdWorker (ctx);
+
+  for (i = 0; i < nStarted; i++)
+    pthread_join (threads[i], NULL);
+  delete[] threads;
+}
+
+
+void batchGcd (mpz_t* g, mpz_t* n, unsigned int count, unsigned int nThreads) {
+  batchGcdContext ctx;
+  unsigned int nLevels = 1, size = count;
+
+  for (unsigned int i = 0; i < count; i++)
+    if (mpz_sgn (n[i]) <= 0)
+      throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Module non strictement positif");
+  if (count < 2) {
+    if (count == 1)
+      mpz_set_ui (g[0], 1);
+    return;
+  }
+
+  if (nThreads == 0) {
+    long nCPU = sysconf (_SC_NPROCESSORS_ONLN);
+    nThreads = (nCPU > 0) ? (unsigned int) nCPU : 1;
+  }
+
+  while (size > 1) {
+    size = (size + 1) / 2;
+    nLevels++;
+  }
+  ctx.levelSize = new unsigned int[nLevels];
+  ctx.levels = new mpz_t*[nLevels];
+  ctx.g = g;
+  ctx.outOfMemory = 0;
+
+  ctx.levelSize[0] = count;
+  ctx.levels[0] = n;
+  for (unsigned int l = 1; l < nLevels; l++) {
+    ctx.levelSize[l] = (ctx.levelSize[l-1] + 1) / 2;
+    ctx.levels[l] = new mpz_t[ctx.levelSize[l]];
+    for (unsigned int i = 0; i < ctx.levelSize[l]; i++)
+      mpz_init (ctx.levels[l][i]);
+  }
+
+  // Arbre des produits, puis arbre des restes (la racine N vaut déjà
+  // N mod N^2)
+  for (unsigned int l = 1; l < nLevels && !ctx.outOfMemory; l++)
+    batchGcdLevel (&ctx, l, BATCH_GCD_PRODUCT, nThreads);
+  for (unsigned int l = nLevels - 2; l > 0 && !ctx.outOfMemory; l--)
+    batchGcdLevel (&ctx, l, BATCH_GCD_REMAINDER, nThreads);
+  if (!ctx.outOfMemory)
+    batchGcdLevel (&ctx, 0, BATCH_GCD_LEAF, nThreads);
+
+  for (unsigned int l = 1; l < nLevels; l++) {
+    for (unsigned int i = 0; i < ctx.levelSize[l]; i++)
+      mpz_clear (ctx.levels[l][i]);
+    delete[] ctx.levels[l];
+  }
+  delete[] ctx.levels;
+  delete[] ctx.levelSize;
+
+  if (ctx.outOfMemory)
+    throw std::bad_alloc ();
+}
+
+
+unsigned int findSharedFactors (mpz_t* n, unsigned int count, rsa_shared_pair_t* pairs,
+				unsigned int maxPairs, unsigned int nThreads) {
+  mpz_t* g = new mpz_t[count];
+  unsigned int* flagged = new unsigned int[count];
+  unsigned int nFlagged = 0, nPairs = 0;
+  mpz_t d;
+
+  for (unsigned int i = 0; i < count; i++)
+    mpz_init (g[i]);
+  mpz_init (d);
+
+  try {
+    batchGcd (g, n, count, nThreads);
+  } catch (...) {
+    for (unsigned int i = 0; i < count; i++)
+      mpz_clear (g[i]);
+    delete[] g;
+    delete[] flagged;
+    mpz_clear (d);
+    throw;
+  }
+
+  // Seuls les modules signalés par le pgcd par lots sont comparés deux
+  // à deux, pour désigner les paires
+  for (unsigned int i = 0; i < count; i++)
+    if (mpz_cmp_ui (g[i], 1) != 0)
+      flagged[nFlagged++] = i;
+
+  for (unsigned int a = 0; a < nFlagged; a++)
+    for (unsigned int b = a + 1; b < nFlagged; b++) {
+      mpz_gcd (d, n[flagged[a]], n[flagged[b]]);
+      if (mpz_cmp_ui (d, 1) == 0)
+	continue;
+      if (nPairs < maxPairs) {
+	pairs[nPairs].i = flagged[a];
+	pairs[nPairs].j = flagged[b];
+      }
+      nPairs++;
+    }
+
+  for (unsigned int i = 0; i < count; i++)
+    mpz_clear (g[i]);
+  delete[] g;
+  delete[] flagged;
+  mpz_clear (d);
+
+  return nPairs;
+}
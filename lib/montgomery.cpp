@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Arithmétique de Montgomery
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "anssipki-common.h"
+#include "montgomery.h"
+
+#if GMP_NAIL_BITS != 0
+#error "La réduction de Montgomery suppose des limbes sans bits de garde"
+#endif
+
+
+/* Copie des limbes de x (x < B^n) sur exactement n limbes */
+static void copyLimbs (mp_limb_t* dst, const mpz_t x, mp_size_t n) {
+  mp_size_t s = mpz_size (x);
+  for (mp_size_t i=0; i<s; i++)
+    dst[i] = mpz_getlimbn (x, i);
+  for (mp_size_t i=s; i<n; i++)
+    dst[i] = 0;
+}
+
+
+static void shredLimbs (mp_limb_t* p, size_t n) {
+  volatile mp_limb_t* vp = p;
+  for (size_t i=0; i<n; i++)
+    vp[i] = 0;
+}
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Module de Montgomery
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+MontgomeryModulus::MontgomeryModulus () {
+  _n = 0;
+  _m = NULL;
+  _mInv = 0;
+  _one = NULL;
+}
+
+
+MontgomeryModulus::~MontgomeryModulus () {
+  clear ();
+}
+
+
+// Le module peut être secret (facteur d'une clé RSA, candidat premier)
+void MontgomeryModulus::clear () {
+  if (_m != NULL) {
+    shredLimbs (_m, (size_t) _n);
+    shredLimbs (_one, (size_t) _n);
+    delete[] _m;
+    delete[] _one;
+  }
+  _n = 0;
+  _m = NULL;
+  _mInv = 0;
+  _one = NULL;
+}
+
+
+bool MontgomeryModulus::init (const mpz_t m) {
+  clear ();
+
+  if (mpz_cmp_ui (m, 1) <= 0 || mpz_even_p (m))
+    return false;
+
+  mp_size_t n = mpz_size (m);
+  mpz_t r;
+
+  _m = new mp_limb_t[n];
+  _one = new mp_limb_t[n];
+  _n = n;
+  copyLimbs (_m, m, n);
+
+  // Inverse de m modulo B par itération de Newton : pour m impair,
+  // m x m = 1 mod 8, et chaque itération double le nombre de bits
+  // corrects
+  mp_limb_t x = _m[0];
+  for (unsigned int bits=3; bits<GMP_NUMB_BITS; bits*=2)
+    x *= 2 - _m[0] * x;
+  _mInv = -x;
+
+  mpz_init (r);
+  mpz_setbit (r, n * GMP_NUMB_BITS);
+  mpz_mod (r, r, m);
+  copyLimbs (_one, r, n);
+  mpz_clear (r);
+
+  return true;
+}
+
+
+void MontgomeryModulus::redc (mp_limb_t* rp, mp_limb_t* up) const {
+  mp_limb_t* p = up;
+  mp_limb_t cy;
+
+  // Chaque passe annule le limbe de poids faible courant ; la retenue
+  // est stockée à sa place et ajoutée en bloc à la fin
+  for (mp_size_t i=0; i<_n; i++) {
+    mp_limb_t q = p[0] * _mInv;
+    cy = mpn_addmul_1 (p, _m, _n, q);
+    p[0] = cy;
+    p++;
+  }
+
+  // Le résultat est < R + m : une soustraction en cas de retenue
+  // suffit à le ramener sur n limbes. La réduction complète modulo m
+  // est laissée à l'appelant.
+  cy = mpn_add_n (rp, up + _n, up, _n);
+  if (cy != 0)
+    mpn_sub_n (rp, rp, _m, _n);
+}
+
+
+void MontgomeryModulus::mul (mp_limb_t* rp, const mp_limb_t* ap, const mp_limb_t* bp, mp_limb_t* tp) const {
+  mpn_mul_n (tp, ap, bp, _n);
+  redc (rp, tp);
+}
+
+
+void MontgomeryModulus::sqr (mp_limb_t* rp, const mp_limb_t* ap, mp_limb_t* tp) const {
+  mpn_sqr (tp, ap, _n);
+  redc (rp, tp);
+}
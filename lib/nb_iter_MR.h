@@ -81,18 +81,90 @@ static unsigned int nb_iter_MR_table[nb_iter_MR_table_len][2] = {
 {1794, 3},
 {2719, 2}};
 
-/* Cette fonction détermine, pour un entier k le nombre suffisant
-   d'itérations de Miller-Rabin */
-static unsigned int nb_iter_MR(size_t k) {
-  unsigned int i, a = 0, b = nb_iter_MR_table_len;
+/* Table de même forme pour une probabilité d'erreur de 2^{-100}, utilisée
+   lorsque le test de Miller-Rabin est complété par un test de Lucas (profil
+   PRIME_ASSURANCE_FIPS186_5) : on retrouve les nombres de tours donnés
+   par FIPS 186-4 (C.3) pour les facteurs RSA lorsqu'un test de Lucas est
+   aussi effectué (4 pour 1024 bits, 3 pour 1536 bits). La borne est celle
+   de Damgård, Landrock et Pomerance, reprise dans l'annexe F de
+   FIPS 186-4 :
+     p_{k,t} <= 2.00743 ln(2) k 2^{-2} (2^{-Mt} + 8 (pi^2 - 6) / 3
+                 sum_{m=3}^{M} sum_{j=2}^{m} 2^{m - (m-1) t - j - (k-1)/j})
+   minimisée sur 3 <= M <= 2 sqrt(k-1) - 1, qui redonne exactement la table
+   précédente pour 2^{-128}. On conserve au moins deux tours, comme dans la
+   table précédente. */
+
+static const unsigned int nb_iter_MR_Lucas_table_len = 46;
+
+static unsigned int nb_iter_MR_Lucas_table[nb_iter_MR_Lucas_table_len][2] = {
+{0, 200},
+{50, 46},
+{54, 45},
+{61, 44},
+{67, 43},
+{74, 42},
+{80, 41},
+{86, 40},
+{93, 39},
+{99, 38},
+{105, 37},
+{111, 36},
+{118, 35},
+{124, 34},
+{130, 33},
+{136, 32},
+{142, 31},
+{149, 30},
+{155, 29},
+{161, 28},
+{167, 27},
+{173, 26},
+{179, 25},
+{186, 24},
+{192, 23},
+{198, 22},
+{204, 21},
+{211, 20},
+{218, 19},
+{227, 18},
+{237, 17},
+{249, 16},
+{262, 15},
+{277, 14},
+{294, 13},
+{315, 12},
+{339, 11},
+{368, 10},
+{404, 9},
+{449, 8},
+{508, 7},
+{587, 6},
+{699, 5},
+{869, 4},
+{1160, 3},
+{1762, 2}};
+
+static unsigned int nb_iter_MR_lookup(unsigned int table[][2], unsigned int len, size_t k) {
+  unsigned int i, a = 0, b = len;
   while (b-a > 1) {
       i = (a + b) / 2;
-      if (k < nb_iter_MR_table[i][0])
+      if (k < table[i][0])
           b = i;
       else
           a = i;
   }
-  return nb_iter_MR_table[a][1];
+  return table[a][1];
+}
+
+/* Cette fonction détermine, pour un entier k le nombre suffisant
+   d'itérations de Miller-Rabin */
+static unsigned int nb_iter_MR(size_t k) {
+  return nb_iter_MR_lookup(nb_iter_MR_table, nb_iter_MR_table_len, k);
+}
+
+/* Idem lorsqu'un test de Lucas est aussi effectué */
+static unsigned int nb_iter_MR_Lucas(size_t k) {
+  return nb_iter_MR_lookup(nb_iter_MR_Lucas_table, nb_iter_MR_Lucas_table_len, k);
 }
 
 #endif
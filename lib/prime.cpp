@@ -8,12 +8,18 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include <cstdlib>
+#include <cstring>
+#include <new>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "anssipki-crypto.h"
 #include "anssipki-common.h"
 
 #include "gmp.h"
+#include "montgomery.h"
 #include "nb_iter_MR.h"
+#include "sieve_kernel.h"
 
 /* Quelques notions de complexité */
 /**********************************/
@@ -90,6 +96,39 @@
    Référence : "Are 'Strong' Primes Needed for RSA?" par Rivest et Silverman, 1999/2001.
 */
 
+/* Aléa des facteurs RSA et recherche incrémentale */
+/***************************************************/
+/* + En mode RSA_FACTOR_SEARCH_RANDOM, chaque candidat m est un nouveau
+   tirage : le facteur obtenu est (aux bits forcés près) uniforme parmi
+   les facteurs RSA de la taille voulue. m et 2m+1 sont criblés
+   ensemble par computeResidues, qui ne réduit que m ; ceci reste plus
+   rapide que le crible par lots (isPrime_SieveBatch), qui réduit m et
+   2m+1 séparément.
+   + En mode RSA_FACTOR_SEARCH_INCREMENTAL, on tire un point de départ m0
+   puis on parcourt m0, m0 + 6, m0 + 12, ... Les restes de m0 modulo les
+   petits premiers ne sont calculés qu'une fois, et l'on marque dans un
+   crible les positions où m ou 2m+1 a un petit facteur : seuls les
+   survivants atteignent Miller-Rabin. Le coût d'obtention d'un candidat
+   pour Miller-Rabin est ainsi divisé par la longueur moyenne de
+   l'intervalle parcouru.
+   + En contrepartie, le facteur retourné n'est plus uniforme : un
+   facteur est choisi avec une probabilité proportionnelle à la
+   distance qui le sépare du facteur précédent (dans la progression de
+   raison 6). Brandt et Damgård ("On generation of probable primes by
+   incremental search", CRYPTO'92) montrent que l'entropie perdue est
+   de quelques bits au plus, et Mihailescu ("Measuring the cryptographic
+   relevance of probabilistic primality tests", 1994) que la fraction
+   des premiers favorisés est négligeable pour des tailles RSA.
+   + Le parcours est limité à INCREMENTAL_SIEVE_MAX_WINDOWS fenêtres de
+   INCREMENTAL_SIEVE_LENGTH candidats à partir d'un même tirage, au-delà
+   desquelles un nouveau point de départ est tiré ; ceci borne le biais.
+   Pour un facteur de 1024 bits, environ 40 000 candidats (une dizaine
+   de fenêtres) sont parcourus en moyenne.
+   + Comme pour la génération de Fouque-Tibouchi, le biais n'apporte
+   aucune méthode de factorisation connue ; le mode aléatoire reste
+   disponible pour les politiques exigeant l'uniformité.
+*/
+
 /* Paramètres concernant les nombres premiers */
 /**********************************************/
 
@@ -142,11 +181,17 @@
    + b = 22, BITS = 32 : PRIMES_SIZE=295947, PRIMES_PRODUCTS_SIZE=292625
    + b = 23, BITS = 64 : PRIMES_SIZE=564163, PRIMES_PRODUCTS_SIZE=249356
    + b = 23, BITS = 32 : PRIMES_SIZE=564163, PRIMES_PRODUCTS_SIZE=560841
+
+   Les tableaux eux-mêmes sont générés (prime_tables.h, pour b = 16) :
+   changer b impose de les régénérer.
 */
 
 /* Borne maximale utilisée pour rejeter par division des nombres visiblement
    non premiers avant d'utiliser des tests probabilistes coûteux.
    Cette borne n'a pas d'implications de sécurité, uniquement de performances.
+   Elle ne sert plus qu'au crible des facteurs RSA (voir computeResidues) :
+   isPrime_Sieve utilise la borne réglée selon la taille de l'entier (voir
+   trial_division_tuning.h).
 */
 static const unsigned int NB_PRIMES_IN_SIEVE = 6542;
 /* Borne maximale utilisée lors de la phase de crible pour décrêter qu'un
@@ -171,6 +216,18 @@ static const unsigned int PRIMES_SIZE = (NB_PRIMES_IN_SIEVE > NB_PRIMES_TO_CHECK
 */
 static const unsigned int SMOOTH_PART_SIZE_LIMIT = 128;
 
+/* Nombre de candidats m = m0 + 6k examinés par fenêtre du crible
+   incrémental (voir plus haut) */
+static const unsigned int INCREMENTAL_SIEVE_LENGTH = 8192;
+/* Nombre maximal de fenêtres parcourues à partir d'un même tirage */
+static const unsigned int INCREMENTAL_SIEVE_MAX_WINDOWS = 64;
+
+/* Nombre de candidats tirés et criblés ensemble (isPrime_SieveBatch) par
+   la méthode de Fouque-Tibouchi. Le crible vectoriel regroupe les
+   survivants de chaque phase en lots complets : il lui faut plusieurs
+   dizaines de candidats. */
+static const unsigned int SIEVE_BATCH_CANDIDATES = 32;
+
 /* Assurons-nous que GMP n'a pas été compilé de façon exotique */
 #if GMP_NAIL_BITS != 0
 #error GMP nails are not supported.
@@ -199,42 +256,66 @@ static const unsigned int PRIMES_PRODUCTS_SIZE = 1576;
 #endif
 #endif /* GMP_NUMB_BITS */
 
-/* Une routine de multiplication. On pourrait utiliser __int64/__int128.
-   Tiré de GMP/FLINT (longlong.h). */
-#if (GMP_LIMB_BITS == 32) && (defined (__i386__) || defined (__i486__) || defined(__amd64__))
-#define umul_ppmm(w1, w0, u, v) \
-  __asm__ ("mull %3"							\
-	   : "=a" (w0), "=d" (w1)					\
-	   : "%0" ((mp_limb_t)(u)), "rm" ((mp_limb_t)(v)))
-#else
-#if (GMP_LIMB_BITS == 64) && defined (__amd64__)
-#define umul_ppmm(w1, w0, u, v) \
-  __asm__ ("mulq %3"							\
-	   : "=a" (w0), "=d" (w1)					\
-	   : "%0" ((mp_limb_t)(u)), "rm" ((mp_limb_t)(v)))
-#else
-#error Architecture not supported.
-#endif
-#endif /* architecture */
-
 /* Paramètres "l" de l'algorithme 2 de Fouque-Tibouchi: taille des aléas
    générés pendant la deuxième phase */
 static const unsigned int FT_ALGO_PARAM_L = GMP_LIMB_BITS;
 
-/* Variables globales (initialisées par initPrimes) */
-/****************************************************/
-
 /* Tableaux contenant les premiers utiles a la smoothness (pour
    eviter des attaques), mais également à la vitesse de génération
    (trial division avec les petits nombres premiers, pour éviter une
-   expo pour rien) */
-static mp_limb_t primes[PRIMES_SIZE];
-/* Ainsi que leurs produits et les indices des premiers correspondants */
-static unsigned int primesProductsIndices[PRIMES_PRODUCTS_SIZE][2];
-static mp_limb_t primesProducts[PRIMES_PRODUCTS_SIZE];
+   expo pour rien), ainsi que leurs produits et les indices des
+   premiers correspondants. Ils sont générés une fois pour toutes
+   (prime_tables.h) plutôt que recalculés au démarrage de chaque
+   processus. */
+#include "prime_tables.h"
+
+/* Vérification à la compilation de la taille des tableaux générés */
+typedef char primesSizeCheck[(sizeof (primes) / sizeof (primes[0]) == PRIMES_SIZE) ? 1 : -1];
+typedef char primesProductsSizeCheck[(sizeof (primesProducts) / sizeof (primesProducts[0])
+				      == PRIMES_PRODUCTS_SIZE) ? 1 : -1];
+typedef char primesProductsIndicesSizeCheck[(sizeof (primesProductsIndices)
+					     / sizeof (primesProductsIndices[0])
+					     == PRIMES_PRODUCTS_SIZE) ? 1 : -1];
+
+/* Constantes de division par primes[i] (voir sieve_kernel.h), calculées
+   une seule fois au premier usage (voir ensurePrimesInverses). Elles
+   remplacent les divisions courtes des restes par les premiers. 2 n'étant
+   pas inversible, primesInv[0] n'est pas défini. */
+static mp_limb_t primesInv[PRIMES_SIZE];
+static mp_limb_t primesLim[PRIMES_SIZE];
+static pthread_once_t primesInvOnce = PTHREAD_ONCE_INIT;
+
+/* Variables globales (initialisées par initPrimes) */
+/****************************************************/
+
+/* Initialisation unique de GMP_state (voir initGMPState) */
+static pthread_once_t GMP_stateOnce = PTHREAD_ONCE_INIT;
+static const char* GMP_stateError = NULL;
 
-/* Générateur d'aléa non sensible utilisé pour les tests de Miller-Rabbin */
+/* Générateur d'aléa non sensible, initialisé par initPrimes, dont sont
+   tirées les graines des contextes de test de primalité par défaut
+   (un par fil d'exécution, voir threadPrimeContext). GMP_state_lock
+   protège GMP_state ; seedGeneration, incrémenté à chaque nouvelle
+   graine, est lu sans verrou (accès atomiques). */
 static gmp_randstate_t GMP_state;
+static pthread_mutex_t GMP_state_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long seedGeneration = 0;
+
+/* Paramètres de Fouque-Tibouchi déjà calculés (voir getParamFT), qui
+   ne dépendent que de la taille des premiers générés. Une entrée
+   publiée n'est plus modifiée et reste valide jusqu'à la fin du
+   processus : FTParamsLock ne protège que la recherche et l'ajout. */
+static const unsigned int FT_PARAMS_CACHE_SIZE = 16;
+typedef struct {
+  size_t k;
+  mpz_t m;
+  mp_limb_t largestPrime;
+  unsigned int nPrimes;  /* m = primes[0] * ... * primes[nPrimes-1] */
+  mpz_t* crt;            /* crt[i] = 1 mod primes[i], 0 mod les autres premiers de m */
+} ftParams;
+static ftParams FTParamsCache[FT_PARAMS_CACHE_SIZE];
+static unsigned int FTParamsCount = 0;
+static pthread_mutex_t FTParamsLock = PTHREAD_MUTEX_INITIALIZER;
 
 //Barak_Halevi_PRNG* rabbinMillerPRNG;
 
@@ -261,35 +342,37 @@ bool isSmallPrime_Naive (unsigned long int t)
 }
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-// Test de (vraie) primalité pour un petit entier par divisibilité par
-// les petits premiers précalculés.
-// Ce test est limité par le nombre de nombres premiers précalculés.
+// Initialisation de GMP_state, exécutée une seule fois (pthread_once). Une
+// erreur est signalée dans GMP_stateError, l'exception étant levée par
+// l'appelant.
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-static bool isSmallPrime_Sieve (unsigned long int t, int bound=0)
-{
-  unsigned long int q, r, d;
+static void initGMPState () {
+  if (gmp_randinit_lc_2exp_size (GMP_state, GMP_RANDOM_INITIALIZER_SIZE) == 0)
+    GMP_stateError = "GMP_RANDOM_INITIALIZER_SIZE est trop grand";
+}
 
-  if (bound == 0)
-    bound = PRIMES_SIZE;
 
-  if (t < 3 || (t & 1) == 0)
-    return t == 2;
+static void ensureGMPState () {
+  pthread_once (&GMP_stateOnce, initGMPState);
+  if (GMP_stateError != NULL)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, GMP_stateError);
+}
 
-  r = 1;
-  for (int i = 1; i < bound; i++)
-    {
-      d = primes[i];
-      q = t / d;
-      r = t - q * d;
-      if (r == 0)
-        return false;
-      if (q < d)
-        return true;
-    }
 
-  throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Pas assez de nombres premiers précalculés");
+static void initPrimesInverses () {
+  primesLim[0] = smallPrimeLimit (primes[0]);
+  for (unsigned int i = 1; i < PRIMES_SIZE; i++) {
+    primesInv[i] = smallPrimeInverse (primes[i]);
+    primesLim[i] = smallPrimeLimit (primes[i]);
+  }
+}
+
+
+static void ensurePrimesInverses () {
+  pthread_once (&primesInvOnce, initPrimesInverses);
 }
 
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Génération des variables globales (à appeler avant toute utilisation des
 // fonctions sur les nombres premiers, excepté les deux ci-dessus !)
@@ -297,85 +380,308 @@ static bool isSmallPrime_Sieve (unsigned long int t, int bound=0)
 // générateur d'aléa servant aux tests de primalité probabiliste est rafraîchie
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 void initPrimes (PRNG& rng) {
-  static bool primesInitialized = false;
-
-  if (!primesInitialized) {
-    if (gmp_randinit_lc_2exp_size (GMP_state, GMP_RANDOM_INITIALIZER_SIZE) == 0)
-      throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "GMP_RANDOM_INITIALIZER_SIZE est trop grand");
-  }
+  ensureGMPState ();
 
   // Initialisation du générateur d'aléa nécessaire au bon
   // fonctionnement de Miller Rabbin
   mpz_t seed;
   rng.getRandomInt (seed, GMP_RANDOM_SEED_SIZE, true);
+  pthread_mutex_lock (&GMP_state_lock);
   gmp_randseed (GMP_state, seed);
+  __sync_fetch_and_add (&seedGeneration, 1);
+  pthread_mutex_unlock (&GMP_state_lock);
   mpz_shred (seed);
+}
 
-  if (primesInitialized) return;
-
-  // Initialisation du tableau des nombres premiers
-  unsigned int i = 0;            // i contient le nombre de premiers déjà stockés
-  unsigned int j = 0;            //
-  unsigned int tested_int = 5;   // il s'agit du prochain nombre à tester
-  unsigned int delta = 2;
-  unsigned int next;
-
-  if (PRIMES_SIZE < 2) // Code non atteignable ; TODO : le mettre en #if
-    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "PRIMES_SIZE est trop petit");
-
-  primes[i++] = 2;
-  primes[i++] = 3;
-
-  while (i < PRIMES_SIZE) {
-    bool isPrime = true;
-
-    // On crible avec les entiers premiers déjà trouvés
-    isPrime = isSmallPrime_Sieve(tested_int);
-
-    if (isPrime)
-      primes[i++] = tested_int;
-
-    next = tested_int + delta;
-    if (next < tested_int)
-      throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "PRIMES_SIZE est trop grand");
-    tested_int = next;
-
-    // Optimisation simple (pour éviter les multiples de 3)
-    // Lorsque tested_int = 2 [3], delta vaut 2
-    //      si tested_int = 1 [3], delta vaut 4
-    delta = 6-delta;
-  }
-
-  // Calcul des produits de nombres premiers à partir de PP_FIRST_OMITTED
-  mp_limb_t p1, p0, p, q;
-  for (i = 0; primes[i] < PP_FIRST_OMITTED; i++)
-    ;
-  for (j = 0; j < PRIMES_PRODUCTS_SIZE; j++) {
-    p = 1;
-    primesProductsIndices[j][0] = i;
-    for (; i < PRIMES_SIZE; i++) {
-      q = primes[i];
-      umul_ppmm(p1, p0, p, q);
-      if (p1 != 0) {
-          break;
-      }
-      else {
-          p = p0;
-      }
-    }
-    primesProductsIndices[j][1] = i;
-    primesProducts[j] = p;
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Contextes de test de primalité
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/* Espace de travail de Miller-Rabin, rattaché à un PrimeContext et
+   réutilisé d'un candidat à l'autre : les entiers sont dimensionnés
+   une fois pour toutes (puis effacés sans être libérés), et n-1 = 2^s r
+   n'est décomposé qu'une fois par candidat, quel que soit le nombre de
+   témoins essayés.
+   L'exponentiation a^r mod n reste confiée à mpz_powm : une version
+   bâtie sur montgomery.h (précalculs du candidat et recodage de r
+   compris, comme ils le seraient à chaque candidat) a été mesurée
+   puis écartée, car elle n'est jamais plus rapide. Minimum de 5
+   passes sur 16 nombres premiers par taille, un cœur :
+     512 bits  0,079 ms contre 0,106 ms (+35 %)
+     768 bits  0,222 ms contre 0,225 ms (+1 %)
+    1024 bits  0,403 ms contre 0,577 ms (+43 %)
+    1536 bits  1,581 ms contre 1,871 ms (+18 %)
+    2048 bits  3,451 ms contre 3,438 ms (0 %) */
+class MillerRabinWorkspace {
+ public:
+  MillerRabinWorkspace ();
+  ~MillerRabinWorkspace ();
+
+  /* Précalculs associés au candidat n impair. Retourne false si n-1
+     est nul. */
+  bool prepare (const mpz_t n);
+
+  /* Test fort de Miller-Rabin de n (préparé) en base a : retourne
+     false si a prouve que n est composé */
+  bool witness (const mpz_t n, const mpz_t a);
+
+  void wipe ();
+
+  mpz_t nMinus1, nMinus3, r, a, y, t;
+  unsigned long s;
+
+ private:
+  MillerRabinWorkspace (const MillerRabinWorkspace&);
+  MillerRabinWorkspace operator= (const MillerRabinWorkspace&);
+};
+
+
+MillerRabinWorkspace::MillerRabinWorkspace () : s (0) {
+  mpz_init (nMinus1);
+  mpz_init (nMinus3);
+  mpz_init (r);
+  mpz_init (a);
+  mpz_init (y);
+  mpz_init (t);
+}
+
+
+MillerRabinWorkspace::~MillerRabinWorkspace () {
+  mpz_shred (nMinus1);
+  mpz_shred (nMinus3);
+  mpz_shred (r);
+  mpz_shred (a);
+  mpz_shred (y);
+  mpz_shred (t);
+}
+
+
+bool MillerRabinWorkspace::prepare (const mpz_t n) {
+  mp_bitcnt_t bits = mpz_sizeinbase (n, 2);
+
+  // Dimensionnement : t reçoit le carré de y
+  if ((mp_bitcnt_t) y->_mp_alloc * GMP_NUMB_BITS < bits + GMP_NUMB_BITS)
+    mpz_realloc2 (y, bits + GMP_NUMB_BITS);
+  if ((mp_bitcnt_t) t->_mp_alloc * GMP_NUMB_BITS < 2 * bits + GMP_NUMB_BITS)
+    mpz_realloc2 (t, 2 * bits + GMP_NUMB_BITS);
+
+  mpz_sub_ui(nMinus3, n, 3);
+  mpz_sub_ui(nMinus1, n, 1);
+
+  // TODO: Impossible ! A documenter...
+  // Si n-1 est nul, c'est que n vaut 1, qui n'est pas premier
+  if (mpz_sgn (nMinus1) == 0)
+    return false;
+
+  // r et s vérifient n-1 = 2^s * r where r is odd
+  s = mpz_scan1(nMinus1, 0UL);
+  mpz_tdiv_q_2exp(r, nMinus1, s);
+
+  return true;
+}
+
+
+bool MillerRabinWorkspace::witness (const mpz_t n, const mpz_t base) {
+  // y = a^r [n]
+  mpz_powm(y, base, r, n);
+
+  if (mpz_cmp_ui(y, 1) == 0 || mpz_cmp(y, nMinus1) == 0)
+    return true;
+
+  // y = a^(r * 2^j) pour j < s ; le carré suivant (j = s) serait a^(n-1),
+  // qui ne peut valoir 1 si aucune valeur précédente ne vaut -1
+  for (unsigned long j=1; j < s; j++) {
+    mpz_mul(t, y, y);
+    mpz_tdiv_r(y, t, n);
+
+    if (mpz_cmp(y, nMinus1) == 0)
+      return true;
+    if (mpz_cmp_ui(y, 1) == 0)
+      return false;
+  }
+
+  return false;
+}
+
+
+void MillerRabinWorkspace::wipe () {
+  // Effacement sans libération, l'espace de travail étant réutilisé
+  mpz_wipe (nMinus1);
+  mpz_wipe (nMinus3);
+  mpz_wipe (r);
+  mpz_wipe (a);
+  mpz_wipe (y);
+  mpz_wipe (t);
+  s = 0;
+}
+
+
+void PrimeContext::init () {
+  if (gmp_randinit_lc_2exp_size (_witnessState, GMP_RANDOM_INITIALIZER_SIZE) == 0)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "GMP_RANDOM_INITIALIZER_SIZE est trop grand");
+
+  _mr = new MillerRabinWorkspace ();
+  _seedGeneration = 0;
+
+  // Les tests en base 2, peu coûteux, écartent la plupart des candidats
+  // composés avant les tours à bases aléatoires : la plupart des m
+  // premiers sont rejetés parce que n = 2m+1 est composé
+  static const rsa_factor_stage_t defaultStages[] = {
+    RSA_FACTOR_STAGE_MR2_M, RSA_FACTOR_STAGE_MR2_N,
+    RSA_FACTOR_STAGE_MR_M, RSA_FACTOR_STAGE_MR_N,
+    RSA_FACTOR_STAGE_LUCAS_M, RSA_FACTOR_STAGE_LUCAS_N,
+    RSA_FACTOR_STAGE_SMOOTHNESS
+  };
+  setRSAFactorPipeline (defaultStages, sizeof (defaultStages) / sizeof (defaultStages[0]));
+  resetRSAFactorStats ();
+  _assurance = PRIME_ASSURANCE_CURRENT;
+}
+
+
+void PrimeContext::seed (mpz_t seed) {
+  gmp_randseed (_witnessState, seed);
+  mpz_shred (seed);
+}
+
+
+PrimeContext::PrimeContext (PRNG& rng) {
+  init ();
+  reseed (rng);
+}
+
+
+PrimeContext::PrimeContext () {
+  mpz_t s;
+  unsigned long generation;
+
+  ensureGMPState ();
+
+  mpz_init (s);
+  pthread_mutex_lock (&GMP_state_lock);
+  generation = __sync_fetch_and_add (&seedGeneration, 0);
+  if (generation != 0)
+    mpz_urandomb (s, GMP_state, GMP_RANDOM_SEED_SIZE);
+  pthread_mutex_unlock (&GMP_state_lock);
+
+  if (generation == 0) {
+    mpz_clear (s);
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "initPrimes n'a pas été appelée");
+  }
+
+  init ();
+  seed (s);
+  _seedGeneration = generation;
+}
+
+
+PrimeContext::~PrimeContext () {
+  gmp_randclear (_witnessState);
+  delete _mr;
+}
+
+
+void PrimeContext::reseed (PRNG& rng) {
+  mpz_t s;
+  rng.getRandomInt (s, GMP_RANDOM_SEED_SIZE, true);
+  seed (s);
+}
+
+
+bool PrimeContext::setRSAFactorPipeline (const rsa_factor_stage_t* order, unsigned int nStages) {
+  bool present[RSA_FACTOR_NB_STAGES];
+
+  if (order == NULL || nStages > RSA_FACTOR_NB_STAGES)
+    return false;
+
+  for (unsigned int i = 0; i < RSA_FACTOR_NB_STAGES; i++)
+    present[i] = false;
+  for (unsigned int i = 0; i < nStages; i++) {
+    if (order[i] < 0 || order[i] >= RSA_FACTOR_NB_STAGES || present[order[i]])
+      return false;
+    present[order[i]] = true;
   }
 
-  primesInitialized = true;
+  // Seuls les tests en base 2 sont facultatifs
+  for (unsigned int i = 0; i < RSA_FACTOR_NB_STAGES; i++)
+    if (!present[i] && i != RSA_FACTOR_STAGE_MR2_M && i != RSA_FACTOR_STAGE_MR2_N)
+      return false;
+
+  for (unsigned int i = 0; i < nStages; i++)
+    _stages[i] = order[i];
+  _nStages = nStages;
+
+  return true;
+}
+
+
+void PrimeContext::setAssurance (prime_assurance_t a) {
+  if (a < PRIME_ASSURANCE_CURRENT || a >= PRIME_ASSURANCE_NB_PROFILES)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Profil d'assurance inconnu");
+  _assurance = a;
+}
+
+
+void PrimeContext::resetRSAFactorStats () {
+  _stats.candidates = 0;
+  for (unsigned int i = 0; i < RSA_FACTOR_NB_STAGES; i++)
+    _stats.rejected[i] = 0;
+  _stats.accepted = 0;
+}
+
+
+static pthread_key_t primeContextKey;
+static pthread_once_t primeContextKeyOnce = PTHREAD_ONCE_INIT;
+static bool primeContextKeyOK = false;
+
+static void deletePrimeContext (void* ctx) {
+  delete (PrimeContext*) ctx;
+}
+
+static void createPrimeContextKey () {
+  primeContextKeyOK = (pthread_key_create (&primeContextKey, deletePrimeContext) == 0);
+}
+
+
+// Contexte du fil d'exécution appelant, créé au premier appel (et
+// libéré à la fin du fil). Il est réinitialisé si initPrimes a fourni
+// une nouvelle graine depuis.
+PrimeContext& threadPrimeContext () {
+  pthread_once (&primeContextKeyOnce, createPrimeContextKey);
+  if (!primeContextKeyOK)
+    throw UnexpectedError ("Impossible de créer la clé des contextes de test de primalité");
+
+  PrimeContext* ctx = (PrimeContext*) pthread_getspecific (primeContextKey);
+
+  if (ctx != NULL) {
+    if (ctx->_seedGeneration == __sync_fetch_and_add (&seedGeneration, 0))
+      return *ctx;
+    pthread_setspecific (primeContextKey, NULL);
+    delete ctx;
+  }
+
+  ctx = new PrimeContext ();
+  if (pthread_setspecific (primeContextKey, ctx) != 0) {
+    delete ctx;
+    throw UnexpectedError ("Impossible d'associer le contexte de test de primalité au fil d'exécution");
+  }
+
+  return *ctx;
 }
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Test de pseudo-primalité (ou plutôt de composition) pour un entier
 // multiprécision par divisibilité par des petits entiers premiers.
 // On suppose que l'entier est impair, voire plus.
+// Sans borne explicite, la borne et la méthode dépendent de la taille de
+// n (voir trial_division.cpp) ; sinon, on divise par les premiers
+// inférieurs à bound (au moins).
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool isPrime_Sieve (mpz_t n, size_t bound) {
+  if (bound == 0)
+    return isPrime_TrialDivision (n);
+
+  ensurePrimesInverses ();
+
   /* If n is even, it is not a prime.  */
   if ((mpz_get_ui (n) & 1) == 0)
     return false;
@@ -414,10 +720,6 @@ bool isPrime_Sieve (mpz_t n, size_t bound) {
   mp_limb_t r;
   unsigned int i, j;
 
-  if (bound == 0)
-    //bound = mpz_sizeinbase(n, 2);
-    bound = primes[NB_PRIMES_IN_SIEVE-1];
-
   if (bound > primes[PRIMES_SIZE-1])
       throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Pas assez de nombres premiers précalculés");
 
@@ -433,8 +735,8 @@ bool isPrime_Sieve (mpz_t n, size_t bound) {
     r = mpn_mod_1((n)->_mp_d, (mp_size_t) ((n)->_mp_size), (mp_limb_t) primesProducts[i]);
     /* r = mpz_fdiv_ui(n, primesProducts[i]); */
     for (; j < primesProductsIndices[i][1]; j++){
-      /* Check for factors for each prime by performing a bunch of small divisions */
-      if (r % primes[j] == 0) {
+      /* Check for factors for each prime, multiplying by its inverse */
+      if (smallPrimeDivides (r, primesInv[j], primesLim[j])) {
         return false;
       }
     }
@@ -467,156 +769,311 @@ bool isPrime_Fermat (mpz_t n) {
   return (compare != 0);
 }
 
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Profils d'assurance
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static const char* primeAssuranceNames[PRIME_ASSURANCE_NB_PROFILES] = {
+  "current", "FIPS-186-5-with-Lucas", "paranoid"
+};
+
+
+unsigned int primeAssuranceRounds (prime_assurance_t a, size_t nBits) {
+  switch (a) {
+  case PRIME_ASSURANCE_CURRENT:
+    return nb_iter_MR (nBits);
+  case PRIME_ASSURANCE_FIPS186_5:
+    return nb_iter_MR_Lucas (nBits);
+  case PRIME_ASSURANCE_PARANOID:
+    return 64;
+  default:
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Profil d'assurance inconnu");
+  }
+}
+
+
+const char* primeAssuranceName (prime_assurance_t a) {
+  if (a < PRIME_ASSURANCE_CURRENT || a >= PRIME_ASSURANCE_NB_PROFILES)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Profil d'assurance inconnu");
+  return primeAssuranceNames[a];
+}
+
+
+bool primeAssuranceFromName (const char* name, prime_assurance_t* a) {
+  for (int i = 0; i < PRIME_ASSURANCE_NB_PROFILES; i++)
+    if (strcmp (name, primeAssuranceNames[i]) == 0) {
+      *a = (prime_assurance_t) i;
+      return true;
+    }
+  return false;
+}
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Test de pseudo-primalité (ou plutôt de composition) de Miller-Rabin
 // On suppose n impair, voire n > 3
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool isPrime_MillerRabin (mpz_t n, int iter) {
-  mpz_t r, n_minus_3, n_minus_1, a, y;
-  unsigned long s, j;
+  return isPrime_MillerRabin (n, iter, threadPrimeContext ());
+}
+
+bool isPrime_MillerRabin (mpz_t n, int iter, PrimeContext& ctx) {
+  MillerRabinWorkspace& ws = *(ctx._mr);
   bool res = false;
   size_t k;
 
   k = mpz_sizeinbase(n, 2);
   if (iter == 0)
-      iter = nb_iter_MR(k);
-
-  mpz_init(a);
-  mpz_init(r);
-  mpz_init(y);
-  mpz_init(n_minus_3);
-  mpz_init(n_minus_1);
-
-  mpz_sub_ui(n_minus_3, n, 3);
-  mpz_sub_ui(n_minus_1, n, 1);
-
-  // r et s vérifient n-1 = 2^s * r where r is odd
-  s = mpz_scan1(n_minus_1, 0UL);
-  mpz_tdiv_q_2exp(r, n_minus_1, s);
+      iter = (int) primeAssuranceRounds (ctx._assurance, k);
 
-  // TODO: Impossible ! A documenter...
-  // Si r vaut 0, c'est que n-1 est impair, donc que n vaut 2^s avec s > 1
-  // Dans ce cas, il est donc composé
-  if (mpz_cmp_ui(r, 0) == 0)
+  // Si n vaut 1, n-1 est nul : n n'est pas premier
+  if (!ws.prepare (n))
     goto free;
 
   // Algorithme inspiré de la figure 7.3 P.188 du livre de Serge Vaudenay
   // A Classical Introduction to Cryptography
   // The number of iterations is computed by a function in nb_iter_MR.h
   for(int i=0; i < iter; i++) {
-    mpz_urandomm(a, GMP_state, n_minus_3);
-    mpz_add_ui(a, a, 2);
-
-    // y = a^r [n]
-    mpz_powm(y, a, r, n);
-
-    if (mpz_cmp_ui(y, 1) != 0) {
-      for (j=1; mpz_cmp(y, n_minus_1) != 0; j++) {
-	// y = a^(r * 2^j)
-	mpz_powm_ui(y,y,2,n);
+    mpz_urandomm(ws.a, ctx._witnessState, ws.nMinus3);
+    mpz_add_ui(ws.a, ws.a, 2);
 
-	if (j == s || mpz_cmp_ui(y,1) == 0)
-	  goto free;
-      }
-    }
+    if (!ws.witness (n, ws.a))
+      goto free;
   }
 
   res = true;
 
  free:
-  mpz_shred(n_minus_1);
-  mpz_shred(n_minus_3);
-  mpz_shred(y);
-  mpz_shred(r);
-  mpz_shred (a);
+  ws.wipe ();
 
   return res;
 }
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-// Test de pseudo-primalité (ou plutôt de composition) de Lucas (FIPS 186-4 C.3.3)
+// Test de pseudo-primalité fort de Lucas
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-bool isPrime_Lucas (mpz_t n) {
-  mpz_t m, u, v, u1, v1;
-  mpz_t x;
-  // D fits in a long
-  long D;
-  int sign_d;
-  size_t r, i;
-  int compare;
+/* Test fort de Lucas (Baillie et Wagstaff, "Lucas pseudoprimes", 1980)
+   avec les paramètres de Selfridge (méthode A) : D est le premier terme
+   de la suite 5, -7, 9, -11, ... tel que (D/n) = -1, P = 1 et
+   Q = (1 - D) / 4. En écrivant n + 1 = d 2^s, n est un pseudo-premier
+   fort si U_d = 0 mod n, ou si V_{d 2^r} = 0 mod n pour un r < s.
+   Associé à un test de Miller-Rabin (en particulier en base 2), il
+   forme le test BPSW, pour lequel aucun pseudo-premier n'est connu.
+   On vérifie de plus que V_{n+1} = 2Q mod n (Baillie, Fiori et
+   Wagstaff, "Strengthening the Baillie-PSW primality test", 2021) :
+   V_{n+1} est le dernier terme calculé.
+
+   Seule la suite V est calculée, par une échelle sur (V_k, V_{k+1}, Q^k) :
+     V_2k   = V_k^2 - 2 Q^k
+     V_2k+1 = V_k V_{k+1} - P Q^k
+     Q^2k   = (Q^k)^2
+   U_d se déduisant de D U_d = 2 V_{d+1} - P V_d. Pour Q = -1 (D = 5,
+   soit un candidat sur deux), Q^k vaut +-1 et l'élévation au carré de
+   Q^k disparaît. Les calculs se font en représentation de Montgomery
+   (montgomery.h) sur des entiers complètement réduits (< n) : chaque
+   produit est suivi d'une réduction de Montgomery, et non d'une
+   division d'un entier de taille double par n comme dans la version
+   précédente (FIPS 186-4 C.3.3, qui calculait U et V sur tous les bits
+   de n + 1). Les multiplications par les petites constantes P, Q et 2
+   sont des opérations linéaires.
+
+   La recherche de D ne coûte qu'une réduction de n modulo un petit
+   entier par essai (moins de deux essais en moyenne), négligeable
+   devant l'échelle : les restes du crible n'y sont pas réutilisés. */
+
+// Opérations modulo m (sur n limbes) pour des opérandes < m
+static inline void modAdd (mp_limb_t* rp, const mp_limb_t* ap, const mp_limb_t* bp,
+			   const mp_limb_t* mp, mp_size_t n) {
+  if (mpn_add_n (rp, ap, bp, n) || mpn_cmp (rp, mp, n) >= 0)
+    mpn_sub_n (rp, rp, mp, n);
+}
 
-  if (mpz_perfect_square_p (n)) {
-    return false;
+static inline void modSub (mp_limb_t* rp, const mp_limb_t* ap, const mp_limb_t* bp,
+			   const mp_limb_t* mp, mp_size_t n) {
+  if (mpn_sub_n (rp, ap, bp, n))
+    mpn_add_n (rp, rp, mp, n);
+}
+
+// Le produit de Montgomery d'opérandes < m est < 2m
+static inline void modReduce (mp_limb_t* rp, const mp_limb_t* mp, mp_size_t n) {
+  if (mpn_cmp (rp, mp, n) >= 0)
+    mpn_sub_n (rp, rp, mp, n);
+}
+
+// rp = c ap mod m, pour une petite constante c. rp peut être égal à ap ;
+// tp est un espace de travail de n + 3 limbes.
+static void modMulSmall (mp_limb_t* rp, const mp_limb_t* ap, long c,
+			 const mp_limb_t* mp, mp_size_t n, mp_limb_t* tp) {
+  unsigned long absC = (c < 0) ? -(unsigned long) c : (unsigned long) c;
+
+  tp[n] = mpn_mul_1 (tp, ap, n, absC);
+  mpn_tdiv_qr (tp + n + 1, rp, 0, tp, n + 1, mp, n);
+  if (c < 0 && !mpn_zero_p (rp, n))
+    mpn_sub_n (rp, mp, rp, n);
+}
+
+
+static void shredLimbs (mp_limb_t* p, size_t n) {
+  volatile mp_limb_t* vp = p;
+  for (size_t i=0; i<n; i++)
+    vp[i] = 0;
+}
+
+
+/* Échelle de Lucas, tous les entiers étant en représentation de
+   Montgomery */
+typedef struct {
+  const MontgomeryModulus* mod;
+  long Q;
+  mp_limb_t* v;    // V_k
+  mp_limb_t* v1;   // V_{k+1}
+  mp_limb_t* qk;   // Q^k
+  mp_limb_t* t;
+  mp_limb_t* tp;   // 2n + 3 limbes
+} lucasLadder;
+
+
+// rp = ap^2 - 2 Q^k
+static void lucasSquare (lucasLadder& l, mp_limb_t* rp, const mp_limb_t* ap,
+			 const mp_limb_t* qk) {
+  const mp_size_t n = l.mod->size ();
+  const mp_limb_t* m = l.mod->limbs ();
+
+  l.mod->sqr (rp, ap, l.tp);
+  modReduce (rp, m, n);
+  modSub (rp, rp, qk, m, n);
+  modSub (rp, rp, qk, m, n);
+}
+
+
+// Q^k <- (Q^k)^2
+static void lucasSquareQk (lucasLadder& l) {
+  if (l.Q == -1)
+    mpn_copyi (l.qk, l.mod->one (), l.mod->size ());
+  else {
+    l.mod->sqr (l.qk, l.qk, l.tp);
+    modReduce (l.qk, l.mod->limbs (), l.mod->size ());
   }
-  D = 5;
-  while (mpz_si_kronecker (D, n) != -1) {
-    // produces the sequence (5, -7, 9, -11, ...)
-    // until (D / p) = -1
-    // groumpf, no mpz_add_si
-    if (D  > 0)
-      D = -(D + 2);
-    else
-      D = -(D - 2);
-  }
-  if (mpz_si_kronecker (D, n) == 0) {
-    return false;
+}
+
+
+// k <- 2k + bit
+static void lucasStep (lucasLadder& l, bool bit) {
+  const mp_size_t n = l.mod->size ();
+  const mp_limb_t* m = l.mod->limbs ();
+
+  // t = V_2k+1 = V_k V_{k+1} - P Q^k
+  l.mod->mul (l.t, l.v, l.v1, l.tp);
+  modReduce (l.t, m, n);
+  modSub (l.t, l.t, l.qk, m, n);
+
+  if (bit) {
+    // V_2k+2 = V_{k+1}^2 - 2 Q^{k+1}, Q^2k+1 = Q (Q^k)^2
+    modMulSmall (l.v, l.qk, l.Q, m, n, l.tp);
+    lucasSquare (l, l.v1, l.v1, l.v);
+    mpn_copyi (l.v, l.t, n);
+    lucasSquareQk (l);
+    modMulSmall (l.qk, l.qk, l.Q, m, n, l.tp);
+  } else {
+    lucasSquare (l, l.v, l.v, l.qk);
+    mpn_copyi (l.v1, l.t, n);
+    lucasSquareQk (l);
   }
-  // we may assume that the case jacobi (D, p) == 0 has already been
-  // detected by sieving or uniform generation
-  sign_d = D > 0 ? 1 : 0;
-  D = D > 0 ? D : -D;
+}
 
-  mpz_init (m);
-  mpz_init_set_ui (u, 1UL); mpz_init_set_ui (v, 1UL);
-  mpz_init (u1); mpz_init (v1);
-  mpz_init (x);
-  mpz_add_ui (m, n, 1UL);         // m  <- n+1
-  r = mpz_sizeinbase (m, 2) - 1;
-  for (i = r ; i > 0; i--) {
-    mpz_mul (u1, u, v);
-    mpz_mul_2exp (u1, u1, 1); // u1 <- 2 u·v
-    mpz_mul (v1, v, v);
-    mpz_mul (x, u, u);
-    // groumpf, there is no mpz_addmul_si
-    if (sign_d > 0) {
-      mpz_addmul_ui (v1, x, D);
-    } else {
-      mpz_submul_ui (v1, x, D);
-    } // v1 <- v² + D·u²
-    if (mpz_tstbit (m, i-1)) {
-      mpz_add (u, u1, v1); // u  <- u1 + v1
-      // groumpf again
-      if (sign_d > 0) {
-        mpz_addmul_ui (v1, u1, D);
-      } else {
-        mpz_submul_ui (v1, u1, D);
-      } // v  <- (v + D·u)/2
-    } else {
-      mpz_swap (u, u1);
-    }
-    mpz_swap (v, v1);
 
-    mpz_mod (u, u, n);
-    mpz_mod (v, v, n);
-  } // for (i)
+bool isPrime_Lucas (mpz_t n) {
+  long D = 5;
+  int jacobi;
 
-  compare = (!mpz_cmp_ui (u, 0UL));
+  if (mpz_cmp_ui (n, 2) <= 0 || mpz_even_p (n))
+    return (mpz_cmp_ui (n, 2) == 0);
 
-  mpz_shred(u1);
-  mpz_shred(v1);
-  mpz_shred(u);
-  mpz_shred(v);
-  mpz_shred(x);
+  /* Recherche de D. Si n est un carré, (D/n) ne vaut jamais -1 : on le
+     vérifie après deux essais infructueux. Un symbole de Jacobi nul
+     révèle le facteur |D|. */
+  for (unsigned int tries = 1; (jacobi = mpz_si_kronecker (D, n)) != -1; tries++) {
+    if (tries == 3 && mpz_perfect_square_p (n))
+      return false;
+    if (jacobi == 0)
+      return (mpz_cmp_ui (n, (unsigned long) labs (D)) == 0);
+    D = (D > 0) ? -(D + 2) : -(D - 2);
+  }
+
+  MontgomeryModulus mod;
+  mod.init (n);
+
+  const mp_size_t size = mod.size ();
+  const mp_limb_t* m = mod.limbs ();
+  const size_t nLimbs = 6 * size + 3;
+  mp_limb_t* buf = new mp_limb_t[nLimbs];
+  lucasLadder l;
+  mpz_t d;
+  mp_bitcnt_t s, r, bit;
+  bool strong;
+
+  l.mod = &mod;
+  l.Q = (1 - D) / 4;
+  l.v = buf;
+  l.v1 = l.v + size;
+  l.qk = l.v1 + size;
+  l.t = l.qk + size;
+  l.tp = l.t + size;
+
+  // n + 1 = d 2^s
+  mpz_init (d);
+  mpz_add_ui (d, n, 1);
+  s = mpz_scan1 (d, 0);
+  mpz_tdiv_q_2exp (d, d, s);
+
+  // k = 0 : V_0 = 2, V_1 = P = 1, Q^0 = 1
+  modAdd (l.v, mod.one (), mod.one (), m, size);
+  mpn_copyi (l.v1, mod.one (), size);
+  mpn_copyi (l.qk, mod.one (), size);
+  for (bit = mpz_sizeinbase (d, 2); bit-- > 0; )
+    lucasStep (l, mpz_tstbit (d, bit));
+
+  // U_d = 0 si 2 V_{d+1} = P V_d
+  modAdd (l.t, l.v1, l.v1, m, size);
+  strong = (mpn_cmp (l.t, l.v, size) == 0 || mpn_zero_p (l.v, size));
+
+  // V_{d 2^r} pour r = 1 ... s, le dernier étant V_{n+1}
+  for (r = 1; r <= s; r++) {
+    lucasSquare (l, l.v, l.v, l.qk);
+    if (r < s) {
+      strong = strong || mpn_zero_p (l.v, size);
+      lucasSquareQk (l);
+    }
+  }
+
+  modMulSmall (l.t, mod.one (), 2 * l.Q, m, size, l.tp);
+  strong = strong && (mpn_cmp (l.v, l.t, size) == 0);
+
+  shredLimbs (buf, nLimbs);
+  delete[] buf;
+  mpz_shred (d);
 
-  return compare;
+  return strong;
 }
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Test de pseudo-primalité (ou plutôt de composition) complet
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool isPrime(mpz_t n) {
+  return isPrime (n, threadPrimeContext ());
+}
+
+bool isPrime(mpz_t n, PrimeContext& ctx) {
   // TODO : Ajouter une preuve de primalité avec courbes elliptiques ?
-    return (isPrime_Sieve (n) && isPrime_MillerRabin (n) && isPrime_Lucas(n));
+    return (isPrime_Sieve (n) && isPrime_MillerRabin (n, 0, ctx) && isPrime_Lucas(n));
+}
+
+bool isPrime(mpz_t n, prime_assurance_t a) {
+  return isPrime (n, threadPrimeContext (), a);
+}
+
+bool isPrime(mpz_t n, PrimeContext& ctx, prime_assurance_t a) {
+  int iter = (int) primeAssuranceRounds (a, mpz_sizeinbase (n, 2));
+
+  return (isPrime_Sieve (n) && isPrime_MillerRabin (n, iter, ctx) && isPrime_Lucas(n));
 }
 
 /* Pour l'algorithme de Fouque-Tibouchi il est inutile de cribler par des
@@ -629,6 +1086,18 @@ static bool isPrimeFT(mpz_t n) {
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Test si un nombre est produit de petits facteurs premiers
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/* Vérifions que les divisions par les petits premiers n'ont pas trop
+   effrité le nombre testé : n = cofac * (petits facteurs premiers),
+   c'est-à-dire que la partie friable trouvée n'est pas trop grande.
+   On veut avoir cofac > n / 2^SMOOTH_PART_SIZE_LIMIT ; si le morceau
+   restant est assez grand, n n'est pas friable.
+   La comparaison est écrite sans soustraction : pour n de moins de
+   SMOOTH_PART_SIZE_LIMIT bits, la différence des tailles (size_t)
+   n'est pas représentable, et tout n était déclaré friable. */
+static bool smoothPartTooLarge(const mpz_t n, const mpz_t cofac) {
+  return mpz_sizeinbase(cofac, 2) + SMOOTH_PART_SIZE_LIMIT <= mpz_sizeinbase(n, 2);
+}
+
 bool isSmooth(mpz_t n) {
   /* A priori l'entier est friable. */
   bool res = true;
@@ -636,6 +1105,7 @@ bool isSmooth(mpz_t n) {
   /* Cette boucle égrenne les petits facteurs premiers en se servant
      des tableaux pré-calculés */
   mpz_t q, cofac;
+  ensurePrimesInverses ();
   mpz_init(cofac);
   mpz_init(q);
   /* Premier pair */
@@ -652,8 +1122,8 @@ bool isSmooth(mpz_t n) {
   r = mpn_mod_1((cofac)->_mp_d, (mp_size_t) ((cofac)->_mp_size), (mp_limb_t) PP);
   /* r = mpz_fdiv_ui(cofac, PP); */
   for (j = 1; j < primesProductsIndices[0][0]; j++)
-      /* Check for factors for each prime by performing a bunch of small divisions */
-      if (r % primes[j] == 0)
+      /* Check for factors for each prime, multiplying by its inverse */
+      if (smallPrimeDivides (r, primesInv[j], primesLim[j]))
         while (mpz_fdiv_q_ui(q, cofac, primes[j]) == 0)
           mpz_swap(cofac, q);
   }
@@ -669,8 +1139,8 @@ bool isSmooth(mpz_t n) {
     r = mpn_mod_1((cofac)->_mp_d, (mp_size_t) ((cofac)->_mp_size), (mp_limb_t) primesProducts[i]);
     /* r = mpz_fdiv_ui(cofac, primesProducts[i]); */
     for (; j < primesProductsIndices[i][1]; j++)
-      /* Check for factors for each prime by performing a bunch of small divisions */
-      if (r % primes[j] == 0)
+      /* Check for factors for each prime, multiplying by its inverse */
+      if (smallPrimeDivides (r, primesInv[j], primesLim[j]))
         while (mpz_fdiv_q_ui(q, cofac, primes[j]) == 0)
           mpz_swap(cofac, q);
   }
@@ -694,15 +1164,8 @@ bool isSmooth(mpz_t n) {
   }
   */
 
-  /* On a vérifié dans la boucle que le cofacteur n'était pas 1.
-     Vérifions à présent que les divisions précédentes n'ont pas trop
-     effrité le nombre testé : n = cofac * (petits facteurs premiers),
-     c'est-à-dire que la partie friable trouvée n'est pas trop grande.
-     On veut avoir cofac > n / 2^SMOOTH_PART_SIZE_LIMIT */
-  if (mpz_sizeinbase(cofac, 2) > mpz_sizeinbase(n, 2) - SMOOTH_PART_SIZE_LIMIT)
-    res = false;
-  /* Si le morceau restant est assez grand, on renvoie false (l'entier
-     n'est pas friable) */
+  /* On a vérifié dans la boucle que le cofacteur n'était pas 1. */
+  res = smoothPartTooLarge(n, cofac);
 
  free:
   mpz_shred(q);
@@ -711,6 +1174,35 @@ bool isSmooth(mpz_t n) {
   return res;
 }
 
+/* Même décision que isSmooth pour un lot d'entiers, les parties
+   friables étant calculées ensemble par smoothParts. Par défaut, la
+   borne est celle de isSmooth : NB_PRIMES_TO_CHECK_SMOOTHNESS premiers,
+   2 compris. */
+void isSmoothBatch(mpz_t* n, unsigned int count, bool* res, unsigned int nPrimes) {
+  if (nPrimes == 0)
+    nPrimes = NB_PRIMES_TO_CHECK_SMOOTHNESS - 1;
+
+  mpz_t* cofac = new mpz_t[count];
+  for (unsigned int i = 0; i < count; i++)
+    mpz_init(cofac[i]);
+
+  try {
+    smoothParts(cofac, n, count, nPrimes);
+  } catch (...) {
+    for (unsigned int i = 0; i < count; i++)
+      mpz_shred(cofac[i]);
+    delete[] cofac;
+    throw;
+  }
+
+  for (unsigned int i = 0; i < count; i++) {
+    mpz_divexact(cofac[i], n[i], cofac[i]);
+    res[i] = (mpz_cmp_ui(cofac[i], 1) == 0) || smoothPartTooLarge(n[i], cofac[i]);
+    mpz_shred(cofac[i]);
+  }
+  delete[] cofac;
+}
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Retourne un nombre n tel que
 //   * n a les bits nbits - 1 et nbits - 2 à 1 (i.e. 3 x 2^(nbits-2) <= n < 2^nbits)
@@ -721,150 +1213,884 @@ bool isSmooth(mpz_t n) {
 //   * m+1 n'est pas friable
 //   * m-1 n'est pas friable
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-void findRSAFactor (mpz_t n, const size_t nbits, PRNG& generator, bool init_mpz) {
+// La recherche est abandonnée (et la fonction retourne false) dès
+// que *stop devient non nul, si stop n'est pas NULL.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static bool stopRequested (int* stop) {
+  return stop != NULL && __sync_fetch_and_or (stop, 0) != 0;
+}
+
+
+// Tirage d'un candidat m de nbits-1 bits, égal à 5 modulo 6
+static void drawRSAFactorCandidate (mpz_t m, const size_t nbits, PRNG& generator) {
+  generator.getRandomInt (m, nbits-1, false);
+
+  // On force les 2 bits de poids fort à 1. Ceci nous assure que le
+  // module, produit des deux premiers, fera exactement la taille
+  // voulue.
+  mpz_setbit(m, nbits-2);
+  mpz_setbit(m, nbits-3);
+
+  // Un nombre premier supérieur à 6 est égal à 1 ou 5 modulo 6.
+  // Cependant, comme n = 2 * m + 1, si m = 1 [6], alors n = 3 [6]
+  // et n'est donc pas premier -> si on veut m et n=2m+1 premiers,
+  // on a donc nécessairement n = 5 [6]
+  mpz_add_ui(m, m, 5 - mpz_fdiv_ui(m,6));
+}
+
+
+/* Restes d'un candidat m modulo les petits premiers : res[i] = m mod
+   primes[i] pour 1 <= i < PRIMES_SIZE (une division multiprécision
+   par produit de premiers). Ces restes déterminent ceux de m-1, m+1,
+   n = 2m+1 et n+1 = 2m+2 : ils suffisent à cribler m et n, et à
+   trouver les petits premiers divisant m-1, m+1 et n+1.
+   Si sieve est vrai, le calcul est interrompu (et la fonction retourne
+   false) dès qu'un premier de la borne du crible divise m ou 2m+1 : le
+   résultat est alors celui de isPrime_Sieve (m) && isPrime_Sieve (2m+1),
+   pour m impair, avec une seule série de divisions multiprécision.
+   Les restes courts sont obtenus sans division (voir sieve_kernel.h). */
+static bool computeResidues (const mpz_t m, unsigned int* res, bool sieve) {
+  ensurePrimesInverses ();
+
+  const mp_limb_t* d = m->_mp_d;
+  mp_size_t size = m->_mp_size;
+  mp_limb_t rPP = mpn_mod_1 (d, size, PP);
+  mp_limb_t rProduct = 0;
+  unsigned int product = 0;
+
+  for (unsigned int i = 1; i < PRIMES_SIZE; i++) {
+    mp_limb_t p = primes[i];
+
+    if (p < PP_FIRST_OMITTED)
+      res[i] = (unsigned int) smallPrimeMod (rPP, p, primesLim[i]);
+    else {
+      if (product == 0 || i >= primesProductsIndices[product-1][1]) {
+	rProduct = mpn_mod_1 (d, size, primesProducts[product]);
+	product++;
+      }
+      res[i] = (unsigned int) smallPrimeMod (rProduct, p, primesLim[i]);
+    }
+
+    // 2 res[i] + 1 est impair et inférieur à 2p
+    if (sieve && i < NB_PRIMES_IN_SIEVE
+	&& (res[i] == 0 || 2 * res[i] + 1 == p))
+      return false;
+  }
+
+  return true;
+}
+
+
+// Équivalent de isSmooth (x) pour x = a m + b, les restes de m étant
+// connus : seuls les petits premiers divisant effectivement x donnent
+// lieu à des divisions multiprécision.
+// On suppose a <= 2 et |b| <= 2 : b mod p vaut alors b ou p + b, et
+// a res[i] + (b mod p) < 3p n'est divisible par p que s'il vaut 0, p ou 2p.
+static bool isSmoothFromResidues (const mpz_t x, const unsigned int* res,
+				  unsigned int a, int b, mpz_t cofac, mpz_t q) {
+  mpz_tdiv_q_2exp (cofac, x, mpz_scan1 (x, 0UL));
+
+  for (unsigned int i = 1; i < NB_PRIMES_TO_CHECK_SMOOTHNESS; i++) {
+    unsigned int p = (unsigned int) primes[i];
+    unsigned int bp = (b >= 0) ? (unsigned int) b : p - (unsigned int) (-b);
+    unsigned int r = a * res[i] + bp;
+    if (r == 0 || r == p || r == 2 * p)
+      while (mpz_fdiv_q_ui (q, cofac, p) == 0)
+	mpz_swap (cofac, q);
+  }
+
+  if (mpz_cmp_ui (cofac, 1) == 0)
+    return true;
+  return smoothPartTooLarge (x, cofac);
+}
+
+
+// Vérification que m-1, m+1 et n+1 ne sont pas friables, à partir des
+// restes de m
+static bool checkRSAFactorSmoothness (mpz_t n, mpz_t m, const unsigned int* res,
+				      mpz_t tmp, mpz_t cofac, mpz_t q) {
+  mpz_sub_ui(tmp, m, 1);
+  if (isSmoothFromResidues (tmp, res, 1, -1, cofac, q)) return false;
+
+  mpz_add_ui(tmp, m, 1);
+  if (isSmoothFromResidues (tmp, res, 1, 1, cofac, q)) return false;
+
+  mpz_add_ui(tmp, n, 1);
+  if (isSmoothFromResidues (tmp, res, 2, 2, cofac, q)) return false;
+
+  return true;
+}
+
+
+// Inverse de a modulo le premier p (a non multiple de p), par
+// l'algorithme d'Euclide étendu
+static mp_limb_t invertSmall (mp_limb_t a, mp_limb_t p) {
+  long r0 = (long) p, r1 = (long) (a % p);
+  long u0 = 0, u1 = 1;
+
+  while (r1 != 0) {
+    long q = r0 / r1;
+    long t = r0 - q * r1;
+    r0 = r1;
+    r1 = t;
+    t = u0 - q * u1;
+    u0 = u1;
+    u1 = t;
+  }
+
+  return (mp_limb_t) ((u0 < 0) ? u0 + (long) p : u0);
+}
+
+
+/* État du crible incrémental : restes du début de la fenêtre courante
+   m0 modulo les petits premiers (res), et pour chaque p = primes[i]
+   (i >= 2, 2 et 3 étant exclus par la forme m = 5 [6]), prochain
+   indice k de la fenêtre tel que p divise m0 + 6k (offM), ou
+   2 (m0 + 6k) + 1 (offN). Ces valeurs dépendent de m0 et sont donc
+   effacées après usage. */
+typedef struct {
+  unsigned int* res;
+  unsigned int* offM;
+  unsigned int* offN;
+  unsigned char* composite;
+} incrementalSieve;
+
+
+// Calcul des restes de m0 et des premiers indices
+static void incrementalSieveStart (incrementalSieve& sv, const mpz_t m0) {
+  computeResidues (m0, sv.res, false);
+
+  for (unsigned int i = 2; i < NB_PRIMES_IN_SIEVE; i++) {
+    mp_limb_t p = primes[i];
+    mp_limb_t r = sv.res[i];
+
+    // m0 + 6k = 0 [p]      <=> k = -r / 6 [p]
+    // 2m0 + 1 + 12k = 0 [p] <=> k = -(2r + 1) / 12 [p]
+    mp_limb_t inv6 = invertSmall (6, p);
+    mp_limb_t inv12 = (inv6 * ((p + 1) / 2)) % p;
+    sv.offM[i] = (unsigned int) (((p - r) * inv6) % p);
+    sv.offN[i] = (unsigned int) (((p - (2 * r + 1) % p) * inv12) % p);
+  }
+}
+
+
+// Crible de la fenêtre courante
+static void incrementalSieveWindow (incrementalSieve& sv) {
+  const unsigned int L = INCREMENTAL_SIEVE_LENGTH;
+  unsigned char* c = sv.composite;
+
+  for (unsigned int k = 0; k < L; k++)
+    c[k] = 0;
+
+  for (unsigned int i = 2; i < NB_PRIMES_IN_SIEVE; i++) {
+    unsigned int p = (unsigned int) primes[i];
+    unsigned int k;
+
+    for (k = sv.offM[i]; k < L; k += p)
+      c[k] = 1;
+    sv.offM[i] = k - L;
+
+    for (k = sv.offN[i]; k < L; k += p)
+      c[k] = 1;
+    sv.offN[i] = k - L;
+  }
+}
+
+
+// Passage des restes à la fenêtre suivante (m0 += 6L)
+static void incrementalSieveNext (incrementalSieve& sv) {
+  for (unsigned int i = 1; i < PRIMES_SIZE; i++) {
+    unsigned int p = (unsigned int) primes[i];
+    unsigned int r = sv.res[i]
+      + (unsigned int) smallPrimeMod (6 * INCREMENTAL_SIEVE_LENGTH, p, primesLim[i]);
+    sv.res[i] = (r >= p) ? r - p : r;
+  }
+}
+
+
+// Restes du candidat m0 + 6k
+static void incrementalSieveResidues (const incrementalSieve& sv, unsigned int k,
+				      unsigned int* res) {
+  for (unsigned int i = 1; i < PRIMES_SIZE; i++) {
+    unsigned int p = (unsigned int) primes[i];
+    unsigned int r = sv.res[i] + (unsigned int) smallPrimeMod (6 * k, p, primesLim[i]);
+    res[i] = (r >= p) ? r - p : r;
+  }
+}
+
+
+static void shredResidues (unsigned int* res, unsigned int len) {
+  volatile unsigned int* v = res;
+  for (unsigned int i = 0; i < len; i++)
+    v[i] = 0;
+}
+
+
+static void incrementalSieveShred (incrementalSieve& sv) {
+  volatile unsigned char* vc = sv.composite;
+
+  shredResidues (sv.res, PRIMES_SIZE);
+  shredResidues (sv.offM, NB_PRIMES_IN_SIEVE);
+  shredResidues (sv.offN, NB_PRIMES_IN_SIEVE);
+  for (unsigned int k = 0; k < INCREMENTAL_SIEVE_LENGTH; k++)
+    vc[k] = 0;
+
+  delete[] sv.res;
+  delete[] sv.offM;
+  delete[] sv.offN;
+  delete[] sv.composite;
+}
+
+
+/* Candidat soumis aux étapes de findRSAFactor : m, n = 2m+1 et restes
+   de m modulo les petits premiers. En mode incrémental, les restes ne
+   sont calculés (à partir de l'état du crible) que si le candidat
+   atteint l'étape de friabilité. */
+typedef struct {
+  mpz_ptr m, n;
+  unsigned int* res;
+  bool resReady;
+  const incrementalSieve* sv;
+  unsigned int k;
+} rsaFactorCandidate;
+
+
+/* Application à un candidat des étapes d'un PrimeContext, dans l'ordre
+   choisi, avec mise à jour des compteurs du contexte */
+class RSAFactorPipeline {
+ public:
+  RSAFactorPipeline (PrimeContext& ctx);
+  ~RSAFactorPipeline ();
+
+  /* Retourne true si le candidat passe toutes les étapes (n est alors
+     un facteur RSA) */
+  bool run (rsaFactorCandidate& c);
+
+  /* Ajout des compteurs de src à ceux de dst */
+  static void mergeStats (PrimeContext& dst, const PrimeContext& src);
+
+ private:
+  bool stage (rsa_factor_stage_t s, rsaFactorCandidate& c);
+  bool strongBase2 (const mpz_t x);
+
+  PrimeContext& _ctx;
+  mpz_t _tmp, _cofac, _q;
+
+  RSAFactorPipeline (const RSAFactorPipeline&);
+  RSAFactorPipeline operator= (const RSAFactorPipeline&);
+};
+
+
+RSAFactorPipeline::RSAFactorPipeline (PrimeContext& ctx) : _ctx (ctx) {
+  mpz_init (_tmp);
+  mpz_init (_cofac);
+  mpz_init (_q);
+}
+
+
+RSAFactorPipeline::~RSAFactorPipeline () {
+  mpz_shred (_tmp);
+  mpz_shred (_cofac);
+  mpz_shred (_q);
+}
+
+
+bool RSAFactorPipeline::strongBase2 (const mpz_t x) {
+  MillerRabinWorkspace& ws = *(_ctx._mr);
+  bool res = false;
+
+  if (ws.prepare (x)) {
+    mpz_set_ui (ws.a, 2);
+    res = ws.witness (x, ws.a);
+  }
+  ws.wipe ();
+
+  return res;
+}
+
+
+bool RSAFactorPipeline::stage (rsa_factor_stage_t s, rsaFactorCandidate& c) {
+  switch (s) {
+  case RSA_FACTOR_STAGE_MR2_M:
+    return strongBase2 (c.m);
+  case RSA_FACTOR_STAGE_MR2_N:
+    return strongBase2 (c.n);
+  case RSA_FACTOR_STAGE_MR_M:
+    return isPrime_MillerRabin (c.m, 0, _ctx);
+  case RSA_FACTOR_STAGE_MR_N:
+    return isPrime_MillerRabin (c.n, 0, _ctx);
+  case RSA_FACTOR_STAGE_LUCAS_M:
+    return isPrime_Lucas (c.m);
+  case RSA_FACTOR_STAGE_LUCAS_N:
+    return isPrime_Lucas (c.n);
+  case RSA_FACTOR_STAGE_SMOOTHNESS:
+    if (!c.resReady) {
+      incrementalSieveResidues (*(c.sv), c.k, c.res);
+      c.resReady = true;
+    }
+    return checkRSAFactorSmoothness (c.n, c.m, c.res, _tmp, _cofac, _q);
+  default:
+    throw UnexpectedError ("Étape de recherche de facteur RSA inconnue");
+  }
+}
+
+
+bool RSAFactorPipeline::run (rsaFactorCandidate& c) {
+  // Calcul de n=2m+1, candidat pour le résultat
+  mpz_mul_2exp(c.n, c.m, 1);
+  mpz_add_ui(c.n, c.n, 1);
+
+  _ctx._stats.candidates++;
+  for (unsigned int i = 0; i < _ctx._nStages; i++) {
+    if (!stage (_ctx._stages[i], c)) {
+      _ctx._stats.rejected[_ctx._stages[i]]++;
+      return false;
+    }
+  }
+  _ctx._stats.accepted++;
+
+  return true;
+}
+
+
+void RSAFactorPipeline::mergeStats (PrimeContext& dst, const PrimeContext& src) {
+  dst._stats.candidates += src._stats.candidates;
+  for (unsigned int i = 0; i < RSA_FACTOR_NB_STAGES; i++)
+    dst._stats.rejected[i] += src._stats.rejected[i];
+  dst._stats.accepted += src._stats.accepted;
+}
+
+
+static bool searchRSAFactor (mpz_t n, const size_t nbits, PRNG& generator,
+			     PrimeContext& ctx, rsa_factor_search_t mode, int* stop) {
   // On note n le facteur RSA et m = (n-1) / 2
   mpz_t m;
-  mpz_t tmp;
+  bool found = false;
+  // Restes de m modulo les petits premiers
+  unsigned int* res = new unsigned int[PRIMES_SIZE];
+  RSAFactorPipeline pipeline (ctx);
+  rsaFactorCandidate c;
 
-  if (init_mpz) mpz_init (n);
   mpz_init (m);
-  mpz_init (tmp);
-  while (true) {
-    generator.getRandomInt (m, nbits-1, false);
-
-    // On force les 2 bits de poids fort à 1. Ceci nous assure que le
-    // module, produit des deux premiers, fera exactement la taille
-    // voulue.
-    mpz_setbit(m, nbits-2);
-    mpz_setbit(m, nbits-3);
-
-    // Un nombre premier supérieur à 6 est égal à 1 ou 5 modulo 6.
-    // Cependant, comme n = 2 * m + 1, si m = 1 [6], alors n = 3 [6]
-    // et n'est donc pas premier -> si on veut m et n=2m+1 premiers,
-    // on a donc nécessairement n = 5 [6]
-    mpz_add_ui(m, m, 5 - mpz_fdiv_ui(m,6));
-
-    if (!isPrime_Sieve (m)) continue;
-
-    // Calcul et test de primalité de n=2m+1, candidat pour le résultat
-    mpz_mul_2exp(n, m, 1);
-    mpz_add_ui(n, n, 1);
-    if (!isPrime_Sieve (n)) continue;
-
-    // Test de primalité complets des deux nombres n et m
-    //if (!isPrime_Fermat (m)) continue;
-    //if (!isPrime_Fermat (n)) continue;
-    if (!isPrime_MillerRabin (m)) continue;
-    if (!isPrime_MillerRabin (n)) continue;
-    if (!isPrime_Lucas (m)) continue;
-    if (!isPrime_Lucas (n)) continue;
-
-    // Vérification que m-1 n'est pas friable
-    mpz_sub_ui(tmp, m, 1);
-    if (isSmooth (tmp)) continue;
-
-    // Vérification que m+1 n'est pas friable
-    mpz_add_ui(tmp, m, 1);
-    if (isSmooth (tmp)) continue;
-
-    // Vérification que n+1 n'est pas friable
-    mpz_add_ui(tmp, n, 1);
-    if (isSmooth (tmp)) continue;
+  c.m = m;
+  c.n = n;
+  c.res = res;
+  c.resReady = true;
+  c.sv = NULL;
+  c.k = 0;
+
+  if (mode == RSA_FACTOR_SEARCH_RANDOM) {
+    while (!stopRequested (stop)) {
+      drawRSAFactorCandidate (m, nbits, generator);
+
+      // Crible conjoint de m et n = 2m+1
+      if (!computeResidues (m, res, true)) continue;
+
+      if (pipeline.run (c)) {
+	found = true;
+	break;
+      }
+    }
+  } else {
+    // Crible incrémental (voir les considérations sur l'aléa en tête
+    // de fichier)
+    incrementalSieve sv;
+    mpz_t window;
+
+    sv.res = new unsigned int[PRIMES_SIZE];
+    sv.offM = new unsigned int[NB_PRIMES_IN_SIEVE];
+    sv.offN = new unsigned int[NB_PRIMES_IN_SIEVE];
+    sv.composite = new unsigned char[INCREMENTAL_SIEVE_LENGTH];
+    mpz_init (window);
+    c.sv = &sv;
+
+    while (!found && !stopRequested (stop)) {
+      drawRSAFactorCandidate (window, nbits, generator);
+      incrementalSieveStart (sv, window);
+
+      for (unsigned int w = 0; !found && w < INCREMENTAL_SIEVE_MAX_WINDOWS; w++) {
+	if (stopRequested (stop))
+	  break;
+
+	incrementalSieveWindow (sv);
+
+	unsigned int k;
+	for (k = 0; k < INCREMENTAL_SIEVE_LENGTH; k++) {
+	  if (sv.composite[k])
+	    continue;
+
+	  mpz_add_ui (m, window, 6 * k);
+	  // m ne doit pas dépasser nbits-1 bits : nouveau tirage
+	  if (mpz_sizeinbase (m, 2) > nbits-1)
+	    break;
+
+	  c.resReady = false;
+	  c.k = k;
+	  if (pipeline.run (c)) {
+	    found = true;
+	    break;
+	  }
+	}
+	if (!found && k < INCREMENTAL_SIEVE_LENGTH)
+	  break;
+
+	mpz_add_ui (window, window, 6 * INCREMENTAL_SIEVE_LENGTH);
+	incrementalSieveNext (sv);
+      }
+    }
 
-    break;
+    incrementalSieveShred (sv);
+    mpz_shred (window);
   }
 
+  shredResidues (res, PRIMES_SIZE);
+  delete[] res;
   mpz_shred (m);
-  mpz_shred (tmp);
+
+  return found;
+}
+
+
+void findRSAFactor (mpz_t n, const size_t nbits, PRNG& generator, bool init_mpz,
+		    rsa_factor_search_t mode) {
+  if (init_mpz) mpz_init (n);
+  searchRSAFactor (n, nbits, generator, threadPrimeContext (), mode, NULL);
+}
+
+
+void findRSAFactor (mpz_t n, const size_t nbits, PRNG& generator, PrimeContext& ctx,
+		    rsa_factor_search_t mode) {
+  searchRSAFactor (n, nbits, generator, ctx, mode, NULL);
+}
+
+
+/* Contexte partagé par les fils d'exécution de findRSAFactorPair */
+typedef struct {
+  size_t nbits;
+  rsa_factor_search_t mode;
+  rsa_prime_strategy_t strategy;
+  PrimeContext* primeCtx;  /* Ordre des étapes ; reçoit les compteurs (protégé par lock) */
+  mpz_srcptr diffMin;
+  mpz_ptr p, q;
+  pthread_mutex_t lock;
+  int nFound;              /* Nombre de facteurs retenus (protégé par lock) */
+  int stop;                /* Positionné lorsque la recherche est terminée */
+  int outOfMemory;         /* Un fil a rencontré std::bad_alloc */
+  int failed;              /* Un fil a rencontré une autre exception */
+  exception_t errNo;
+  String* details;
+} factorPairContext;
+
+
+typedef struct {
+  factorPairContext* ctx;
+  PRNG* generator;
+} factorPairThread;
+
+
+// Mémorise la première erreur rencontrée par un fil (relancée dans le
+// fil appelant) et arrête la recherche
+static void factorPairFailure (factorPairContext* ctx, exception_t errNo, const String& details) {
+  pthread_mutex_lock (&ctx->lock);
+  if (!ctx->failed) {
+    ctx->failed = 1;
+    ctx->errNo = errNo;
+    *(ctx->details) = details;
+  }
+  __sync_fetch_and_or (&ctx->stop, 1);
+  pthread_mutex_unlock (&ctx->lock);
+}
+
+
+// Chaque fil cherche des facteurs RSA avec son propre générateur et
+// les verse dans le contexte commun : un fil ayant trouvé un facteur
+// continue donc à chercher jusqu'à ce que la paire soit complète.
+static void* factorPairWorker (void* arg) {
+  factorPairThread* t = (factorPairThread*) arg;
+  factorPairContext* ctx = t->ctx;
+  PrimeContext* primeCtx = NULL;
+  mpz_t f, diff;
+
+  mpz_init (f);
+  mpz_init (diff);
+
+  try {
+    // Contexte propre au fil, avec les étapes du contexte appelant ;
+    // ses compteurs sont reportés dans ce dernier en fin de recherche
+    primeCtx = new PrimeContext (*(t->generator));
+    primeCtx->setRSAFactorPipeline (ctx->primeCtx->rsaFactorStages (),
+				    ctx->primeCtx->nRSAFactorStages ());
+
+    while (!stopRequested (&ctx->stop)) {
+      if (ctx->strategy == RSA_PRIME_CLASSIC) {
+	if (!searchRSAFactor (f, ctx->nbits, *(t->generator), *primeCtx, ctx->mode, &ctx->stop))
+	  break;
+      } else
+	// Les autres stratégies ne sont pas interruptibles : le fil
+	// termine le facteur en cours, qui est ignoré
+	genRSAFactor (f, ctx->nbits, *(t->generator), ctx->strategy, *primeCtx);
+
+      pthread_mutex_lock (&ctx->lock);
+      if (!stopRequested (&ctx->stop)) {
+	if (ctx->nFound == 0) {
+	  mpz_set (ctx->p, f);
+	  ctx->nFound = 1;
+	} else {
+	  mpz_sub (diff, ctx->p, f);
+	  mpz_abs (diff, diff);
+	  if (mpz_cmp (diff, ctx->diffMin) > 0) {
+	    mpz_set (ctx->q, f);
+	    ctx->nFound = 2;
+	    __sync_fetch_and_or (&ctx->stop, 1);
+	  } else
+	    // p et q trop proches : comme dans la recherche séquentielle,
+	    // les deux facteurs sont rejetés
+	    ctx->nFound = 0;
+	}
+      }
+      pthread_mutex_unlock (&ctx->lock);
+    }
+  } catch (ANSSIPKIException& e) {
+    factorPairFailure (ctx, e.errNo (), e.details ());
+  } catch (std::bad_alloc& e) {
+    // Erreur fatale (voir barak_halevi.cpp) : elle sera relancée dans
+    // le fil appelant
+    __sync_fetch_and_or (&ctx->outOfMemory, 1);
+    __sync_fetch_and_or (&ctx->stop, 1);
+  } catch (std::exception& e) {
+    // Une exception ne doit pas sortir d'un fil créé par pthread_create
+    factorPairFailure (ctx, E_UNKNOWN_ERROR, String (e.what ()));
+  } catch (...) {
+    factorPairFailure (ctx, E_UNKNOWN_ERROR, "Exception inconnue dans un fil de findRSAFactorPair");
+  }
+
+  if (primeCtx != NULL) {
+    pthread_mutex_lock (&ctx->lock);
+    RSAFactorPipeline::mergeStats (*(ctx->primeCtx), *primeCtx);
+    pthread_mutex_unlock (&ctx->lock);
+    delete primeCtx;
+  }
+
+  mpz_shred (f);
+  mpz_shred (diff);
+
+  return NULL;
+}
+
+
+void findRSAFactorPair (mpz_t p, mpz_t q, const size_t nbits, PRNG& generator,
+			const mpz_t diffMin, unsigned int nThreads,
+			rsa_factor_search_t mode, PrimeContext* primeCtx,
+			rsa_prime_strategy_t strategy) {
+  if (strategy < RSA_PRIME_CLASSIC || strategy >= RSA_PRIME_NB_STRATEGIES)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Stratégie de génération inconnue");
+  if (primeCtx == NULL)
+    primeCtx = &threadPrimeContext ();
+
+  if (nThreads == 0) {
+    long nCPU = sysconf (_SC_NPROCESSORS_ONLN);
+    nThreads = (nCPU > 0) ? (unsigned int) nCPU : 1;
+  }
+
+  // Un seul fil : recherche séquentielle directement avec generator
+  if (nThreads == 1) {
+    mpz_t diff;
+    mpz_init (diff);
+    do {
+      if (strategy == RSA_PRIME_CLASSIC) {
+	findRSAFactor (p, nbits, generator, *primeCtx, mode);
+	findRSAFactor (q, nbits, generator, *primeCtx, mode);
+      } else {
+	genRSAFactor (p, nbits, generator, strategy, *primeCtx);
+	genRSAFactor (q, nbits, generator, strategy, *primeCtx);
+      }
+
+      mpz_sub (diff, p, q);
+      mpz_abs (diff, diff);
+    } while (mpz_cmp (diff, diffMin) <= 0);
+    mpz_shred (diff);
+    return;
+  }
+
+  factorPairContext ctx;
+  String details;
+  ctx.nbits = nbits;
+  ctx.mode = mode;
+  ctx.strategy = strategy;
+  ctx.primeCtx = primeCtx;
+  ctx.diffMin = diffMin;
+  ctx.p = p;
+  ctx.q = q;
+  ctx.nFound = 0;
+  ctx.stop = 0;
+  ctx.outOfMemory = 0;
+  ctx.failed = 0;
+  ctx.errNo = E_UNKNOWN_ERROR;
+  ctx.details = &details;
+  pthread_mutex_init (&ctx.lock, NULL);
+
+  // Chaque fil dispose d'un générateur Barak-Halevi propre, dont l'état
+  // initial est tiré de generator avant le lancement des fils
+  BarakHaleviPRNG* generators = new BarakHaleviPRNG[nThreads];
+  factorPairThread* threads = new factorPairThread[nThreads];
+  pthread_t* tids = new pthread_t[nThreads];
+  unsigned int nStarted = 0;
+
+  for (unsigned int i=0; i<nThreads; i++) {
+    generators[i].PRNG::refresh (generator, BARAK_HALEVI_STATE_BYTE_SIZE);
+    threads[i].ctx = &ctx;
+    threads[i].generator = &generators[i];
+  }
+
+  // Le fil appelant participe à la recherche (threads[0]). Si la
+  // création d'un fil échoue, ceux déjà lancés font le travail.
+  for (unsigned int i=1; i<nThreads; i++) {
+    if (pthread_create (&tids[nStarted], NULL, factorPairWorker, &threads[i]) != 0)
+      break;
+    nStarted++;
+  }
+
+  factorPairWorker (&threads[0]);
+
+  for (unsigned int i=0; i<nStarted; i++)
+    pthread_join (tids[i], NULL);
+
+  pthread_mutex_destroy (&ctx.lock);
+  delete[] tids;
+  delete[] threads;
+  delete[] generators;
+
+  if (ctx.outOfMemory)
+    throw std::bad_alloc ();
+  if (ctx.failed)
+    throw ANSSIPKIException (ctx.errNo, details);
 }
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Genere les paramatres de l'algorithme de generation de premier de
 // Fouque-Tibouchi
-//  * m et lambda sont les parametres a generer, il s'agit du produit des
-//    petits nombres premiers, et de l'exposant correspondant
-//    lambda=lambda(m)
+//  * m est le parametre a generer, il s'agit du produit des petits nombres
+//    premiers (l'exposant lambda(m) de l'article n'est pas calcule : voir
+//    genUnitFT)
 //  * wlen taille des limbs gmp
 //  * k taille des premiers a generer
 // Retourne le plus grand entier inclus dans le produit m.
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-static mp_limb_t genParamFT(mpz_t m, mpz_t lambda, unsigned int wlen, size_t k)
+static mp_limb_t genParamFT(mpz_t m, unsigned int wlen, size_t k)
 {
     mpz_set_ui(m, 1UL);
-    mpz_set_ui(lambda, 1UL);
     unsigned int i = 0;
     while((k - mpz_sizeinbase(m, 2)) >= wlen && i < PRIMES_SIZE) {
         mpz_mul_si(m, m, primes[i]);
-        mpz_lcm_ui(lambda, lambda, primes[i]-1);
         i++;
     }
     return primes[i-1];
 }
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-// Genere un premier p de n bits en utilisant la méthode Fouque-Tibouchi,
-// le PRNG generator. Garantit que le premier généré fait exactement n bits.
+// Paramètres de Fouque-Tibouchi pour des premiers de k bits, pris dans le
+// cache (et calculés lors de la première demande pour cette taille).
+// Si le cache est plein, ils sont calculés dans local (initialisé par
+// cette fonction) ; releaseParamFT libère alors ce dernier.
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-void genPrimeFT(mpz_t p, const size_t n, PRNG& generator, bool init_mpz)
+static void initParamFT(ftParams* e, size_t k)
 {
-    mpz_t b, r, u, l, a;
-    mpz_t m, lambda;
+    mpz_t c;
+
+    e->k = k;
+    mpz_init(e->m);
+    e->largestPrime = genParamFT(e->m, FT_ALGO_PARAM_L, k);
+    e->nPrimes = 0;
+    while (primes[e->nPrimes] != e->largestPrime)
+        e->nPrimes++;
+    e->nPrimes++;
+
+    // Coefficients de reconstruction : crt[i] = (m/pi) * ((m/pi)^-1 mod pi)
+    mpz_init(c);
+    e->crt = new mpz_t[e->nPrimes];
+    for (unsigned int i = 0; i < e->nPrimes; i++) {
+        mpz_init(e->crt[i]);
+        mpz_divexact_ui(e->crt[i], e->m, primes[i]);
+        mpz_set_ui(c, primes[i]);
+        mpz_invert(c, e->crt[i], c);
+        mpz_mul(e->crt[i], e->crt[i], c);
+    }
+    mpz_clear(c);
+}
 
-    mpz_init(m);
-    mpz_init(lambda);
-// Génération de (p-1)/2
-    genParamFT(m, lambda, FT_ALGO_PARAM_L, n-1);
+static const ftParams* getParamFT(size_t k, ftParams* local)
+{
+    const ftParams* res = NULL;
+
+    pthread_mutex_lock(&FTParamsLock);
+    for (unsigned int i = 0; i < FTParamsCount; i++)
+        if (FTParamsCache[i].k == k) {
+            res = &FTParamsCache[i];
+            break;
+        }
+    if (res == NULL && FTParamsCount < FT_PARAMS_CACHE_SIZE) {
+        initParamFT(&FTParamsCache[FTParamsCount], k);
+        res = &FTParamsCache[FTParamsCount];
+        FTParamsCount++;
+    }
+    pthread_mutex_unlock(&FTParamsLock);
+
+    if (res == NULL) {
+        initParamFT(local, k);
+        res = local;
+    }
+
+    return res;
+}
+
+static void releaseParamFT(const ftParams* params, ftParams* local)
+{
+    if (params == local) {
+        mpz_clear(local->m);
+        for (unsigned int i = 0; i < local->nPrimes; i++)
+            mpz_clear(local->crt[i]);
+        delete[] local->crt;
+    }
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Tirage de b uniforme parmi les unités de Z/mZ (si twoBPlusOne, parmi
+// celles pour lesquelles 2b+1 est aussi une unité).
+// Les étapes 1 à 3 de Fouque-Tibouchi (exponentiation b^lambda(m) mod m
+// et correction des composantes non inversibles) reviennent à tirer
+// uniformément chaque composante de b modulo les premiers pi de m
+// jusqu'à ce qu'elle convienne : c'est ce qui est fait ici, directement
+// sur les restes, b étant reconstruit à la fin par restes chinois.
+// Comme dans getRandomIntNB, chaque composante est tirée sur 64 bits
+// de plus que pi puis réduite.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void genUnitFT(mpz_t b, const ftParams* params, PRNG& generator, bool twoBPlusOne)
+{
+    const size_t RND_SIZE = 8;
+    size_t len = params->nPrimes * RND_SIZE;
+    unsigned char* rnd = new unsigned char[len];
+
+    ensurePrimesInverses();
+
+    // Un seul appel au générateur pour toutes les composantes ; seules
+    // celles qui ne conviennent pas sont tirées de nouveau
+    generator.getRandomBytes((char*) rnd, len);
+
+    mpz_set_ui(b, 0UL);
+    for (unsigned int i = 0; i < params->nPrimes; i++) {
+        mp_limb_t p = primes[i];
+        unsigned char* ri = rnd + i * RND_SIZE;
+        mp_limb_t r;
+
+        while (true) {
+            // Réduction modulo p de l'entier de 64 bits ri, octet par octet
+            r = 0;
+            for (size_t j = 0; j < RND_SIZE; j++)
+                r = smallPrimeMod ((r << 8) | ri[j], p, primesLim[i]);
+            if (r != 0 && !(twoBPlusOne && 2 * r + 1 == p))
+                break;
+            generator.getRandomBytes((char*) ri, RND_SIZE);
+        }
+        mpz_addmul_ui(b, params->crt[i], r);
+    }
+    mpz_mod(b, b, params->m);
+
+    shred((char*) rnd, len);
+    delete[] rnd;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Crible d'un lot de candidats d'au moins nbits bits (par groupes de
+// width entiers, voir isPrime_SieveBatch) avant les tests
+// probabilistes. Les candidats b + a m n'ont aucun facteur premier
+// divisant m, mais peuvent en avoir d'autres inférieurs à 2^16 : le
+// crible évite les tests de Miller-Rabin correspondants, sans changer
+// le premier retenu (le premier candidat premier du lot, dans l'ordre
+// du tirage). Il n'est pas appliqué aux candidats pouvant être
+// inférieurs à 2^16, qui peuvent être l'un des premiers du crible.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void sieveCandidatesFT(mpz_t* batch, unsigned int count, unsigned int width,
+                              size_t nbits, bool* sieved)
+{
+    if (nbits > 16) {
+        isPrime_SieveBatch(batch, count, sieved, SIEVE_BATCH_AUTO, width);
+        return;
+    }
+    for (unsigned int i = 0; i < count; i++)
+        sieved[i] = true;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Genere un premier p de n bits en utilisant la méthode Fouque-Tibouchi,
+// le PRNG generator. Garantit que le premier généré fait exactement n bits
+// et, si topTwoBits, que ses deux bits de poids fort valent 1 (facteurs
+// RSA, voir genRSAFactor).
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void genPrimeFTAbove(mpz_t p, const size_t n, PRNG& generator, bool init_mpz,
+                            bool topTwoBits)
+{
+    mpz_t b, r, l, a;
+    ftParams local;
+    const ftParams* params = getParamFT(n-1, &local);
+    mpz_srcptr m = params->m;
+    mpz_t batch[SIEVE_BATCH_CANDIDATES];
+    bool sieved[SIEVE_BATCH_CANDIDATES];
+    bool found = false;
 
     mpz_init(a);
     mpz_init(b);
     mpz_init(r);
-    mpz_init(u);
     mpz_init(l);
+    for (unsigned int i = 0; i < SIEVE_BATCH_CANDIDATES; i++)
+        mpz_init(batch[i]);
     if (init_mpz) mpz_init(p);
 
-    mpz_sub_ui(l, m, 1UL);
-//1
-    generator.getRandomIntNB(b, l, false);
-    mpz_add_ui(b, b, 1UL);
-//2
-step2:
-    mpz_powm(u, b, lambda, m);
-    mpz_neg(u, u);
-    mpz_add_ui(u, u, 1UL);
-    mpz_mod(u, u, m);
-//3
-    if (mpz_sgn(u)) {
-        generator.getRandomIntNB(r, l, false);
-        mpz_add_ui(r, r, 1UL);
-        mpz_addmul(b, r, u);
-        mpz_mod(b, b, m);
-        goto step2;
-    }
+//1-3 : b unité de Z/mZ
+    genUnitFT(b, params, generator, false);
 //Garantir que p fait n bits exactement
     mpz_set_ui(p, 0UL);
     mpz_setbit(p, n-1);
+    if (topTwoBits)
+        mpz_setbit(p, n-2);
     mpz_sub(r, p, b);
     mpz_cdiv_q(r, r, m);
-    mpz_mul_2exp(p, p, 1UL);
+    mpz_set_ui(p, 0UL);
+    mpz_setbit(p, n);
     mpz_sub(p, p, b);
     mpz_fdiv_q(p, p, m);
     mpz_sub(l, p, r);
-    do {
-        generator.getRandomIntNB(a, l, false);
-        mpz_add(a, a, r);
-        mpz_set(p, b);
-        mpz_addmul(p, a, m);
-    } while (!isPrimeFT(p));
-
-    mpz_clear(m);
-    mpz_clear(lambda);
+    while (!found) {
+        for (unsigned int i = 0; i < SIEVE_BATCH_CANDIDATES; i++) {
+            generator.getRandomIntNB(a, l, false);
+            mpz_add(a, a, r);
+            mpz_set(batch[i], b);
+            mpz_addmul(batch[i], a, m);
+        }
+        sieveCandidatesFT(batch, SIEVE_BATCH_CANDIDATES, 1, n, sieved);
+
+        for (unsigned int i = 0; i < SIEVE_BATCH_CANDIDATES; i++) {
+            if (sieved[i] && isPrimeFT(batch[i])) {
+                mpz_set(p, batch[i]);
+                found = true;
+                break;
+            }
+        }
+    }
+
+    releaseParamFT(params, &local);
+    for (unsigned int i = 0; i < SIEVE_BATCH_CANDIDATES; i++)
+        mpz_shred(batch[i]);
     mpz_shred(a);
     mpz_shred(b);
     mpz_shred(r);
-    mpz_shred(u);
     mpz_shred(l);
 }
 
+void genPrimeFT(mpz_t p, const size_t n, PRNG& generator, bool init_mpz)
+{
+    genPrimeFTAbove(p, n, generator, init_mpz, false);
+}
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Genere un facteur RSA p de n bits.
 // Le premier p satisfait les propriétés suivantes :
@@ -878,43 +2104,33 @@ step2:
 // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 void findRSAFactorFT(mpz_t p, const size_t n, PRNG& generator, bool init_mpz)
 {
-    mpz_t b, r, u, l, a, pdemi;
-    mpz_t m, lambda;
-
-    mpz_init(m);
-    mpz_init(lambda);
-// Calcul des paramètres pour la génération de pdemi
-    genParamFT(m, lambda, FT_ALGO_PARAM_L, n-1);
-
+    mpz_t b, r, l, a, pdemi;
+// Paramètres pour la génération de pdemi
+    ftParams local;
+    const ftParams* params = getParamFT(n-1, &local);
+    mpz_srcptr m = params->m;
+// batch[i] : i-ème candidat pdemi du lot, batch[B+i] : 2 pdemi + 1
+    const unsigned int B = SIEVE_BATCH_CANDIDATES;
+    mpz_t batch[2 * SIEVE_BATCH_CANDIDATES];
+    bool sieved[SIEVE_BATCH_CANDIDATES];
+// pdemi-1, pdemi+1 et p+1
+    mpz_t smooth[3];
+    bool smoothRes[3];
+    bool found = false;
+
+    for (unsigned int i = 0; i < 2 * B; i++)
+        mpz_init(batch[i]);
+    for (unsigned int i = 0; i < 3; i++)
+        mpz_init(smooth[i]);
     mpz_init(a);
     mpz_init(b);
     mpz_init(r);
-    mpz_init(u);
     mpz_init(l);
     mpz_init(pdemi);
     if (init_mpz) mpz_init(p);
 
-    mpz_sub_ui(l, m, 1UL);
-//1
-    generator.getRandomIntNB(b, l, false);
-    mpz_add_ui(b, b, 1UL);
-//2
-step2: // Adapté pour tester que ni b, ni 2b+1 n'a de petits facteurs
-    mpz_mul_2exp(r, b, 1UL);
-    mpz_setbit(r, 0UL); //r <- 2b+1
-    mpz_mul(u, b, r);
-    mpz_powm(u, u, lambda, m); // u <- b^lambda(2b+1)^lambda mod m
-    mpz_neg(u, u);
-    mpz_add_ui(u, u, 1UL);
-    mpz_mod(u, u, m); //u <- 1 - b^lambda(2b+1)^lambda mod m
-//3
-    if (mpz_sgn(u)) {
-        generator.getRandomIntNB(r, l, false);
-        mpz_add_ui(r, r, 1UL);
-        mpz_addmul(b, r, u);
-        mpz_mod(b, b, m);
-        goto step2;
-    }
+//1-3 : adapté pour que ni b, ni 2b+1 n'ait de petits facteurs
+    genUnitFT(b, params, generator, true);
 //On garantit que les deux bits de poids fort de pdemi sont à 1
     mpz_set_ui(pdemi, 3UL);
     mpz_mul_2exp(pdemi, pdemi, n-3); // pdemi <- 2^(n-2) + 2^(n-3)
@@ -926,40 +2142,111 @@ step2: // Adapté pour tester que ni b, ni 2b+1 n'a de petits facteurs
     mpz_fdiv_q(pdemi, pdemi, m); //pdemi <- floor ((2^(n-1) - b) /m)
     mpz_sub(l, pdemi, r);
 
-    do {
-        generator.getRandomIntNB(a, l, false);
-        mpz_add(a, a, r);
-        mpz_set(pdemi, b);
-        mpz_addmul(pdemi, a, m);
-        if(!isPrimeFT(pdemi)) continue; //Primality of pdemi
-        mpz_mul_2exp(p, pdemi, 1UL);
-        mpz_setbit(p, 0UL); // p <- 2pdemi+1
-        if (!isPrimeFT(p)) continue; //Primality of p
-        // Vérification que pdemi-1 n'est pas friable
-        mpz_clrbit(pdemi, 0UL); //pdemi est pseudo premier :
-                            //soit il vaut 2 et pdemi-1 sera detecté smooth
-                            //soit il est impair et pdemi-1 s'obtient en faisant
-                            //un clr du bit 0
-        if (isSmooth (pdemi)) continue;
-
-        // Vérification que pdemi+1 n'est pas friable
-        mpz_add_ui(pdemi, pdemi, 2UL);
-        if (isSmooth (pdemi)) continue;
-
-        // Vérification que p+1 n'est pas friable
-        mpz_add_ui(pdemi, p, 1);
-        if (isSmooth (pdemi)) continue;
-
-        // On a trouvé!
-        break;
-    } while (true);
-
-    mpz_clear(m);
-    mpz_clear(lambda);
+    while (!found) {
+        for (unsigned int i = 0; i < B; i++) {
+            generator.getRandomIntNB(a, l, false);
+            mpz_add(a, a, r);
+            mpz_set(batch[i], b);
+            mpz_addmul(batch[i], a, m);
+            mpz_mul_2exp(batch[B+i], batch[i], 1UL);
+            mpz_setbit(batch[B+i], 0UL);
+        }
+        sieveCandidatesFT(batch, B, 2, n-1, sieved);
+
+        for (unsigned int i = 0; i < B; i++) {
+            if (!sieved[i]) continue;
+            mpz_set(pdemi, batch[i]);
+            if(!isPrimeFT(pdemi)) continue; //Primality of pdemi
+            mpz_set(p, batch[B+i]); // p <- 2pdemi+1
+            if (!isPrimeFT(p)) continue; //Primality of p
+            // Vérification que pdemi-1 n'est pas friable
+            mpz_clrbit(pdemi, 0UL); //pdemi est pseudo premier :
+                                //soit il vaut 2 et pdemi-1 sera detecté smooth
+                                //soit il est impair et pdemi-1 s'obtient en faisant
+                                //un clr du bit 0
+            mpz_set(smooth[0], pdemi);
+
+            // Vérification que pdemi+1 et p+1 ne sont pas friables, les
+            // trois entiers étant testés en un lot
+            mpz_add_ui(smooth[1], pdemi, 2UL);
+            mpz_add_ui(smooth[2], p, 1);
+            isSmoothBatch(smooth, 3, smoothRes);
+            if (smoothRes[0] || smoothRes[1] || smoothRes[2]) continue;
+
+            // On a trouvé!
+            found = true;
+            break;
+        }
+    }
+
+    releaseParamFT(params, &local);
+    for (unsigned int i = 0; i < 2 * B; i++)
+        mpz_shred(batch[i]);
+    for (unsigned int i = 0; i < 3; i++)
+        mpz_shred(smooth[i]);
     mpz_shred(a);
     mpz_shred(b);
     mpz_shred(r);
-    mpz_shred(u);
     mpz_shred(l);
     mpz_shred(pdemi);
 }
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Stratégies de génération des facteurs RSA
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/* Toutes les stratégies produisent des facteurs p de nbits bits dont
+   les deux bits de poids fort valent 1 (3 x 2^(nbits-2) <= p), ce qui
+   garantit la taille du module (voir RSAKey::checkKey). Seules les deux
+   premières imposent en outre les propriétés de findRSAFactor ((p-1)/2
+   premier, p+1 et (p-1)/2 +- 1 non friables). */
+
+static const char* rsaPrimeStrategyNames[RSA_PRIME_NB_STRATEGIES] = {
+  "classic", "FT-safe", "FT", "provable"
+};
+
+
+const char* rsaPrimeStrategyName (rsa_prime_strategy_t s) {
+  if (s < RSA_PRIME_CLASSIC || s >= RSA_PRIME_NB_STRATEGIES)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Stratégie de génération inconnue");
+  return rsaPrimeStrategyNames[s];
+}
+
+
+bool rsaPrimeStrategyFromName (const char* name, rsa_prime_strategy_t* s) {
+  for (int i = 0; i < RSA_PRIME_NB_STRATEGIES; i++)
+    if (strcmp (name, rsaPrimeStrategyNames[i]) == 0) {
+      *s = (rsa_prime_strategy_t) i;
+      return true;
+    }
+  return false;
+}
+
+
+bool rsaPrimeStrategyIsSafe (rsa_prime_strategy_t s) {
+  return (s == RSA_PRIME_CLASSIC || s == RSA_PRIME_FT_SAFE);
+}
+
+
+void genRSAFactor (mpz_t factor, const size_t nbits, PRNG& generator,
+		   rsa_prime_strategy_t strategy, PrimeContext& ctx) {
+  switch (strategy) {
+  case RSA_PRIME_CLASSIC:
+    findRSAFactor (factor, nbits, generator, ctx);
+    break;
+  case RSA_PRIME_FT_SAFE:
+    findRSAFactorFT (factor, nbits, generator, false);
+    break;
+  case RSA_PRIME_FT:
+    genPrimeFTAbove (factor, nbits, generator, false, true);
+    break;
+  case RSA_PRIME_PROVABLE:
+    findRSAFactorProvable (factor, nbits, generator, false);
+    break;
+  default:
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Stratégie de génération inconnue");
+  }
+}
@@ -0,0 +1,2328 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+#ifndef PRIME_TABLES_H
+#define PRIME_TABLES_H
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Tableaux précalculés des petits premiers et de leurs produits
+//
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/* Fichier généré, pour b = 16 (voir prime.cpp) : les premiers inférieurs
+   à 2^16 puis, pour chaque taille de limbe, les produits de premiers
+   consécutifs (à partir de PP_FIRST_OMITTED) tenant dans un limbe et les
+   indices [début, fin[ des premiers correspondants. Il peut être
+   régénéré à l'aide de Sage :
+
+   sage: def products(bits, first):
+   ....:     P = prime_range(2**16); i = P.index(first); res = []
+   ....:     while i < len(P):
+   ....:         p = 1; j = i
+   ....:         while i < len(P) and p * P[i] < 2**bits:
+   ....:             p *= P[i]; i += 1
+   ....:         res.append((p, j, i))
+   ....:     return res
+   sage: prime_range(2**16), products(64, 59), products(32, 31)
+
+   La cohérence des tailles avec PRIMES_SIZE et PRIMES_PRODUCTS_SIZE est
+   vérifiée à la compilation dans prime.cpp. */
+
+static const mp_limb_t primes[] = {
+  2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37,
+  41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89,
+  97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151,
+  157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223,
+  227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281,
+  283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359,
+  367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433,
+  439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503,
+  509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593,
+  599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659,
+  661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743,
+  751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827,
+  829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911,
+  919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997,
+  1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069,
+  1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163,
+  1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249,
+  1259, 1277, 1279, 1283, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321,
+  1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439,
+  1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511,
+  1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601,
+  1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693,
+  1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783,
+  1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877,
+  1879, 1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987,
+  1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039, 2053, 2063, 2069,
+  2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131, 2137, 2141, 2143,
+  2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267,
+  2269, 2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347,
+  2351, 2357, 2371, 2377, 2381, 2383, 2389, 2393, 2399, 2411, 2417, 2423,
+  2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521, 2531, 2539, 2543,
+  2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657,
+  2659, 2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713,
+  2719, 2729, 2731, 2741, 2749, 2753, 2767, 2777, 2789, 2791, 2797, 2801,
+  2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879, 2887, 2897, 2903,
+  2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011,
+  3019, 3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119,
+  3121, 3137, 3163, 3167, 3169, 3181, 3187, 3191, 3203, 3209, 3217, 3221,
+  3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307, 3313, 3319, 3323,
+  3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413,
+  3433, 3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527,
+  3529, 3533, 3539, 3541, 3547, 3557, 3559, 3571, 3581, 3583, 3593, 3607,
+  3613, 3617, 3623, 3631, 3637, 3643, 3659, 3671, 3673, 3677, 3691, 3697,
+  3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797,
+  3803, 3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907,
+  3911, 3917, 3919, 3923, 3929, 3931, 3943, 3947, 3967, 3989, 4001, 4003,
+  4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073, 4079, 4091, 4093,
+  4099, 4111, 4127, 4129, 4133, 4139, 4153, 4157, 4159, 4177, 4201, 4211,
+  4217, 4219, 4229, 4231, 4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283,
+  4289, 4297, 4327, 4337, 4339, 4349, 4357, 4363, 4373, 4391, 4397, 4409,
+  4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483, 4493, 4507, 4513,
+  4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583, 4591, 4597, 4603, 4621,
+  4637, 4639, 4643, 4649, 4651, 4657, 4663, 4673, 4679, 4691, 4703, 4721,
+  4723, 4729, 4733, 4751, 4759, 4783, 4787, 4789, 4793, 4799, 4801, 4813,
+  4817, 4831, 4861, 4871, 4877, 4889, 4903, 4909, 4919, 4931, 4933, 4937,
+  4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003, 5009, 5011,
+  5021, 5023, 5039, 5051, 5059, 5077, 5081, 5087, 5099, 5101, 5107, 5113,
+  5119, 5147, 5153, 5167, 5171, 5179, 5189, 5197, 5209, 5227, 5231, 5233,
+  5237, 5261, 5273, 5279, 5281, 5297, 5303, 5309, 5323, 5333, 5347, 5351,
+  5381, 5387, 5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443,
+  5449, 5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521, 5527, 5531,
+  5557, 5563, 5569, 5573, 5581, 5591, 5623, 5639, 5641, 5647, 5651, 5653,
+  5657, 5659, 5669, 5683, 5689, 5693, 5701, 5711, 5717, 5737, 5741, 5743,
+  5749, 5779, 5783, 5791, 5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849,
+  5851, 5857, 5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939,
+  5953, 5981, 5987, 6007, 6011, 6029, 6037, 6043, 6047, 6053, 6067, 6073,
+  6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133, 6143, 6151, 6163, 6173,
+  6197, 6199, 6203, 6211, 6217, 6221, 6229, 6247, 6257, 6263, 6269, 6271,
+  6277, 6287, 6299, 6301, 6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359,
+  6361, 6367, 6373, 6379, 6389, 6397, 6421, 6427, 6449, 6451, 6469, 6473,
+  6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569, 6571, 6577, 6581,
+  6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673, 6679, 6689, 6691, 6701,
+  6703, 6709, 6719, 6733, 6737, 6761, 6763, 6779, 6781, 6791, 6793, 6803,
+  6823, 6827, 6829, 6833, 6841, 6857, 6863, 6869, 6871, 6883, 6899, 6907,
+  6911, 6917, 6947, 6949, 6959, 6961, 6967, 6971, 6977, 6983, 6991, 6997,
+  7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103, 7109, 7121,
+  7127, 7129, 7151, 7159, 7177, 7187, 7193, 7207, 7211, 7213, 7219, 7229,
+  7237, 7243, 7247, 7253, 7283, 7297, 7307, 7309, 7321, 7331, 7333, 7349,
+  7351, 7369, 7393, 7411, 7417, 7433, 7451, 7457, 7459, 7477, 7481, 7487,
+  7489, 7499, 7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561,
+  7573, 7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643, 7649, 7669,
+  7673, 7681, 7687, 7691, 7699, 7703, 7717, 7723, 7727, 7741, 7753, 7757,
+  7759, 7789, 7793, 7817, 7823, 7829, 7841, 7853, 7867, 7873, 7877, 7879,
+  7883, 7901, 7907, 7919, 7927, 7933, 7937, 7949, 7951, 7963, 7993, 8009,
+  8011, 8017, 8039, 8053, 8059, 8069, 8081, 8087, 8089, 8093, 8101, 8111,
+  8117, 8123, 8147, 8161, 8167, 8171, 8179, 8191, 8209, 8219, 8221, 8231,
+  8233, 8237, 8243, 8263, 8269, 8273, 8287, 8291, 8293, 8297, 8311, 8317,
+  8329, 8353, 8363, 8369, 8377, 8387, 8389, 8419, 8423, 8429, 8431, 8443,
+  8447, 8461, 8467, 8501, 8513, 8521, 8527, 8537, 8539, 8543, 8563, 8573,
+  8581, 8597, 8599, 8609, 8623, 8627, 8629, 8641, 8647, 8663, 8669, 8677,
+  8681, 8689, 8693, 8699, 8707, 8713, 8719, 8731, 8737, 8741, 8747, 8753,
+  8761, 8779, 8783, 8803, 8807, 8819, 8821, 8831, 8837, 8839, 8849, 8861,
+  8863, 8867, 8887, 8893, 8923, 8929, 8933, 8941, 8951, 8963, 8969, 8971,
+  8999, 9001, 9007, 9011, 9013, 9029, 9041, 9043, 9049, 9059, 9067, 9091,
+  9103, 9109, 9127, 9133, 9137, 9151, 9157, 9161, 9173, 9181, 9187, 9199,
+  9203, 9209, 9221, 9227, 9239, 9241, 9257, 9277, 9281, 9283, 9293, 9311,
+  9319, 9323, 9337, 9341, 9343, 9349, 9371, 9377, 9391, 9397, 9403, 9413,
+  9419, 9421, 9431, 9433, 9437, 9439, 9461, 9463, 9467, 9473, 9479, 9491,
+  9497, 9511, 9521, 9533, 9539, 9547, 9551, 9587, 9601, 9613, 9619, 9623,
+  9629, 9631, 9643, 9649, 9661, 9677, 9679, 9689, 9697, 9719, 9721, 9733,
+  9739, 9743, 9749, 9767, 9769, 9781, 9787, 9791, 9803, 9811, 9817, 9829,
+  9833, 9839, 9851, 9857, 9859, 9871, 9883, 9887, 9901, 9907, 9923, 9929,
+  9931, 9941, 9949, 9967, 9973, 10007, 10009, 10037, 10039, 10061, 10067, 10069,
+  10079, 10091, 10093, 10099, 10103, 10111, 10133, 10139, 10141, 10151, 10159, 10163,
+  10169, 10177, 10181, 10193, 10211, 10223, 10243, 10247, 10253, 10259, 10267, 10271,
+  10273, 10289, 10301, 10303, 10313, 10321, 10331, 10333, 10337, 10343, 10357, 10369,
+  10391, 10399, 10427, 10429, 10433, 10453, 10457, 10459, 10463, 10477, 10487, 10499,
+  10501, 10513, 10529, 10531, 10559, 10567, 10589, 10597, 10601, 10607, 10613, 10627,
+  10631, 10639, 10651, 10657, 10663, 10667, 10687, 10691, 10709, 10711, 10723, 10729,
+  10733, 10739, 10753, 10771, 10781, 10789, 10799, 10831, 10837, 10847, 10853, 10859,
+  10861, 10867, 10883, 10889, 10891, 10903, 10909, 10937, 10939, 10949, 10957, 10973,
+  10979, 10987, 10993, 11003, 11027, 11047, 11057, 11059, 11069, 11071, 11083, 11087,
+  11093, 11113, 11117, 11119, 11131, 11149, 11159, 11161, 11171, 11173, 11177, 11197,
+  11213, 11239, 11243, 11251, 11257, 11261, 11273, 11279, 11287, 11299, 11311, 11317,
+  11321, 11329, 11351, 11353, 11369, 11383, 11393, 11399, 11411, 11423, 11437, 11443,
+  11447, 11467, 11471, 11483, 11489, 11491, 11497, 11503, 11519, 11527, 11549, 11551,
+  11579, 11587, 11593, 11597, 11617, 11621, 11633, 11657, 11677, 11681, 11689, 11699,
+  11701, 11717, 11719, 11731, 11743, 11777, 11779, 11783, 11789, 11801, 11807, 11813,
+  11821, 11827, 11831, 11833, 11839, 11863, 11867, 11887, 11897, 11903, 11909, 11923,
+  11927, 11933, 11939, 11941, 11953, 11959, 11969, 11971, 11981, 11987, 12007, 12011,
+  12037, 12041, 12043, 12049, 12071, 12073, 12097, 12101, 12107, 12109, 12113, 12119,
+  12143, 12149, 12157, 12161, 12163, 12197, 12203, 12211, 12227, 12239, 12241, 12251,
+  12253, 12263, 12269, 12277, 12281, 12289, 12301, 12323, 12329, 12343, 12347, 12373,
+  12377, 12379, 12391, 12401, 12409, 12413, 12421, 12433, 12437, 12451, 12457, 12473,
+  12479, 12487, 12491, 12497, 12503, 12511, 12517, 12527, 12539, 12541, 12547, 12553,
+  12569, 12577, 12583, 12589, 12601, 12611, 12613, 12619, 12637, 12641, 12647, 12653,
+  12659, 12671, 12689, 12697, 12703, 12713, 12721, 12739, 12743, 12757, 12763, 12781,
+  12791, 12799, 12809, 12821, 12823, 12829, 12841, 12853, 12889, 12893, 12899, 12907,
+  12911, 12917, 12919, 12923, 12941, 12953, 12959, 12967, 12973, 12979, 12983, 13001,
+  13003, 13007, 13009, 13033, 13037, 13043, 13049, 13063, 13093, 13099, 13103, 13109,
+  13121, 13127, 13147, 13151, 13159, 13163, 13171, 13177, 13183, 13187, 13217, 13219,
+  13229, 13241, 13249, 13259, 13267, 13291, 13297, 13309, 13313, 13327, 13331, 13337,
+  13339, 13367, 13381, 13397, 13399, 13411, 13417, 13421, 13441, 13451, 13457, 13463,
+  13469, 13477, 13487, 13499, 13513, 13523, 13537, 13553, 13567, 13577, 13591, 13597,
+  13613, 13619, 13627, 13633, 13649, 13669, 13679, 13681, 13687, 13691, 13693, 13697,
+  13709, 13711, 13721, 13723, 13729, 13751, 13757, 13759, 13763, 13781, 13789, 13799,
+  13807, 13829, 13831, 13841, 13859, 13873, 13877, 13879, 13883, 13901, 13903, 13907,
+  13913, 13921, 13931, 13933, 13963, 13967, 13997, 13999, 14009, 14011, 14029, 14033,
+  14051, 14057, 14071, 14081, 14083, 14087, 14107, 14143, 14149, 14153, 14159, 14173,
+  14177, 14197, 14207, 14221, 14243, 14249, 14251, 14281, 14293, 14303, 14321, 14323,
+  14327, 14341, 14347, 14369, 14387, 14389, 14401, 14407, 14411, 14419, 14423, 14431,
+  14437, 14447, 14449, 14461, 14479, 14489, 14503, 14519, 14533, 14537, 14543, 14549,
+  14551, 14557, 14561, 14563, 14591, 14593, 14621, 14627, 14629, 14633, 14639, 14653,
+  14657, 14669, 14683, 14699, 14713, 14717, 14723, 14731, 14737, 14741, 14747, 14753,
+  14759, 14767, 14771, 14779, 14783, 14797, 14813, 14821, 14827, 14831, 14843, 14851,
+  14867, 14869, 14879, 14887, 14891, 14897, 14923, 14929, 14939, 14947, 14951, 14957,
+  14969, 14983, 15013, 15017, 15031, 15053, 15061, 15073, 15077, 15083, 15091, 15101,
+  15107, 15121, 15131, 15137, 15139, 15149, 15161, 15173, 15187, 15193, 15199, 15217,
+  15227, 15233, 15241, 15259, 15263, 15269, 15271, 15277, 15287, 15289, 15299, 15307,
+  15313, 15319, 15329, 15331, 15349, 15359, 15361, 15373, 15377, 15383, 15391, 15401,
+  15413, 15427, 15439, 15443, 15451, 15461, 15467, 15473, 15493, 15497, 15511, 15527,
+  15541, 15551, 15559, 15569, 15581, 15583, 15601, 15607, 15619, 15629, 15641, 15643,
+  15647, 15649, 15661, 15667, 15671, 15679, 15683, 15727, 15731, 15733, 15737, 15739,
+  15749, 15761, 15767, 15773, 15787, 15791, 15797, 15803, 15809, 15817, 15823, 15859,
+  15877, 15881, 15887, 15889, 15901, 15907, 15913, 15919, 15923, 15937, 15959, 15971,
+  15973, 15991, 16001, 16007, 16033, 16057, 16061, 16063, 16067, 16069, 16073, 16087,
+  16091, 16097, 16103, 16111, 16127, 16139, 16141, 16183, 16187, 16189, 16193, 16217,
+  16223, 16229, 16231, 16249, 16253, 16267, 16273, 16301, 16319, 16333, 16339, 16349,
+  16361, 16363, 16369, 16381, 16411, 16417, 16421, 16427, 16433, 16447, 16451, 16453,
+  16477, 16481, 16487, 16493, 16519, 16529, 16547, 16553, 16561, 16567, 16573, 16603,
+  16607, 16619, 16631, 16633, 16649, 16651, 16657, 16661, 16673, 16691, 16693, 16699,
+  16703, 16729, 16741, 16747, 16759, 16763, 16787, 16811, 16823, 16829, 16831, 16843,
+  16871, 16879, 16883, 16889, 16901, 16903, 16921, 16927, 16931, 16937, 16943, 16963,
+  16979, 16981, 16987, 16993, 17011, 17021, 17027, 17029, 17033, 17041, 17047, 17053,
+  17077, 17093, 17099, 17107, 17117, 17123, 17137, 17159, 17167, 17183, 17189, 17191,
+  17203, 17207, 17209, 17231, 17239, 17257, 17291, 17293, 17299, 17317, 17321, 17327,
+  17333, 17341, 17351, 17359, 17377, 17383, 17387, 17389, 17393, 17401, 17417, 17419,
+  17431, 17443, 17449, 17467, 17471, 17477, 17483, 17489, 17491, 17497, 17509, 17519,
+  17539, 17551, 17569, 17573, 17579, 17581, 17597, 17599, 17609, 17623, 17627, 17657,
+  17659, 17669, 17681, 17683, 17707, 17713, 17729, 17737, 17747, 17749, 17761, 17783,
+  17789, 17791, 17807, 17827, 17837, 17839, 17851, 17863, 17881, 17891, 17903, 17909,
+  17911, 17921, 17923, 17929, 17939, 17957, 17959, 17971, 17977, 17981, 17987, 17989,
+  18013, 18041, 18043, 18047, 18049, 18059, 18061, 18077, 18089, 18097, 18119, 18121,
+  18127, 18131, 18133, 18143, 18149, 18169, 18181, 18191, 18199, 18211, 18217, 18223,
+  18229, 18233, 18251, 18253, 18257, 18269, 18287, 18289, 18301, 18307, 18311, 18313,
+  18329, 18341, 18353, 18367, 18371, 18379, 18397, 18401, 18413, 18427, 18433, 18439,
+  18443, 18451, 18457, 18461, 18481, 18493, 18503, 18517, 18521, 18523, 18539, 18541,
+  18553, 18583, 18587, 18593, 18617, 18637, 18661, 18671, 18679, 18691, 18701, 18713,
+  18719, 18731, 18743, 18749, 18757, 18773, 18787, 18793, 18797, 18803, 18839, 18859,
+  18869, 18899, 18911, 18913, 18917, 18919, 18947, 18959, 18973, 18979, 19001, 19009,
+  19013, 19031, 19037, 19051, 19069, 19073, 19079, 19081, 19087, 19121, 19139, 19141,
+  19157, 19163, 19181, 19183, 19207, 19211, 19213, 19219, 19231, 19237, 19249, 19259,
+  19267, 19273, 19289, 19301, 19309, 19319, 19333, 19373, 19379, 19381, 19387, 19391,
+  19403, 19417, 19421, 19423, 19427, 19429, 19433, 19441, 19447, 19457, 19463, 19469,
+  19471, 19477, 19483, 19489, 19501, 19507, 19531, 19541, 19543, 19553, 19559, 19571,
+  19577, 19583, 19597, 19603, 19609, 19661, 19681, 19687, 19697, 19699, 19709, 19717,
+  19727, 19739, 19751, 19753, 19759, 19763, 19777, 19793, 19801, 19813, 19819, 19841,
+  19843, 19853, 19861, 19867, 19889, 19891, 19913, 19919, 19927, 19937, 19949, 19961,
+  19963, 19973, 19979, 19991, 19993, 19997, 20011, 20021, 20023, 20029, 20047, 20051,
+  20063, 20071, 20089, 20101, 20107, 20113, 20117, 20123, 20129, 20143, 20147, 20149,
+  20161, 20173, 20177, 20183, 20201, 20219, 20231, 20233, 20249, 20261, 20269, 20287,
+  20297, 20323, 20327, 20333, 20341, 20347, 20353, 20357, 20359, 20369, 20389, 20393,
+  20399, 20407, 20411, 20431, 20441, 20443, 20477, 20479, 20483, 20507, 20509, 20521,
+  20533, 20543, 20549, 20551, 20563, 20593, 20599, 20611, 20627, 20639, 20641, 20663,
+  20681, 20693, 20707, 20717, 20719, 20731, 20743, 20747, 20749, 20753, 20759, 20771,
+  20773, 20789, 20807, 20809, 20849, 20857, 20873, 20879, 20887, 20897, 20899, 20903,
+  20921, 20929, 20939, 20947, 20959, 20963, 20981, 20983, 21001, 21011, 21013, 21017,
+  21019, 21023, 21031, 21059, 21061, 21067, 21089, 21101, 21107, 21121, 21139, 21143,
+  21149, 21157, 21163, 21169, 21179, 21187, 21191, 21193, 21211, 21221, 21227, 21247,
+  21269, 21277, 21283, 21313, 21317, 21319, 21323, 21341, 21347, 21377, 21379, 21383,
+  21391, 21397, 21401, 21407, 21419, 21433, 21467, 21481, 21487, 21491, 21493, 21499,
+  21503, 21517, 21521, 21523, 21529, 21557, 21559, 21563, 21569, 21577, 21587, 21589,
+  21599, 21601, 21611, 21613, 21617, 21647, 21649, 21661, 21673, 21683, 21701, 21713,
+  21727, 21737, 21739, 21751, 21757, 21767, 21773, 21787, 21799, 21803, 21817, 21821,
+  21839, 21841, 21851, 21859, 21863, 21871, 21881, 21893, 21911, 21929, 21937, 21943,
+  21961, 21977, 21991, 21997, 22003, 22013, 22027, 22031, 22037, 22039, 22051, 22063,
+  22067, 22073, 22079, 22091, 22093, 22109, 22111, 22123, 22129, 22133, 22147, 22153,
+  22157, 22159, 22171, 22189, 22193, 22229, 22247, 22259, 22271, 22273, 22277, 22279,
+  22283, 22291, 22303, 22307, 22343, 22349, 22367, 22369, 22381, 22391, 22397, 22409,
+  22433, 22441, 22447, 22453, 22469, 22481, 22483, 22501, 22511, 22531, 22541, 22543,
+  22549, 22567, 22571, 22573, 22613, 22619, 22621, 22637, 22639, 22643, 22651, 22669,
+  22679, 22691, 22697, 22699, 22709, 22717, 22721, 22727, 22739, 22741, 22751, 22769,
+  22777, 22783, 22787, 22807, 22811, 22817, 22853, 22859, 22861, 22871, 22877, 22901,
+  22907, 22921, 22937, 22943, 22961, 22963, 22973, 22993, 23003, 23011, 23017, 23021,
+  23027, 23029, 23039, 23041, 23053, 23057, 23059, 23063, 23071, 23081, 23087, 23099,
+  23117, 23131, 23143, 23159, 23167, 23173, 23189, 23197, 23201, 23203, 23209, 23227,
+  23251, 23269, 23279, 23291, 23293, 23297, 23311, 23321, 23327, 23333, 23339, 23357,
+  23369, 23371, 23399, 23417, 23431, 23447, 23459, 23473, 23497, 23509, 23531, 23537,
+  23539, 23549, 23557, 23561, 23563, 23567, 23581, 23593, 23599, 23603, 23609, 23623,
+  23627, 23629, 23633, 23663, 23669, 23671, 23677, 23687, 23689, 23719, 23741, 23743,
+  23747, 23753, 23761, 23767, 23773, 23789, 23801, 23813, 23819, 23827, 23831, 23833,
+  23857, 23869, 23873, 23879, 23887, 23893, 23899, 23909, 23911, 23917, 23929, 23957,
+  23971, 23977, 23981, 23993, 24001, 24007, 24019, 24023, 24029, 24043, 24049, 24061,
+  24071, 24077, 24083, 24091, 24097, 24103, 24107, 24109, 24113, 24121, 24133, 24137,
+  24151, 24169, 24179, 24181, 24197, 24203, 24223, 24229, 24239, 24247, 24251, 24281,
+  24317, 24329, 24337, 24359, 24371, 24373, 24379, 24391, 24407, 24413, 24419, 24421,
+  24439, 24443, 24469, 24473, 24481, 24499, 24509, 24517, 24527, 24533, 24547, 24551,
+  24571, 24593, 24611, 24623, 24631, 24659, 24671, 24677, 24683, 24691, 24697, 24709,
+  24733, 24749, 24763, 24767, 24781, 24793, 24799, 24809, 24821, 24841, 24847, 24851,
+  24859, 24877, 24889, 24907, 24917, 24919, 24923, 24943, 24953, 24967, 24971, 24977,
+  24979, 24989, 25013, 25031, 25033, 25037, 25057, 25073, 25087, 25097, 25111, 25117,
+  25121, 25127, 25147, 25153, 25163, 25169, 25171, 25183, 25189, 25219, 25229, 25237,
+  25243, 25247, 25253, 25261, 25301, 25303, 25307, 25309, 25321, 25339, 25343, 25349,
+  25357, 25367, 25373, 25391, 25409, 25411, 25423, 25439, 25447, 25453, 25457, 25463,
+  25469, 25471, 25523, 25537, 25541, 25561, 25577, 25579, 25583, 25589, 25601, 25603,
+  25609, 25621, 25633, 25639, 25643, 25657, 25667, 25673, 25679, 25693, 25703, 25717,
+  25733, 25741, 25747, 25759, 25763, 25771, 25793, 25799, 25801, 25819, 25841, 25847,
+  25849, 25867, 25873, 25889, 25903, 25913, 25919, 25931, 25933, 25939, 25943, 25951,
+  25969, 25981, 25997, 25999, 26003, 26017, 26021, 26029, 26041, 26053, 26083, 26099,
+  26107, 26111, 26113, 26119, 26141, 26153, 26161, 26171, 26177, 26183, 26189, 26203,
+  26209, 26227, 26237, 26249, 26251, 26261, 26263, 26267, 26293, 26297, 26309, 26317,
+  26321, 26339, 26347, 26357, 26371, 26387, 26393, 26399, 26407, 26417, 26423, 26431,
+  26437, 26449, 26459, 26479, 26489, 26497, 26501, 26513, 26539, 26557, 26561, 26573,
+  26591, 26597, 26627, 26633, 26641, 26647, 26669, 26681, 26683, 26687, 26693, 26699,
+  26701, 26711, 26713, 26717, 26723, 26729, 26731, 26737, 26759, 26777, 26783, 26801,
+  26813, 26821, 26833, 26839, 26849, 26861, 26863, 26879, 26881, 26891, 26893, 26903,
+  26921, 26927, 26947, 26951, 26953, 26959, 26981, 26987, 26993, 27011, 27017, 27031,
+  27043, 27059, 27061, 27067, 27073, 27077, 27091, 27103, 27107, 27109, 27127, 27143,
+  27179, 27191, 27197, 27211, 27239, 27241, 27253, 27259, 27271, 27277, 27281, 27283,
+  27299, 27329, 27337, 27361, 27367, 27397, 27407, 27409, 27427, 27431, 27437, 27449,
+  27457, 27479, 27481, 27487, 27509, 27527, 27529, 27539, 27541, 27551, 27581, 27583,
+  27611, 27617, 27631, 27647, 27653, 27673, 27689, 27691, 27697, 27701, 27733, 27737,
+  27739, 27743, 27749, 27751, 27763, 27767, 27773, 27779, 27791, 27793, 27799, 27803,
+  27809, 27817, 27823, 27827, 27847, 27851, 27883, 27893, 27901, 27917, 27919, 27941,
+  27943, 27947, 27953, 27961, 27967, 27983, 27997, 28001, 28019, 28027, 28031, 28051,
+  28057, 28069, 28081, 28087, 28097, 28099, 28109, 28111, 28123, 28151, 28163, 28181,
+  28183, 28201, 28211, 28219, 28229, 28277, 28279, 28283, 28289, 28297, 28307, 28309,
+  28319, 28349, 28351, 28387, 28393, 28403, 28409, 28411, 28429, 28433, 28439, 28447,
+  28463, 28477, 28493, 28499, 28513, 28517, 28537, 28541, 28547, 28549, 28559, 28571,
+  28573, 28579, 28591, 28597, 28603, 28607, 28619, 28621, 28627, 28631, 28643, 28649,
+  28657, 28661, 28663, 28669, 28687, 28697, 28703, 28711, 28723, 28729, 28751, 28753,
+  28759, 28771, 28789, 28793, 28807, 28813, 28817, 28837, 28843, 28859, 28867, 28871,
+  28879, 28901, 28909, 28921, 28927, 28933, 28949, 28961, 28979, 29009, 29017, 29021,
+  29023, 29027, 29033, 29059, 29063, 29077, 29101, 29123, 29129, 29131, 29137, 29147,
+  29153, 29167, 29173, 29179, 29191, 29201, 29207, 29209, 29221, 29231, 29243, 29251,
+  29269, 29287, 29297, 29303, 29311, 29327, 29333, 29339, 29347, 29363, 29383, 29387,
+  29389, 29399, 29401, 29411, 29423, 29429, 29437, 29443, 29453, 29473, 29483, 29501,
+  29527, 29531, 29537, 29567, 29569, 29573, 29581, 29587, 29599, 29611, 29629, 29633,
+  29641, 29663, 29669, 29671, 29683, 29717, 29723, 29741, 29753, 29759, 29761, 29789,
+  29803, 29819, 29833, 29837, 29851, 29863, 29867, 29873, 29879, 29881, 29917, 29921,
+  29927, 29947, 29959, 29983, 29989, 30011, 30013, 30029, 30047, 30059, 30071, 30089,
+  30091, 30097, 30103, 30109, 30113, 30119, 30133, 30137, 30139, 30161, 30169, 30181,
+  30187, 30197, 30203, 30211, 30223, 30241, 30253, 30259, 30269, 30271, 30293, 30307,
+  30313, 30319, 30323, 30341, 30347, 30367, 30389, 30391, 30403, 30427, 30431, 30449,
+  30467, 30469, 30491, 30493, 30497, 30509, 30517, 30529, 30539, 30553, 30557, 30559,
+  30577, 30593, 30631, 30637, 30643, 30649, 30661, 30671, 30677, 30689, 30697, 30703,
+  30707, 30713, 30727, 30757, 30763, 30773, 30781, 30803, 30809, 30817, 30829, 30839,
+  30841, 30851, 30853, 30859, 30869, 30871, 30881, 30893, 30911, 30931, 30937, 30941,
+  30949, 30971, 30977, 30983, 31013, 31019, 31033, 31039, 31051, 31063, 31069, 31079,
+  31081, 31091, 31121, 31123, 31139, 31147, 31151, 31153, 31159, 31177, 31181, 31183,
+  31189, 31193, 31219, 31223, 31231, 31237, 31247, 31249, 31253, 31259, 31267, 31271,
+  31277, 31307, 31319, 31321, 31327, 31333, 31337, 31357, 31379, 31387, 31391, 31393,
+  31397, 31469, 31477, 31481, 31489, 31511, 31513, 31517, 31531, 31541, 31543, 31547,
+  31567, 31573, 31583, 31601, 31607, 31627, 31643, 31649, 31657, 31663, 31667, 31687,
+  31699, 31721, 31723, 31727, 31729, 31741, 31751, 31769, 31771, 31793, 31799, 31817,
+  31847, 31849, 31859, 31873, 31883, 31891, 31907, 31957, 31963, 31973, 31981, 31991,
+  32003, 32009, 32027, 32029, 32051, 32057, 32059, 32063, 32069, 32077, 32083, 32089,
+  32099, 32117, 32119, 32141, 32143, 32159, 32173, 32183, 32189, 32191, 32203, 32213,
+  32233, 32237, 32251, 32257, 32261, 32297, 32299, 32303, 32309, 32321, 32323, 32327,
+  32341, 32353, 32359, 32363, 32369, 32371, 32377, 32381, 32401, 32411, 32413, 32423,
+  32429, 32441, 32443, 32467, 32479, 32491, 32497, 32503, 32507, 32531, 32533, 32537,
+  32561, 32563, 32569, 32573, 32579, 32587, 32603, 32609, 32611, 32621, 32633, 32647,
+  32653, 32687, 32693, 32707, 32713, 32717, 32719, 32749, 32771, 32779, 32783, 32789,
+  32797, 32801, 32803, 32831, 32833, 32839, 32843, 32869, 32887, 32909, 32911, 32917,
+  32933, 32939, 32941, 32957, 32969, 32971, 32983, 32987, 32993, 32999, 33013, 33023,
+  33029, 33037, 33049, 33053, 33071, 33073, 33083, 33091, 33107, 33113, 33119, 33149,
+  33151, 33161, 33179, 33181, 33191, 33199, 33203, 33211, 33223, 33247, 33287, 33289,
+  33301, 33311, 33317, 33329, 33331, 33343, 33347, 33349, 33353, 33359, 33377, 33391,
+  33403, 33409, 33413, 33427, 33457, 33461, 33469, 33479, 33487, 33493, 33503, 33521,
+  33529, 33533, 33547, 33563, 33569, 33577, 33581, 33587, 33589, 33599, 33601, 33613,
+  33617, 33619, 33623, 33629, 33637, 33641, 33647, 33679, 33703, 33713, 33721, 33739,
+  33749, 33751, 33757, 33767, 33769, 33773, 33791, 33797, 33809, 33811, 33827, 33829,
+  33851, 33857, 33863, 33871, 33889, 33893, 33911, 33923, 33931, 33937, 33941, 33961,
+  33967, 33997, 34019, 34031, 34033, 34039, 34057, 34061, 34123, 34127, 34129, 34141,
+  34147, 34157, 34159, 34171, 34183, 34211, 34213, 34217, 34231, 34253, 34259, 34261,
+  34267, 34273, 34283, 34297, 34301, 34303, 34313, 34319, 34327, 34337, 34351, 34361,
+  34367, 34369, 34381, 34403, 34421, 34429, 34439, 34457, 34469, 34471, 34483, 34487,
+  34499, 34501, 34511, 34513, 34519, 34537, 34543, 34549, 34583, 34589, 34591, 34603,
+  34607, 34613, 34631, 34649, 34651, 34667, 34673, 34679, 34687, 34693, 34703, 34721,
+  34729, 34739, 34747, 34757, 34759, 34763, 34781, 34807, 34819, 34841, 34843, 34847,
+  34849, 34871, 34877, 34883, 34897, 34913, 34919, 34939, 34949, 34961, 34963, 34981,
+  35023, 35027, 35051, 35053, 35059, 35069, 35081, 35083, 35089, 35099, 35107, 35111,
+  35117, 35129, 35141, 35149, 35153, 35159, 35171, 35201, 35221, 35227, 35251, 35257,
+  35267, 35279, 35281, 35291, 35311, 35317, 35323, 35327, 35339, 35353, 35363, 35381,
+  35393, 35401, 35407, 35419, 35423, 35437, 35447, 35449, 35461, 35491, 35507, 35509,
+  35521, 35527, 35531, 35533, 35537, 35543, 35569, 35573, 35591, 35593, 35597, 35603,
+  35617, 35671, 35677, 35729, 35731, 35747, 35753, 35759, 35771, 35797, 35801, 35803,
+  35809, 35831, 35837, 35839, 35851, 35863, 35869, 35879, 35897, 35899, 35911, 35923,
+  35933, 35951, 35963, 35969, 35977, 35983, 35993, 35999, 36007, 36011, 36013, 36017,
+  36037, 36061, 36067, 36073, 36083, 36097, 36107, 36109, 36131, 36137, 36151, 36161,
+  36187, 36191, 36209, 36217, 36229, 36241, 36251, 36263, 36269, 36277, 36293, 36299,
+  36307, 36313, 36319, 36341, 36343, 36353, 36373, 36383, 36389, 36433, 36451, 36457,
+  36467, 36469, 36473, 36479, 36493, 36497, 36523, 36527, 36529, 36541, 36551, 36559,
+  36563, 36571, 36583, 36587, 36599, 36607, 36629, 36637, 36643, 36653, 36671, 36677,
+  36683, 36691, 36697, 36709, 36713, 36721, 36739, 36749, 36761, 36767, 36779, 36781,
+  36787, 36791, 36793, 36809, 36821, 36833, 36847, 36857, 36871, 36877, 36887, 36899,
+  36901, 36913, 36919, 36923, 36929, 36931, 36943, 36947, 36973, 36979, 36997, 37003,
+  37013, 37019, 37021, 37039, 37049, 37057, 37061, 37087, 37097, 37117, 37123, 37139,
+  37159, 37171, 37181, 37189, 37199, 37201, 37217, 37223, 37243, 37253, 37273, 37277,
+  37307, 37309, 37313, 37321, 37337, 37339, 37357, 37361, 37363, 37369, 37379, 37397,
+  37409, 37423, 37441, 37447, 37463, 37483, 37489, 37493, 37501, 37507, 37511, 37517,
+  37529, 37537, 37547, 37549, 37561, 37567, 37571, 37573, 37579, 37589, 37591, 37607,
+  37619, 37633, 37643, 37649, 37657, 37663, 37691, 37693, 37699, 37717, 37747, 37781,
+  37783, 37799, 37811, 37813, 37831, 37847, 37853, 37861, 37871, 37879, 37889, 37897,
+  37907, 37951, 37957, 37963, 37967, 37987, 37991, 37993, 37997, 38011, 38039, 38047,
+  38053, 38069, 38083, 38113, 38119, 38149, 38153, 38167, 38177, 38183, 38189, 38197,
+  38201, 38219, 38231, 38237, 38239, 38261, 38273, 38281, 38287, 38299, 38303, 38317,
+  38321, 38327, 38329, 38333, 38351, 38371, 38377, 38393, 38431, 38447, 38449, 38453,
+  38459, 38461, 38501, 38543, 38557, 38561, 38567, 38569, 38593, 38603, 38609, 38611,
+  38629, 38639, 38651, 38653, 38669, 38671, 38677, 38693, 38699, 38707, 38711, 38713,
+  38723, 38729, 38737, 38747, 38749, 38767, 38783, 38791, 38803, 38821, 38833, 38839,
+  38851, 38861, 38867, 38873, 38891, 38903, 38917, 38921, 38923, 38933, 38953, 38959,
+  38971, 38977, 38993, 39019, 39023, 39041, 39043, 39047, 39079, 39089, 39097, 39103,
+  39107, 39113, 39119, 39133, 39139, 39157, 39161, 39163, 39181, 39191, 39199, 39209,
+  39217, 39227, 39229, 39233, 39239, 39241, 39251, 39293, 39301, 39313, 39317, 39323,
+  39341, 39343, 39359, 39367, 39371, 39373, 39383, 39397, 39409, 39419, 39439, 39443,
+  39451, 39461, 39499, 39503, 39509, 39511, 39521, 39541, 39551, 39563, 39569, 39581,
+  39607, 39619, 39623, 39631, 39659, 39667, 39671, 39679, 39703, 39709, 39719, 39727,
+  39733, 39749, 39761, 39769, 39779, 39791, 39799, 39821, 39827, 39829, 39839, 39841,
+  39847, 39857, 39863, 39869, 39877, 39883, 39887, 39901, 39929, 39937, 39953, 39971,
+  39979, 39983, 39989, 40009, 40013, 40031, 40037, 40039, 40063, 40087, 40093, 40099,
+  40111, 40123, 40127, 40129, 40151, 40153, 40163, 40169, 40177, 40189, 40193, 40213,
+  40231, 40237, 40241, 40253, 40277, 40283, 40289, 40343, 40351, 40357, 40361, 40387,
+  40423, 40427, 40429, 40433, 40459, 40471, 40483, 40487, 40493, 40499, 40507, 40519,
+  40529, 40531, 40543, 40559, 40577, 40583, 40591, 40597, 40609, 40627, 40637, 40639,
+  40693, 40697, 40699, 40709, 40739, 40751, 40759, 40763, 40771, 40787, 40801, 40813,
+  40819, 40823, 40829, 40841, 40847, 40849, 40853, 40867, 40879, 40883, 40897, 40903,
+  40927, 40933, 40939, 40949, 40961, 40973, 40993, 41011, 41017, 41023, 41039, 41047,
+  41051, 41057, 41077, 41081, 41113, 41117, 41131, 41141, 41143, 41149, 41161, 41177,
+  41179, 41183, 41189, 41201, 41203, 41213, 41221, 41227, 41231, 41233, 41243, 41257,
+  41263, 41269, 41281, 41299, 41333, 41341, 41351, 41357, 41381, 41387, 41389, 41399,
+  41411, 41413, 41443, 41453, 41467, 41479, 41491, 41507, 41513, 41519, 41521, 41539,
+  41543, 41549, 41579, 41593, 41597, 41603, 41609, 41611, 41617, 41621, 41627, 41641,
+  41647, 41651, 41659, 41669, 41681, 41687, 41719, 41729, 41737, 41759, 41761, 41771,
+  41777, 41801, 41809, 41813, 41843, 41849, 41851, 41863, 41879, 41887, 41893, 41897,
+  41903, 41911, 41927, 41941, 41947, 41953, 41957, 41959, 41969, 41981, 41983, 41999,
+  42013, 42017, 42019, 42023, 42043, 42061, 42071, 42073, 42083, 42089, 42101, 42131,
+  42139, 42157, 42169, 42179, 42181, 42187, 42193, 42197, 42209, 42221, 42223, 42227,
+  42239, 42257, 42281, 42283, 42293, 42299, 42307, 42323, 42331, 42337, 42349, 42359,
+  42373, 42379, 42391, 42397, 42403, 42407, 42409, 42433, 42437, 42443, 42451, 42457,
+  42461, 42463, 42467, 42473, 42487, 42491, 42499, 42509, 42533, 42557, 42569, 42571,
+  42577, 42589, 42611, 42641, 42643, 42649, 42667, 42677, 42683, 42689, 42697, 42701,
+  42703, 42709, 42719, 42727, 42737, 42743, 42751, 42767, 42773, 42787, 42793, 42797,
+  42821, 42829, 42839, 42841, 42853, 42859, 42863, 42899, 42901, 42923, 42929, 42937,
+  42943, 42953, 42961, 42967, 42979, 42989, 43003, 43013, 43019, 43037, 43049, 43051,
+  43063, 43067, 43093, 43103, 43117, 43133, 43151, 43159, 43177, 43189, 43201, 43207,
+  43223, 43237, 43261, 43271, 43283, 43291, 43313, 43319, 43321, 43331, 43391, 43397,
+  43399, 43403, 43411, 43427, 43441, 43451, 43457, 43481, 43487, 43499, 43517, 43541,
+  43543, 43573, 43577, 43579, 43591, 43597, 43607, 43609, 43613, 43627, 43633, 43649,
+  43651, 43661, 43669, 43691, 43711, 43717, 43721, 43753, 43759, 43777, 43781, 43783,
+  43787, 43789, 43793, 43801, 43853, 43867, 43889, 43891, 43913, 43933, 43943, 43951,
+  43961, 43963, 43969, 43973, 43987, 43991, 43997, 44017, 44021, 44027, 44029, 44041,
+  44053, 44059, 44071, 44087, 44089, 44101, 44111, 44119, 44123, 44129, 44131, 44159,
+  44171, 44179, 44189, 44201, 44203, 44207, 44221, 44249, 44257, 44263, 44267, 44269,
+  44273, 44279, 44281, 44293, 44351, 44357, 44371, 44381, 44383, 44389, 44417, 44449,
+  44453, 44483, 44491, 44497, 44501, 44507, 44519, 44531, 44533, 44537, 44543, 44549,
+  44563, 44579, 44587, 44617, 44621, 44623, 44633, 44641, 44647, 44651, 44657, 44683,
+  44687, 44699, 44701, 44711, 44729, 44741, 44753, 44771, 44773, 44777, 44789, 44797,
+  44809, 44819, 44839, 44843, 44851, 44867, 44879, 44887, 44893, 44909, 44917, 44927,
+  44939, 44953, 44959, 44963, 44971, 44983, 44987, 45007, 45013, 45053, 45061, 45077,
+  45083, 45119, 45121, 45127, 45131, 45137, 45139, 45161, 45179, 45181, 45191, 45197,
+  45233, 45247, 45259, 45263, 45281, 45289, 45293, 45307, 45317, 45319, 45329, 45337,
+  45341, 45343, 45361, 45377, 45389, 45403, 45413, 45427, 45433, 45439, 45481, 45491,
+  45497, 45503, 45523, 45533, 45541, 45553, 45557, 45569, 45587, 45589, 45599, 45613,
+  45631, 45641, 45659, 45667, 45673, 45677, 45691, 45697, 45707, 45737, 45751, 45757,
+  45763, 45767, 45779, 45817, 45821, 45823, 45827, 45833, 45841, 45853, 45863, 45869,
+  45887, 45893, 45943, 45949, 45953, 45959, 45971, 45979, 45989, 46021, 46027, 46049,
+  46051, 46061, 46073, 46091, 46093, 46099, 46103, 46133, 46141, 46147, 46153, 46171,
+  46181, 46183, 46187, 46199, 46219, 46229, 46237, 46261, 46271, 46273, 46279, 46301,
+  46307, 46309, 46327, 46337, 46349, 46351, 46381, 46399, 46411, 46439, 46441, 46447,
+  46451, 46457, 46471, 46477, 46489, 46499, 46507, 46511, 46523, 46549, 46559, 46567,
+  46573, 46589, 46591, 46601, 46619, 46633, 46639, 46643, 46649, 46663, 46679, 46681,
+  46687, 46691, 46703, 46723, 46727, 46747, 46751, 46757, 46769, 46771, 46807, 46811,
+  46817, 46819, 46829, 46831, 46853, 46861, 46867, 46877, 46889, 46901, 46919, 46933,
+  46957, 46993, 46997, 47017, 47041, 47051, 47057, 47059, 47087, 47093, 47111, 47119,
+  47123, 47129, 47137, 47143, 47147, 47149, 47161, 47189, 47207, 47221, 47237, 47251,
+  47269, 47279, 47287, 47293, 47297, 47303, 47309, 47317, 47339, 47351, 47353, 47363,
+  47381, 47387, 47389, 47407, 47417, 47419, 47431, 47441, 47459, 47491, 47497, 47501,
+  47507, 47513, 47521, 47527, 47533, 47543, 47563, 47569, 47581, 47591, 47599, 47609,
+  47623, 47629, 47639, 47653, 47657, 47659, 47681, 47699, 47701, 47711, 47713, 47717,
+  47737, 47741, 47743, 47777, 47779, 47791, 47797, 47807, 47809, 47819, 47837, 47843,
+  47857, 47869, 47881, 47903, 47911, 47917, 47933, 47939, 47947, 47951, 47963, 47969,
+  47977, 47981, 48017, 48023, 48029, 48049, 48073, 48079, 48091, 48109, 48119, 48121,
+  48131, 48157, 48163, 48179, 48187, 48193, 48197, 48221, 48239, 48247, 48259, 48271,
+  48281, 48299, 48311, 48313, 48337, 48341, 48353, 48371, 48383, 48397, 48407, 48409,
+  48413, 48437, 48449, 48463, 48473, 48479, 48481, 48487, 48491, 48497, 48523, 48527,
+  48533, 48539, 48541, 48563, 48571, 48589, 48593, 48611, 48619, 48623, 48647, 48649,
+  48661, 48673, 48677, 48679, 48731, 48733, 48751, 48757, 48761, 48767, 48779, 48781,
+  48787, 48799, 48809, 48817, 48821, 48823, 48847, 48857, 48859, 48869, 48871, 48883,
+  48889, 48907, 48947, 48953, 48973, 48989, 48991, 49003, 49009, 49019, 49031, 49033,
+  49037, 49043, 49057, 49069, 49081, 49103, 49109, 49117, 49121, 49123, 49139, 49157,
+  49169, 49171, 49177, 49193, 49199, 49201, 49207, 49211, 49223, 49253, 49261, 49277,
+  49279, 49297, 49307, 49331, 49333, 49339, 49363, 49367, 49369, 49391, 49393, 49409,
+  49411, 49417, 49429, 49433, 49451, 49459, 49463, 49477, 49481, 49499, 49523, 49529,
+  49531, 49537, 49547, 49549, 49559, 49597, 49603, 49613, 49627, 49633, 49639, 49663,
+  49667, 49669, 49681, 49697, 49711, 49727, 49739, 49741, 49747, 49757, 49783, 49787,
+  49789, 49801, 49807, 49811, 49823, 49831, 49843, 49853, 49871, 49877, 49891, 49919,
+  49921, 49927, 49937, 49939, 49943, 49957, 49991, 49993, 49999, 50021, 50023, 50033,
+  50047, 50051, 50053, 50069, 50077, 50087, 50093, 50101, 50111, 50119, 50123, 50129,
+  50131, 50147, 50153, 50159, 50177, 50207, 50221, 50227, 50231, 50261, 50263, 50273,
+  50287, 50291, 50311, 50321, 50329, 50333, 50341, 50359, 50363, 50377, 50383, 50387,
+  50411, 50417, 50423, 50441, 50459, 50461, 50497, 50503, 50513, 50527, 50539, 50543,
+  50549, 50551, 50581, 50587, 50591, 50593, 50599, 50627, 50647, 50651, 50671, 50683,
+  50707, 50723, 50741, 50753, 50767, 50773, 50777, 50789, 50821, 50833, 50839, 50849,
+  50857, 50867, 50873, 50891, 50893, 50909, 50923, 50929, 50951, 50957, 50969, 50971,
+  50989, 50993, 51001, 51031, 51043, 51047, 51059, 51061, 51071, 51109, 51131, 51133,
+  51137, 51151, 51157, 51169, 51193, 51197, 51199, 51203, 51217, 51229, 51239, 51241,
+  51257, 51263, 51283, 51287, 51307, 51329, 51341, 51343, 51347, 51349, 51361, 51383,
+  51407, 51413, 51419, 51421, 51427, 51431, 51437, 51439, 51449, 51461, 51473, 51479,
+  51481, 51487, 51503, 51511, 51517, 51521, 51539, 51551, 51563, 51577, 51581, 51593,
+  51599, 51607, 51613, 51631, 51637, 51647, 51659, 51673, 51679, 51683, 51691, 51713,
+  51719, 51721, 51749, 51767, 51769, 51787, 51797, 51803, 51817, 51827, 51829, 51839,
+  51853, 51859, 51869, 51871, 51893, 51899, 51907, 51913, 51929, 51941, 51949, 51971,
+  51973, 51977, 51991, 52009, 52021, 52027, 52051, 52057, 52067, 52069, 52081, 52103,
+  52121, 52127, 52147, 52153, 52163, 52177, 52181, 52183, 52189, 52201, 52223, 52237,
+  52249, 52253, 52259, 52267, 52289, 52291, 52301, 52313, 52321, 52361, 52363, 52369,
+  52379, 52387, 52391, 52433, 52453, 52457, 52489, 52501, 52511, 52517, 52529, 52541,
+  52543, 52553, 52561, 52567, 52571, 52579, 52583, 52609, 52627, 52631, 52639, 52667,
+  52673, 52691, 52697, 52709, 52711, 52721, 52727, 52733, 52747, 52757, 52769, 52783,
+  52807, 52813, 52817, 52837, 52859, 52861, 52879, 52883, 52889, 52901, 52903, 52919,
+  52937, 52951, 52957, 52963, 52967, 52973, 52981, 52999, 53003, 53017, 53047, 53051,
+  53069, 53077, 53087, 53089, 53093, 53101, 53113, 53117, 53129, 53147, 53149, 53161,
+  53171, 53173, 53189, 53197, 53201, 53231, 53233, 53239, 53267, 53269, 53279, 53281,
+  53299, 53309, 53323, 53327, 53353, 53359, 53377, 53381, 53401, 53407, 53411, 53419,
+  53437, 53441, 53453, 53479, 53503, 53507, 53527, 53549, 53551, 53569, 53591, 53593,
+  53597, 53609, 53611, 53617, 53623, 53629, 53633, 53639, 53653, 53657, 53681, 53693,
+  53699, 53717, 53719, 53731, 53759, 53773, 53777, 53783, 53791, 53813, 53819, 53831,
+  53849, 53857, 53861, 53881, 53887, 53891, 53897, 53899, 53917, 53923, 53927, 53939,
+  53951, 53959, 53987, 53993, 54001, 54011, 54013, 54037, 54049, 54059, 54083, 54091,
+  54101, 54121, 54133, 54139, 54151, 54163, 54167, 54181, 54193, 54217, 54251, 54269,
+  54277, 54287, 54293, 54311, 54319, 54323, 54331, 54347, 54361, 54367, 54371, 54377,
+  54401, 54403, 54409, 54413, 54419, 54421, 54437, 54443, 54449, 54469, 54493, 54497,
+  54499, 54503, 54517, 54521, 54539, 54541, 54547, 54559, 54563, 54577, 54581, 54583,
+  54601, 54617, 54623, 54629, 54631, 54647, 54667, 54673, 54679, 54709, 54713, 54721,
+  54727, 54751, 54767, 54773, 54779, 54787, 54799, 54829, 54833, 54851, 54869, 54877,
+  54881, 54907, 54917, 54919, 54941, 54949, 54959, 54973, 54979, 54983, 55001, 55009,
+  55021, 55049, 55051, 55057, 55061, 55073, 55079, 55103, 55109, 55117, 55127, 55147,
+  55163, 55171, 55201, 55207, 55213, 55217, 55219, 55229, 55243, 55249, 55259, 55291,
+  55313, 55331, 55333, 55337, 55339, 55343, 55351, 55373, 55381, 55399, 55411, 55439,
+  55441, 55457, 55469, 55487, 55501, 55511, 55529, 55541, 55547, 55579, 55589, 55603,
+  55609, 55619, 55621, 55631, 55633, 55639, 55661, 55663, 55667, 55673, 55681, 55691,
+  55697, 55711, 55717, 55721, 55733, 55763, 55787, 55793, 55799, 55807, 55813, 55817,
+  55819, 55823, 55829, 55837, 55843, 55849, 55871, 55889, 55897, 55901, 55903, 55921,
+  55927, 55931, 55933, 55949, 55967, 55987, 55997, 56003, 56009, 56039, 56041, 56053,
+  56081, 56087, 56093, 56099, 56101, 56113, 56123, 56131, 56149, 56167, 56171, 56179,
+  56197, 56207, 56209, 56237, 56239, 56249, 56263, 56267, 56269, 56299, 56311, 56333,
+  56359, 56369, 56377, 56383, 56393, 56401, 56417, 56431, 56437, 56443, 56453, 56467,
+  56473, 56477, 56479, 56489, 56501, 56503, 56509, 56519, 56527, 56531, 56533, 56543,
+  56569, 56591, 56597, 56599, 56611, 56629, 56633, 56659, 56663, 56671, 56681, 56687,
+  56701, 56711, 56713, 56731, 56737, 56747, 56767, 56773, 56779, 56783, 56807, 56809,
+  56813, 56821, 56827, 56843, 56857, 56873, 56891, 56893, 56897, 56909, 56911, 56921,
+  56923, 56929, 56941, 56951, 56957, 56963, 56983, 56989, 56993, 56999, 57037, 57041,
+  57047, 57059, 57073, 57077, 57089, 57097, 57107, 57119, 57131, 57139, 57143, 57149,
+  57163, 57173, 57179, 57191, 57193, 57203, 57221, 57223, 57241, 57251, 57259, 57269,
+  57271, 57283, 57287, 57301, 57329, 57331, 57347, 57349, 57367, 57373, 57383, 57389,
+  57397, 57413, 57427, 57457, 57467, 57487, 57493, 57503, 57527, 57529, 57557, 57559,
+  57571, 57587, 57593, 57601, 57637, 57641, 57649, 57653, 57667, 57679, 57689, 57697,
+  57709, 57713, 57719, 57727, 57731, 57737, 57751, 57773, 57781, 57787, 57791, 57793,
+  57803, 57809, 57829, 57839, 57847, 57853, 57859, 57881, 57899, 57901, 57917, 57923,
+  57943, 57947, 57973, 57977, 57991, 58013, 58027, 58031, 58043, 58049, 58057, 58061,
+  58067, 58073, 58099, 58109, 58111, 58129, 58147, 58151, 58153, 58169, 58171, 58189,
+  58193, 58199, 58207, 58211, 58217, 58229, 58231, 58237, 58243, 58271, 58309, 58313,
+  58321, 58337, 58363, 58367, 58369, 58379, 58391, 58393, 58403, 58411, 58417, 58427,
+  58439, 58441, 58451, 58453, 58477, 58481, 58511, 58537, 58543, 58549, 58567, 58573,
+  58579, 58601, 58603, 58613, 58631, 58657, 58661, 58679, 58687, 58693, 58699, 58711,
+  58727, 58733, 58741, 58757, 58763, 58771, 58787, 58789, 58831, 58889, 58897, 58901,
+  58907, 58909, 58913, 58921, 58937, 58943, 58963, 58967, 58979, 58991, 58997, 59009,
+  59011, 59021, 59023, 59029, 59051, 59053, 59063, 59069, 59077, 59083, 59093, 59107,
+  59113, 59119, 59123, 59141, 59149, 59159, 59167, 59183, 59197, 59207, 59209, 59219,
+  59221, 59233, 59239, 59243, 59263, 59273, 59281, 59333, 59341, 59351, 59357, 59359,
+  59369, 59377, 59387, 59393, 59399, 59407, 59417, 59419, 59441, 59443, 59447, 59453,
+  59467, 59471, 59473, 59497, 59509, 59513, 59539, 59557, 59561, 59567, 59581, 59611,
+  59617, 59621, 59627, 59629, 59651, 59659, 59663, 59669, 59671, 59693, 59699, 59707,
+  59723, 59729, 59743, 59747, 59753, 59771, 59779, 59791, 59797, 59809, 59833, 59863,
+  59879, 59887, 59921, 59929, 59951, 59957, 59971, 59981, 59999, 60013, 60017, 60029,
+  60037, 60041, 60077, 60083, 60089, 60091, 60101, 60103, 60107, 60127, 60133, 60139,
+  60149, 60161, 60167, 60169, 60209, 60217, 60223, 60251, 60257, 60259, 60271, 60289,
+  60293, 60317, 60331, 60337, 60343, 60353, 60373, 60383, 60397, 60413, 60427, 60443,
+  60449, 60457, 60493, 60497, 60509, 60521, 60527, 60539, 60589, 60601, 60607, 60611,
+  60617, 60623, 60631, 60637, 60647, 60649, 60659, 60661, 60679, 60689, 60703, 60719,
+  60727, 60733, 60737, 60757, 60761, 60763, 60773, 60779, 60793, 60811, 60821, 60859,
+  60869, 60887, 60889, 60899, 60901, 60913, 60917, 60919, 60923, 60937, 60943, 60953,
+  60961, 61001, 61007, 61027, 61031, 61043, 61051, 61057, 61091, 61099, 61121, 61129,
+  61141, 61151, 61153, 61169, 61211, 61223, 61231, 61253, 61261, 61283, 61291, 61297,
+  61331, 61333, 61339, 61343, 61357, 61363, 61379, 61381, 61403, 61409, 61417, 61441,
+  61463, 61469, 61471, 61483, 61487, 61493, 61507, 61511, 61519, 61543, 61547, 61553,
+  61559, 61561, 61583, 61603, 61609, 61613, 61627, 61631, 61637, 61643, 61651, 61657,
+  61667, 61673, 61681, 61687, 61703, 61717, 61723, 61729, 61751, 61757, 61781, 61813,
+  61819, 61837, 61843, 61861, 61871, 61879, 61909, 61927, 61933, 61949, 61961, 61967,
+  61979, 61981, 61987, 61991, 62003, 62011, 62017, 62039, 62047, 62053, 62057, 62071,
+  62081, 62099, 62119, 62129, 62131, 62137, 62141, 62143, 62171, 62189, 62191, 62201,
+  62207, 62213, 62219, 62233, 62273, 62297, 62299, 62303, 62311, 62323, 62327, 62347,
+  62351, 62383, 62401, 62417, 62423, 62459, 62467, 62473, 62477, 62483, 62497, 62501,
+  62507, 62533, 62539, 62549, 62563, 62581, 62591, 62597, 62603, 62617, 62627, 62633,
+  62639, 62653, 62659, 62683, 62687, 62701, 62723, 62731, 62743, 62753, 62761, 62773,
+  62791, 62801, 62819, 62827, 62851, 62861, 62869, 62873, 62897, 62903, 62921, 62927,
+  62929, 62939, 62969, 62971, 62981, 62983, 62987, 62989, 63029, 63031, 63059, 63067,
+  63073, 63079, 63097, 63103, 63113, 63127, 63131, 63149, 63179, 63197, 63199, 63211,
+  63241, 63247, 63277, 63281, 63299, 63311, 63313, 63317, 63331, 63337, 63347, 63353,
+  63361, 63367, 63377, 63389, 63391, 63397, 63409, 63419, 63421, 63439, 63443, 63463,
+  63467, 63473, 63487, 63493, 63499, 63521, 63527, 63533, 63541, 63559, 63577, 63587,
+  63589, 63599, 63601, 63607, 63611, 63617, 63629, 63647, 63649, 63659, 63667, 63671,
+  63689, 63691, 63697, 63703, 63709, 63719, 63727, 63737, 63743, 63761, 63773, 63781,
+  63793, 63799, 63803, 63809, 63823, 63839, 63841, 63853, 63857, 63863, 63901, 63907,
+  63913, 63929, 63949, 63977, 63997, 64007, 64013, 64019, 64033, 64037, 64063, 64067,
+  64081, 64091, 64109, 64123, 64151, 64153, 64157, 64171, 64187, 64189, 64217, 64223,
+  64231, 64237, 64271, 64279, 64283, 64301, 64303, 64319, 64327, 64333, 64373, 64381,
+  64399, 64403, 64433, 64439, 64451, 64453, 64483, 64489, 64499, 64513, 64553, 64567,
+  64577, 64579, 64591, 64601, 64609, 64613, 64621, 64627, 64633, 64661, 64663, 64667,
+  64679, 64693, 64709, 64717, 64747, 64763, 64781, 64783, 64793, 64811, 64817, 64849,
+  64853, 64871, 64877, 64879, 64891, 64901, 64919, 64921, 64927, 64937, 64951, 64969,
+  64997, 65003, 65011, 65027, 65029, 65033, 65053, 65063, 65071, 65089, 65099, 65101,
+  65111, 65119, 65123, 65129, 65141, 65147, 65167, 65171, 65173, 65179, 65183, 65203,
+  65213, 65239, 65257, 65267, 65269, 65287, 65293, 65309, 65323, 65327, 65353, 65357,
+  65371, 65381, 65393, 65407, 65413, 65419, 65423, 65437, 65447, 65449, 65479, 65497,
+  65519, 65521
+};
+
+#if (GMP_NUMB_BITS == 64)
+static const mp_limb_t primesProducts[] = {
+  0x6329899EA9F2714B, 0x58EDCB4C9ED39C8B, 0x09966FF94FD516FB, 0x3BD7632C1F36EB51,
+  0x00FD14B3C90D88A9, 0x02AD3DBE0CCA85FF, 0x0787F9A02C3388A7, 0x1113C5CC6D101657,
+  0x2456C94F936BDB15, 0x4236A30B85FFE139, 0x805437B38EADA69D, 0x00723E97BDDCD2AF,
+  0x00A5A792EE239667, 0x00E451352EBCA269, 0x013A7955F14B7805, 0x01D37CBD653B06FF,
+  0x0288FE4ECA4D7CDF, 0x039FDDB60D3AF63D, 0x04CD73F19080FB03, 0x0639C390B9313F05,
+  0x08A1C420D25D388F, 0x0B4B5322977DB499, 0x0E94C170A802EE29, 0x11F6A0E8356100DF,
+  0x166C8898F7B3D683, 0x1BABDA0A0AFD724B, 0x2471B07C44024ABF, 0x2D866DBC2558AD71,
+  0x3891410D45FB47DF, 0x425D5866B049E263, 0x51F767298E2CF13B, 0x6D9F9ECE5FC74F13,
+  0x7F5FFDB0F56EE64D, 0x943740D46A1BC71F, 0xAF2D7CA25CEC848F, 0xCEC010484E4AD877,
+  0xEF972C3CFAFBCD25, 0x002A442C1EBB3BE5, 0x00303FA164BDC919, 0x0036521CA14FD8E7,
+  0x003CA3241ED069E3, 0x0043885D3035C59B, 0x004E1AEE1FA9D559, 0x0054469DBE5D6C77,
+  0x005E49791F7429A1, 0x006B2CEDA4198E53, 0x007339D26E3D1CE3, 0x007E2EE3B8AA6BF3,
+  0x008AE9BB5CDA9301, 0x0096E917373CDCA7, 0x00A211E4FECDF953, 0x00B8FF2EFB3033CF,
+  0x00CBACA970BDFE31, 0x00DB2C9F75B49027, 0x00ED9FB524FE759D, 0x01007595A2312FC7,
+  0x0111ECCD0898675F, 0x012546177B06C0BF, 0x013E5B450710A16F, 0x0164D74C38C8E863,
+  0x01836887063C20BB, 0x01AB250719364C7B, 0x01D1D99745C88D5B, 0x01EC730B953D1A27,
+  0x02021F7B6341A9AB, 0x021E792F0D4CA61D, 0x0249015C16A93885, 0x026F0F9A480C48E5,
+  0x029BC3143B9A5A89, 0x02D26ABB44109333, 0x030A7492F008069D, 0x0343B19B9EDC33A7,
+  0x0385A3FB2C68B433, 0x03C555B3DBE9EF83, 0x0411E43A3A8D394B, 0x04775710B7A55833,
+  0x04B76972A22D55A1, 0x0507BFE226EE0079, 0x056A838DEE32FFF3, 0x05AC8589165200E9,
+  0x05F667749EB2F963, 0x065DD3FC17E3C099, 0x06E031D955A9FEF9, 0x0742EC64B53BFDFF,
+  0x07A5CBCB6BAE243D, 0x07F7FCB28A3D7137, 0x086BE427BF5DE82D, 0x08D9CA434D0399A5,
+  0x09638C123BCAB351, 0x09DB5CDD2505EABD, 0x0A7882EA2D1E207F, 0x0B1A70A51FBA0B75,
+  0x0BBABEB6F4CC2177, 0x0C68A56113938121, 0x0CE86607DEDDBE4B, 0x0DACA6D46347064F,
+  0x0E6F9CB2334EC11F, 0x0F25AC800485A171, 0x0FF8F0253A89A32D, 0x10CCEDF304C329C1,
+  0x11BAB365A0306AD1, 0x12BC79F95534C5D9, 0x136918855651CAE7, 0x1441022B5202F195,
+  0x1597271595CAF351, 0x16D6D391503C0ABB, 0x180C60C57C2AA2EB, 0x1931ED2425952793,
+  0x1A4AD806A56DA143, 0x1BAB1DCC65AC15DB, 0x1D309FB6E722F0E1, 0x1E414485A1B107BF,
+  0x1F9AA68DF17C076B, 0x212B81780B580E97, 0x23006478F7A04647, 0x244664B9E9752837,
+  0x26CB4C8923562F31, 0x2885C6C7B07C160F, 0x29CDB8DBE624C3C1, 0x2B4A321722F3B1EF,
+  0x2CA3B94E7373F36D, 0x2EFA302D0838FAD3, 0x30B3FDB20C872A5B, 0x33591223FEFD974B,
+  0x35C12A863F50EAA9, 0x383533808BD74477, 0x3AC02A15FC89C54D, 0x3E12CC83606624F3,
+  0x405F92575CD90B87, 0x42211307D533E619, 0x44B8A22C7F3DF3C3, 0x46D3DCA711BBAEC5,
+  0x49A4F62F2BEE3201, 0x4D746A3FDA9D6EC3, 0x5024BB19621CEAC3, 0x528D8D1989F23337,
+  0x55B4C3F0688FA659, 0x599291B29311407F, 0x5CC7A1B4F6DF9823, 0x5F42CBFA215AB3FD,
+  0x616DB4FE760C22B9, 0x65AD151B5817DA41, 0x6C2E75F079F3DEEF, 0x706DD813A4085937,
+  0x73EDC48854FAA299, 0x77F1E576FFED49B9, 0x7CC13FE542982693, 0x80CEDB56D0C02049,
+  0x858F4783E6FF5CF3, 0x892E6D86008F82E3, 0x8D040C52D7C6AB79, 0x90B53592209DA955,
+  0x954FB9D96AB9EA1D, 0x9CAF15AF4CE7FCF7, 0xA47DBF171698939F, 0xA9712F0456E54591,
+  0xAEED828A42377403, 0xB68603F5EADB8545, 0xBB2BD5D42428B71D, 0xC165B45B4E412E49,
+  0xC8348A8471E75CA3, 0xCE5AB711E7179571, 0xD4287981935F5B7F, 0xDB9C1EFF1B938A91,
+  0xE2E20AFC369136FF, 0xE78C749D7A119695, 0xEDFA86764FA767E1, 0xF7780828D01FCEF9,
+  0x0009311DA8EB3EA1, 0x00096FC1B51999B5, 0x00099D2DC5AA820B, 0x0009C18C1A21F755,
+  0x000A019A0D84CE05, 0x000A3837104AF50B, 0x000A74BA276E925B, 0x000AD0C05B3AE661,
+  0x000B0DA5211CC3E7, 0x000B36CA8C3991AF, 0x000B6694790C60DF, 0x000B89A345C48D7D,
+  0x000BB02A8B8A132B, 0x000BD6468BB171FF, 0x000C17671B548641, 0x000C57F07D496E1B,
+  0x000C814B88200AC3, 0x000CB958BA8E9259, 0x000CFAA956D67517, 0x000D56380A0E8273,
+  0x000D9C8B65D94F5B, 0x000DC90A482DEBCB, 0x000E0AC9922E6235, 0x000E4AA6969C4449,
+  0x000EB0CA4D2B0965, 0x000F08C969789D43, 0x000F3C97C77C730F, 0x000F7AA31273931B,
+  0x000FD32E0BAE7A77, 0x00102419FDA6CC01, 0x001058B57CD1FEC9, 0x0010A468AC696A55,
+  0x0010D824894D6521, 0x001131219641C957, 0x001186346CB9C4A7, 0x0011E75887C6BCBF,
+  0x001226C3D8919AD3, 0x0012AE54CA9118B3, 0x0012F2143DDEB927, 0x0013522200CAEEB3,
+  0x0013A21AD000A461, 0x0013EF7C7F69A93D, 0x001436A05EF17841, 0x00147142F4CC4C17,
+  0x0014B887295EC96D, 0x001501B9FE3EFAAD, 0x00156D3EBD5CFFFB, 0x0015AF86361077AD,
+  0x0015FC898C07B90F, 0x00167C836A7CDF2B, 0x0016DB56BC574209, 0x00174097DE2EDF3B,
+  0x00178DBDB0CFB9FB, 0x0017E109FD2AF3FB, 0x0018716ADBB946F7, 0x0018D7BC2E97EAEF,
+  0x00192E69D59BA8DB, 0x00198A3CDDB561C9, 0x0019E876C274E4FD, 0x001A63555C2E680B,
+  0x001AD58F177DACBB, 0x001B29F0DB4B3395, 0x001BA4B691E66139, 0x001BFC87FC12613D,
+  0x001C3E250DAC9D87, 0x001C944C9149DF3B, 0x001CFF79F4C205CD, 0x001D75566CB1ADB3,
+  0x001E3CD7B5975575, 0x001E92A4033B7417, 0x001F0502CB33D8C7, 0x001F8943169B2D87,
+  0x001FFCAEBC1A4BAD, 0x0020730086C8CB89, 0x0020D7B89585D217, 0x002147BFE14A8231,
+  0x0021AE6440D699BF, 0x0022306F8188C6FB, 0x0022A5AF39A69703, 0x00235EEDC5DE5805,
+  0x002441E04BA35085, 0x0024B8A97A3A59A5, 0x00252362655A4D67, 0x0025AB86B8CC3567,
+  0x00260AEA245BC247, 0x0026B855F8B70077, 0x002750993DD1E65B, 0x0027BAFA8C9F7853,
+  0x0028402B9D2D22DD, 0x0028A66D2D4FC087, 0x00298166C0739B53, 0x002A40D5220CBED9,
+  0x002AB7670BBAB197, 0x002B5B38F61706DF, 0x002C3429FA1E037F, 0x002CEDA9FA3B4A9F,
+  0x002D7B4D561F2739, 0x002E05D3CAAE9813, 0x002EB7851A14C29B, 0x002F3E1D077D25CF,
+  0x003010F41DBEB6ED, 0x00311729B61DD159, 0x00318DCEB77A5837, 0x00321CD33785CDF1,
+  0x0032FDF49691BC63, 0x0033B1C5F5F30CED, 0x0034A6C59CB6D8D7, 0x00355C9029E55DD3,
+  0x0035FB2D1AC371B7, 0x0036B44BC2249A47, 0x003750E273F3B60F, 0x00385CE9399C0F85,
+  0x00391ECBD93A9E67, 0x0039CD91131EE8E5, 0x003A887D9033256B, 0x003B77F83E7B7B77,
+  0x003C5F7ED2ECA1BF, 0x003D367FEEC26269, 0x003DEBDB2F48A479, 0x003EAB0AFE5D537B,
+  0x003FD435F4D431E7, 0x0040B45FF452CB31, 0x00420775FBCEAF6D, 0x0042C7627AEFC08D,
+  0x0043E44DCC615D67, 0x0044C330CDFDEB7D, 0x00456AF335C23B75, 0x004610D2C7C0027B,
+  0x0047384E9BF4BFAD, 0x0047FA259C013BA3, 0x0048950FC7F50B43, 0x004956836A576163,
+  0x004A7B8C3C557B65, 0x004B771E5DB917EF, 0x004C5834105E9DFB, 0x004D37DF06EC25D9,
+  0x004E3707BF47ECA5, 0x004F77E5A59CEEA7, 0x00503CED574122D5, 0x0050F93A4E9E43E9,
+  0x005242764CB96DBF, 0x005373FF17A4F379, 0x00544AC8E491C7D9, 0x005534B35CC8F027,
+  0x0056405CD1D8F29B, 0x0056EE39496A06DD, 0x0057CF4552F1E303, 0x0058B59C4B50C127,
+  0x0059A507C3DBF24B, 0x005A92A6FBEA27B9, 0x005B7E66124AC799, 0x005CAB65D44446EF,
+  0x005DE6905C90B503, 0x005F37E803C461FD, 0x0060383597FE3F4F, 0x0061E147BD94922B,
+  0x0062CB93E709F30F, 0x0063BB5109DDBB39, 0x0064B4CCD52A2A97, 0x0065A00FB544939D,
+  0x0066BD48D7520557, 0x00684AC380BF1AAF, 0x006975D3E0FB99E1, 0x006A96FAD34EB5C9,
+  0x006B9092527DE0B5, 0x006CFDA2F8B38F6F, 0x006E72811AACAEAB, 0x006FD5B0D3D77CA9,
+  0x00710C5F58855659, 0x0072C045F81A9571, 0x00740178628C8D1F, 0x007518D8F35A1EE9,
+  0x0076A24BC5928FC9, 0x00788A7D5FA3BC21, 0x007A0A454DDC12D9, 0x007B9B6DBF0ACBFB,
+  0x007CB724B29C97E9, 0x007D80316C3AEA0B, 0x007E9F02956774F9, 0x007FD78FF30E55DD,
+  0x008176F93DCDEE1B, 0x0083328F181F37FF, 0x00844C85844F1EC7, 0x00854FB5954CD2E9,
+  0x00871EE1F72316ED, 0x0088F30D5A797DC9, 0x008A8F2C1377C21D, 0x008C01286E805837,
+  0x008E7712E261C25D, 0x008FFB253EF4179F, 0x00921FBE50FEEF75, 0x00948A2D689DCCF3,
+  0x0095FFE36390E923, 0x0098301D5150C82F, 0x009965CA922EDA71, 0x009A81DF9EEC8585,
+  0x009C4FF7CEB26E9D, 0x009E7B7D2E8D6945, 0x009F6C20CFEC7617, 0x00A1123741D60349,
+  0x00A2D85D546633E9, 0x00A4576A38B2E863, 0x00A67B26CFFF14D5, 0x00A7A939B6101C2D,
+  0x00A8BB9C6B89238B, 0x00AA21A4D7B7405D, 0x00ABDD00AD8A3843, 0x00AD89BEAFBCECF3,
+  0x00AF157A9999DE1F, 0x00B1110EDEC9A5E7, 0x00B2EC08779AF98F, 0x00B5CE53E09D2F3F,
+  0x00B7C5C4781D9095, 0x00B96F6C6A96ABDD, 0x00BAFC6885E3168F, 0x00BD0B3001C2AB99,
+  0x00BF1E4F7B977DA3, 0x00C0EE974C1790EF, 0x00C212689F25E9F9, 0x00C38C7410BF9F6D,
+  0x00C53D3B77E95EC1, 0x00C6D6676A24B785, 0x00C8DC92EB084079, 0x00CAB7C97E4138B7,
+  0x00CCB801FCA0605B, 0x00CF6D7CDE4092FB, 0x00D18469C261E6C3, 0x00D3B42996B0BDB9,
+  0x00D51DDDE8B08F41, 0x00D67B51630925A1, 0x00D99E59550F2A79, 0x00DAD6953D7F1DD1,
+  0x00DCAD7B308DA3E5, 0x00DE2292A6FCEA5D, 0x00E1B23855987DB9, 0x00E334F8B6AFDF7F,
+  0x00E50A7B9858495B, 0x00E7E682B8BF2479, 0x00EB233492811E73, 0x00ECD06546792379,
+  0x00EE614FD24F6A7B, 0x00F075D4FEDAFF7F, 0x00F3F7D1DD9B8379, 0x00F634C782B06375,
+  0x00F85E2EFE701057, 0x00FC35555B41ED55, 0x00FE88C851DF5E87, 0x010178B05712FDAB,
+  0x01037C79874034CF, 0x0105B3F595BFC677, 0x0108BBDD3E80D6E1, 0x010B6784171F41E3,
+  0x010EBED7B345C171, 0x0110DEC33752E3FB, 0x0112F95DF390C71B, 0x0115857CB9505C11,
+  0x011896B488206DDD, 0x011C980326AA39B7, 0x011FAF4AB1583FD9, 0x01220BAFFBB4EC13,
+  0x01242DEDEE2CF32B, 0x0127288318F1ACBF, 0x0129A270B7054FD5, 0x012B5A5AB872CDBB,
+  0x012E62CC7D0C5137, 0x013143B94B078845, 0x0135191659B6B873, 0x01371E6D3F15A77B,
+  0x013AE591040C738B, 0x013EC8D38CF64EAB, 0x014109A378F8E2A9, 0x0143E60BE9B7A323,
+  0x0145A782E07019DD, 0x014851F13198D22F, 0x014B448A295B1A93, 0x014CF066CC1EDA97,
+  0x01509B6A2D694463, 0x0153888C5514C6BF, 0x01560307D2667EAB, 0x015A1186EBACA99F,
+  0x015D54D0562DA4A1, 0x016089DF1DBD1C67, 0x01640C263DE87B6B, 0x0167BE6AE7200D73,
+  0x016B77F2CF3A4D03, 0x016E09542573E129, 0x01707E77C14553E1, 0x017336530B2481CD,
+  0x0176BBCD2B4DE353, 0x017971F613E8E371, 0x017CED5A3630BB53, 0x017FABF200521269,
+  0x01826E128127B82F, 0x0186305EA4FF0FE3, 0x0188B968D29EE5C1, 0x018B8812E2614827,
+  0x018E9D947C879FB1, 0x0191690BBB2B8975, 0x0195526AF351EAC3, 0x0198DCB201AFA47F,
+  0x019B71865D1E1EDF, 0x019EC0FBAD93D86F, 0x01A266B389D857F5, 0x01A61DE64DE776A1,
+  0x01ABB0F12D9694B9, 0x01B11732D0B9014F, 0x01B4E781862FADAB, 0x01B8A6265810186F,
+  0x01BC8F38B80FB199, 0x01C3D614A01EDFFB, 0x01C7A111BA35AAC9, 0x01CCDA1918D36DF1,
+  0x01D1309B2051B287, 0x01D5A81D615749B9, 0x01D9827A0E604545, 0x01DED6186CACF0D7,
+  0x01E3263DBB001387, 0x01E639E9F683F351, 0x01EA1481CF59A2D1, 0x01EE85125A17F4D3,
+  0x01F5289E1464E911, 0x01F80F97A33BC0D9, 0x01FA2467E7455179, 0x01FCA5CF98EEC3B1,
+  0x01FF0ECAB9E59FE5, 0x02026CA9626F9BFD, 0x0206DEA1A602EF35, 0x020A61C911337F61,
+  0x02106F2B1309F57F, 0x0216DED5B9EC5121, 0x021ABC8524A0867F, 0x021DF720DA2D9D25,
+  0x0222C0B0BB7A24CF, 0x0227842C29F87A33, 0x022C07DAF1CAEC59, 0x0230DAE199D4B645,
+  0x0234EAFD67C98F85, 0x023834E8B38660E1, 0x023BDA2835948899, 0x024042E3FA45C223,
+  0x0244FC4333CFB5B3, 0x0247FEE86550E3AF, 0x024B6CF30EA5FD81, 0x0250829B6A84C113,
+  0x0255BF2F2306C361, 0x025C535AA7F5E583, 0x026080CA5A7BF2EB, 0x02637FDB127B46FF,
+  0x026797CCF79C7F3B, 0x026D1A1CCCC73C99, 0x0272C5771DB4D6D3, 0x0277ECDBC181828F,
+  0x027CDCB2258487A3, 0x0283732B66CF18C7, 0x028A8713FD082D71, 0x028FC3A0A032E5D7,
+  0x0292DED2E441DA69, 0x0297121FC782B77D, 0x029F0449CC9FF6F9, 0x02A4A2F14E2C958B,
+  0x02A8DB4D5B0FDA85, 0x02AE03469A82A673, 0x02B332B7DC69B1C1, 0x02B5E6B09D249FCB,
+  0x02BC0F821CC8C845, 0x02C276373272A055, 0x02C74AC5C4B2774D, 0x02CB22171DA031A7,
+  0x02CF6579F5C55F35, 0x02D705E1BDB390BD, 0x02DDBF17895A6381, 0x02E3AEFE09C42DE5,
+  0x02E8206F28D20955, 0x02ED7F117B2327DF, 0x02F56ED0C704DA69, 0x02F88A12F25E2451,
+  0x02FD131B841B40B1, 0x0301A1A0B3902EA9, 0x03055925FC58D879, 0x0309DE5CADBCA4E3,
+  0x0310CBCFD2B0891B, 0x0317FD19F60C9A4D, 0x031CCF9AF41EC199, 0x03229C99F241A3A7,
+  0x03280009DB526951, 0x032C8613ECCACE03, 0x0333D47383A88D7B, 0x033B696BAF7C3B81,
+  0x0341C21D06927029, 0x03463CCA1724EA87, 0x034AF6AFA696DB8B, 0x034FA2000C8B112D,
+  0x03548D7A1E704565, 0x0358B871E1453919, 0x03612D7FB9AB9847, 0x0369DBB728A0B841,
+  0x036CD818CC2E1D29, 0x03752221DD54D4EF, 0x037BF7FB5FB2FF1F, 0x0383A4CAED84EC9F,
+  0x0389EAA5E65BFE1B, 0x0391ECBFB00EE5ED, 0x0397DD4CA7C7FF7F, 0x039FE1DBF447811F,
+  0x03A5CEE3A2607503, 0x03ACAC3998E6D409, 0x03B13E26015D5ACB, 0x03B5E9ABE9445BB7,
+  0x03BC87C44EF9F2C5, 0x03C3C5B7F6157B81, 0x03CB65B47F066D95, 0x03D3D5D109D15D57,
+  0x03DB4BE06422BB69, 0x03E33B83348942E9, 0x03E737EE74BA429D, 0x03EB4DA6A8FA5C67,
+  0x03EF5031B4A64AFF, 0x03F78B5F10A31A23, 0x040044E6E9DF0BB1, 0x0405AC465F11236F,
+  0x040F4A65869D592B, 0x0416BAE1B618A8E1, 0x041C7E2175EEB881, 0x042474524212FCC1,
+  0x043035434B149AEB, 0x043BF75CAFFFC64F, 0x0443EC2284E30C93, 0x04481A26B0B4A839,
+  0x044E41154DBB09FD, 0x04534E9617C28679, 0x045B337D4D5597B9, 0x04629139384ABF75,
+  0x046A8B710C183935, 0x04708DBE7550D787, 0x04783847CD1F9BE3, 0x047F0E02D972ED25,
+  0x048525846D30850F, 0x048A62FB62958BAF, 0x04951DAC5BFC2C2B, 0x049BAFF49DD1395D,
+  0x04A1CAF7E8AF85B9, 0x04A91C809AFBF3BD, 0x04AE5FAD1E34A8BF, 0x04B241C33541FC09,
+  0x04BA406302AA23C5, 0x04C2B08C52443CBD, 0x04CADE5E4EF71C2F, 0x04DA04BDD8627DED,
+  0x04E5315AF79BA153, 0x04ECD20879E358D7, 0x04F42BC5897EA255, 0x04FE0ED11AAC86AF,
+  0x0506888972068255, 0x05112889CF60E287, 0x051ED3C0C55D0405, 0x052792AAB8B41B8D,
+  0x05329DF7DA95E2CF, 0x053CA69E541E15A5, 0x05464E0045860F6B, 0x054EEAF49A03E005,
+  0x055954A13D821DDB, 0x05629617909D1CCB, 0x056972A7C7CBBA43, 0x057491E36248A513,
+  0x058051ADFC3BEC21, 0x05886B3E3C8CD9C9, 0x05908DC3FDED79E1, 0x0599DBF2A16DE5BD,
+  0x05A2FC0748851A6D, 0x05ADFD2D9FDEE11D, 0x05B60DEF667A0FB9, 0x05BDCE2EACE2B75B,
+  0x05C8BB1C839FF683, 0x05D231DC198F1875, 0x05D9D1B5DC5E8D9F, 0x05EAF0A230B22005,
+  0x05F30502C290B0A9, 0x05F9D0E54C6A4117, 0x060231A8BE86C16F, 0x060ABA05F0DBFD6D,
+  0x061632FF9C470DEF, 0x061F2DFA454376FF, 0x0629C973F7AC0095, 0x063492798845B205,
+  0x064027252C0E1469, 0x0647B3D0049DB59B, 0x065124CD727A8597, 0x065A00ED27265351,
+  0x06646784A070A66B, 0x067285A1F9072BBF, 0x067BA4BB61B64513, 0x0684EEAB37910A39,
+  0x068EE60ABFB360BD, 0x0698657A2E761AC9, 0x06A18B98618E9DDB, 0x06ABC52AEDAEB23D,
+  0x06B7BC304578A6C5, 0x06C0C02E48FCF58F, 0x06C9467D22461B09, 0x06D5CAA4124B2953,
+  0x06E34DB23F109EEF, 0x06F1D49CE730CB7D, 0x06FF5F5416393A93, 0x0709BF8D69085151,
+  0x070F27D3BACD0F31, 0x07144DCCF94D4105, 0x071EE789A0A32A21, 0x072D634246A579F1,
+  0x0737462BB96E8FA5, 0x07405F283B642771, 0x074B06CDD98B2DA3, 0x07552BFBDF57E395,
+  0x07609DCCAA8AD539, 0x076DA8D969C008AB, 0x0775AFFD2B471325, 0x077F705C488C0067,
+  0x07923231ED9BCCBF, 0x07A2F068C5B37579, 0x07AD4BE7563471C9, 0x07B8D989812915E1,
+  0x07CD7C923B55EF0D, 0x07DA107B9D77D701, 0x07E5F69CDC834FC7, 0x07F3B0ACD71DBB55,
+  0x07FF8DEED331654D, 0x0810B32FA0809EEB, 0x082133690C7663FB, 0x082D436D737E0E43,
+  0x0838514396A42251, 0x083ED920A3C25B47, 0x0847124796F30FBB, 0x084DF13EBD3538DD,
+  0x0859E3C5FBD6E1DD, 0x086AFB9927BB2323, 0x0876E650D72E9C91, 0x0880878DF71EFEE5,
+  0x088DC919E33FAADF, 0x089BE30A3C1550F7, 0x08A66DD76A1C60A1, 0x08B2BF40D71AD8C9,
+  0x08C4D8ED4609F921, 0x08D70D8938E6B855, 0x08E4DDC1AD35D0A9, 0x08F11F02FBFEC4A1,
+  0x0906870CB12B0519, 0x09104E69442A8CB9, 0x091E0C440E516489, 0x092D55AF4933D6E7,
+  0x0938105D2262175D, 0x0941D56B0465F463, 0x094B227EE9ADA823, 0x095320FF468B4333,
+  0x095C258661C7E56B, 0x0966B2CC6595B7C5, 0x0973FAE5EF6BCA33, 0x09815126D1C98139,
+  0x098EB5A020A4D6B3, 0x099DB10D83DE0847, 0x09AADB69DA0214E9, 0x09B973FBFC7D90DF,
+  0x09CDD1B23230138B, 0x09D9CA4999F21551, 0x09EADC4431AF0B85, 0x09FE208A9B5975B9,
+  0x0A08AE56CD1F05D9, 0x0A14DBE044BC968B, 0x0A2003EDA8BED3A1, 0x0A31CC37F97E0A49,
+  0x0A40FC81B5AF1213, 0x0A4F29108D61FE95, 0x0A5C21788F7D9B31, 0x0A675615F79BD38D,
+  0x0A751EB13C4D642D, 0x0A8B5C2842CB1BD9, 0x0A9D245C82C7E0BF, 0x0AA9A8768636BFF3,
+  0x0ABA4AAB66D9C3D3, 0x0ACBBE6D193C87D3, 0x0AE046D4CB540DFB, 0x0AF5DC5C08F0B8CD,
+  0x0B064652F3D0AE53, 0x0B12C5DD98F8B673, 0x0B262C03F517C40B, 0x0B3D5033FCFCF135,
+  0x0B5181F699C1E587, 0x0B62527E162DED35, 0x0B6B6F6EA453B007, 0x0B7844A668B3D19B,
+  0x0B8813B13DE1F9D1, 0x0B97C048948BC509, 0x0BA7E24057EE9BCD, 0x0BB8AD133ED044CF,
+  0x0BCABAAFABD0E6FD, 0x0BDF76C56A6992B9, 0x0BF5E9A67F6B7C45, 0x0C0401BE20D91BCD,
+  0x0C1460092AFBF4A7, 0x0C26D6A65F868769, 0x0C3E4C684A0DF1BB, 0x0C4D0D11F2A55C53,
+  0x0C58F921CDB0E5B3, 0x0C70173703FF0C97, 0x0C832CB78CE310DF, 0x0C904AFB2B7FC7B1,
+  0x0C9A5074B1BBA0E1, 0x0CAE6D0D66686141, 0x0CBFE44FCEFBCF8B, 0x0CD6162D6DDE9FB9,
+  0x0CE8906E9FAD99D7, 0x0CF88DA85928D19D, 0x0D0CAD6993C065DD, 0x0D187E5C2C780933,
+  0x0D24C5B8899D6CD9, 0x0D356A0936A05EA3, 0x0D3F2B12D27ABDD5, 0x0D4F089584461FEF,
+  0x0D5EBDAF02C952FB, 0x0D743407E2EC94A3, 0x0D8CA0385FF641D5, 0x0DA931441A3CE247,
+  0x0DB88A3D86B5DB3D, 0x0DC7EFDB7BD853C7, 0x0DDF3D4E9A84BB9F, 0x0DF1050820194285,
+  0x0E06F05B64511F6F, 0x0E14527FE1D37B15, 0x0E2943860AB731F5, 0x0E44B74A88F68FF5,
+  0x0E59A380F7E4E393, 0x0E7EA49B73860A37, 0x0E90C862D15D605F, 0x0EA428BC8F289135,
+  0x0EAF664F3753362D, 0x0EBEE521AB07D961, 0x0ED5852DA9F77A99, 0x0EE74489707EF657,
+  0x0EFB377CE800DB03, 0x0F10AD4FA8A5366F, 0x0F21AC769B565831, 0x0F308F2216A7D205,
+  0x0F3C989BAB6A0BF9, 0x0F4BCCE29EB7E503, 0x0F5B891605357AF1, 0x0F739743ECD0F13F,
+  0x0F84AA8B52361023, 0x0F97C23BBED23C73, 0x0FA5822F78EFF60F, 0x0FB5C262904A100F,
+  0x0FCF375E051DE179, 0x0FE51106BB0BEE91, 0x10013FB2F7F2DB43, 0x100EC50BC1B7BBA3,
+  0x10225B7CC443BB33, 0x103F5CAD7105CD19, 0x1052DEE99018B007, 0x1065EFE6E67F8751,
+  0x1074373ACF0C7821, 0x1086E23806074FA7, 0x10991974E9276851, 0x10AC67D021DD830F,
+  0x10C78B4B943072D9, 0x10D8EDE9AF16DCDF, 0x10F22F821FDEA315, 0x1112E8C602838ACF,
+  0x1124425E3E79A837, 0x112FDA950440FB83, 0x114760C52CC569A9, 0x1161A77775F54E83,
+  0x11755FAE6C914B83, 0x118BD5F74D794C77, 0x11A14EA87A234F77, 0x11ACE13D6C882D71,
+  0x11B9D30E4E1C9F41, 0x11C4E72120E26857, 0x11E86F502BB23E71, 0x1200F821C5FD16DD,
+  0x120F302C10203AAD, 0x1222EE3667D72CCD, 0x1238639E63CF19B1, 0x124F074837D92BDD,
+  0x12664E8F1D129405, 0x1283CCC65F6120F1, 0x12A1FFE05C404F51, 0x12C959E280DE5B31,
+  0x12E085B68B5456A5, 0x12F9305EB7CACFF3, 0x131317E1874667B9, 0x1324CDA19CB225DD,
+  0x13376B8FAEF70B43, 0x1348A6A0A7196637, 0x135D63A9DCCB1ADB, 0x137C53CF0D9E1FD5,
+  0x1397A0A76BE476D1, 0x13A8D1CD9DCE5D97, 0x13B9784C19D0FF31, 0x13D6C7E94E666F89,
+  0x13EBABDD7382011F, 0x14072163E5932791, 0x14193397CA154FA3, 0x14330EA1C95B4B09,
+  0x14458AE57C30909D, 0x146AF5FAC8AE48CF, 0x147F19ED8A8CBEE5, 0x14986EEE12AC7965,
+  0x14B6B60CA3BA7E75, 0x14DFC96FD3EDD9FB, 0x14FB4F87FFC35FF3, 0x150D1A0DF903884B,
+  0x151F8D5AAFDD108F, 0x1534364A9C4858F1, 0x155DB4C4154DEAF5, 0x157A55E18E5E1A15,
+  0x159301BC493E6323, 0x15A8EFCEECE8DE67, 0x15C8613D7D751AB3, 0x15DF19C5E6CCFC97,
+  0x15FBE9C83B2DA9F5, 0x161886B2C45D36B1, 0x16278229A321FC6B, 0x164300C36AB9F6CF,
+  0x166557394EB730A1, 0x16A4AAAC86D9FA91, 0x16BFF5F7BA08E451, 0x16D8BDB7060D38F9,
+  0x16EFF6524286BB57, 0x170ADDBD57B9FF93, 0x172928F769CC1DF3, 0x1742468E7793BC2F,
+  0x17542B2F43136357, 0x176D6A71E4AC0223, 0x178B16DA0C5424D9, 0x17A731AA13F057E9,
+  0x17CC257DA82B6935, 0x17EC329319A5223F, 0x1807F6AAE9C04173, 0x181F0F9810736237,
+  0x183C5D0EFECF2C1F, 0x18667302C65FC8E1, 0x188A8EE0F58580EF, 0x18A04AB71E6406E1,
+  0x18BB484DCCF50815, 0x18D17DF797560B49, 0x18EAE50767EF567F, 0x190AAB7F180E3455,
+  0x1923E531A51D6B0D, 0x193B6F1C68019BD7, 0x195A18BC6D973449, 0x196B0FB913AC70C9,
+  0x19870D4201292493, 0x19A7688F161F86C5, 0x19C06132887E40E9, 0x19D12F92D19DDB9F,
+  0x19EFA89C74BBEAE9, 0x1A0C70AF91E4F689, 0x1A27814B4FCC9FD3, 0x1A4EFC2AE5CB5D51,
+  0x1A7819589EE792E3, 0x1A9496FDD7829CDB, 0x1AB6AC4B1769BD09, 0x1ADE0C8BA088CB73,
+  0x1AF9613FAC05AE5F, 0x1B0F3AD4058A7001, 0x1B34016E029E21FB, 0x1B5B8BCB79588A9B,
+  0x1B73E0CA779B1CB5, 0x1B8A041CF99DB477, 0x1BA0352398431071, 0x1BB0095DFCAA4AC5,
+  0x1BD026B1D8977BF7, 0x1BEE18DE4108106D, 0x1C136016EBEC8059, 0x1C502C5DF1E51BAF,
+  0x1C70D4A4E3C05B61, 0x1C8EE5D305B9FFDD, 0x1CB7E642A043D7A9, 0x1CDDF897099E74C9,
+  0x1CF7B04F784F67B1, 0x1D2123313F7CE825, 0x1D5889C6E2F4DA3B, 0x1D7C75CA389C574D,
+  0x1D96973A0DEAF819, 0x1DB6C101ABA39B5F, 0x1DD69F59A9086663, 0x1DEF6384038B9DA3,
+  0x1E0B04B5148559C1, 0x1E44ECC2BEA40FD9, 0x1E6406756B964BA7, 0x1EABDEBCC9AAD8E5,
+  0x1EC9A4803083DAB3, 0x1EE98CBB85D5356B, 0x1F06449D8C41AE03, 0x1F23103362EBD2A3,
+  0x1F360728362B87F3, 0x1F53C758F09530FF, 0x1F7DA7650BF245E9, 0x1FA1063756DB0073,
+  0x1FC3ABE578297009, 0x1FE23D13CC2E1CF7, 0x2005F01254C526A5, 0x203593FFFA82C52F,
+  0x205CF064922A5679, 0x207889CE9F2362EB, 0x209809AA725CC34B, 0x20B6C5B7F7D68CF7,
+  0x20D673675C0C21B7, 0x20E80A623CA467AD, 0x211FFE853012C315, 0x213EABA3B3289C2F,
+  0x215A654AE4C9876F, 0x217F519A7F42C959, 0x21A8BA33A1EE8CD7, 0x21D24AF8567B56ED,
+  0x21F9CDD1E1E12009, 0x22272FF3D1773357, 0x2252FA2DCDE67249, 0x227B5FA2A071EC63,
+  0x229F007B40525197, 0x22C4871429382CF3, 0x22EC6ADB20D27E1D, 0x23011610F0BEC4B1,
+  0x2319655EE88C1555, 0x234771FE97EC5045, 0x2375396F02387C5B, 0x239B6D24C0281DB7,
+  0x23C73B1C16DC5423, 0x23EFFD4CD9FF62A1, 0x240F3812A94ECF9D, 0x242D9B6F6DD0BBF5,
+  0x245A673C1E12BC47, 0x24841C78E5DDF73B, 0x24CC45E98E1D6B15, 0x2507B4AD4C0EACDB,
+  0x2531FEAE9B882527, 0x2552FCE38BEA781B, 0x25731DE209FCC34B, 0x259FA9BD13764207,
+  0x25C5B2461FFB0693, 0x2603427D5DB949C1, 0x263A65726CEA8517, 0x2661DA7987D450C3,
+  0x2688F262D993940D, 0x26A2969A3D763B43, 0x26C38EFF06B1D877, 0x26EE5952670C861F,
+  0x2718C9EF8C4A6D91, 0x274D2C7760F4842B, 0x27700BA8E99E00B1, 0x27A3C7D92DA9A68F,
+  0x27C95B1E9CC5080F, 0x27EA90C6B973E651, 0x2805E30933795E93, 0x281DC6C7FE1061D7,
+  0x283FB0C90250FDB3, 0x287F409487395565, 0x28AEFEEB1070DCAF, 0x28D54E48939C5E0B,
+  0x290DF5307A074D5B, 0x29391B84FACA9565, 0x295F49590A53A55B, 0x2990500D9C729537,
+  0x29A340ABE899502D, 0x29C2886D44169AC7, 0x29EB2464CC37F105, 0x2A26788781A885F7,
+  0x2A52FF25E3D7C8C3, 0x2A866CBD1E34CA6D, 0x2AB1AEEB82A0B25B, 0x2ACFFCD4A168D547,
+  0x2AF9E424A75879D3, 0x2B129069C7923465, 0x2B3B9A953D99EA99, 0x2B632B512B1B9C7F,
+  0x2B8A51367FEBC0BF, 0x2BCCAC9412F3EA05, 0x2BF308818EECB7F5, 0x2C106610F2E737DF,
+  0x2C399ABA85DEC765, 0x2C69619008C910F7, 0x2C93E984B4EBBCCD, 0x2CBFA4B630567687,
+  0x2CDE7E8A52B76BC9, 0x2D06A316C33FAD15, 0x2D1D77D92B0D9EC1, 0x2D393C57F42ABFDF,
+  0x2D74BF0DDA61AEC5, 0x2DA61090E6D71D5D, 0x2DEB5EB2DEA21859, 0x2E13A9D36DAA766F,
+  0x2E2B722D65C4CBE1, 0x2E4E5AD1D996EB2F, 0x2E7B59DED7D215B9, 0x2EA996FFA4F5A98B,
+  0x2ECDE6049AABA871, 0x2F1004C8EDC165F5, 0x2F37EFBEB8CA38AF, 0x2F6083F022CEE93B,
+  0x2F93623651A40F73, 0x2FBF99442A98A9FB, 0x300101A7424195C9, 0x304063D4183416FB,
+  0x307A45E2C38D0371, 0x30BC6E66D8AF9957, 0x30F75249979DA803, 0x313F372DBC62E593,
+  0x316F8073E677F381, 0x31AC3395F9757CB9, 0x31F57245FA15BFC7, 0x321E9ABC4804959F,
+  0x323E6BC8BE97BA97, 0x326A1E30F9CA3C33, 0x32A84F48C3B1A9B1, 0x32ECAEDC1A557DA3,
+  0x3305206A86FE7279, 0x33523D398FCF1557, 0x33A353C928E6DB19, 0x33D4C35C0F2246AD,
+  0x33F42E4BAF989285, 0x342061CDA1C321AB, 0x3447D476EA088969, 0x3479B8BC8CA91175,
+  0x349C7C3BC2BCCC47, 0x34D868B3EE6BEB53, 0x35017E72A826E039, 0x3540383D6D21D365,
+  0x35548F5F702B3023, 0x35A7FE8D910F7AE5, 0x35E570C3FDCF7B2F, 0x3644CA98FBE420E5,
+  0x3673171F631E5671, 0x3698B666FB5C43E9, 0x36C2CF76BDD4FA7F, 0x3706E074FC2367E3,
+  0x37271AA4046E4F9D, 0x375E350CCCF22BAB, 0x379249EDE9F5D59B, 0x37CA58A32A133BD3,
+  0x37FB86F50D9671D9, 0x3833E49F095765FD, 0x3869356C05878E8B, 0x38A09B4D61E58FB3,
+  0x38C94A7ACDFF110D, 0x3913C4A5E305648B, 0x396A44F658EA6DC9, 0x3995FEA74F7123A7,
+  0x39D0383F216E0291, 0x3A19BB67271BC921, 0x3A584FD321943AFB, 0x3A8887A785FF1C61,
+  0x3AACEF3B3F63A7DB, 0x3AEF4B30BE712D3B, 0x3B31340BA01CD36D, 0x3B7F6238614F24BF,
+  0x3BB85E4ADB858115, 0x3BEE254F1D442051, 0x3C3190A24FE5BE09, 0x3C6904EDBBE52585,
+  0x3CA767ADE6E732E5, 0x3CE295E0CB9E57D3, 0x3D2E5472ADE057C1, 0x3D5138BE5B8A89F3,
+  0x3D967CBD1A219A69, 0x3DE91A22CD2A4A71, 0x3E28A5839A464AA1, 0x3E7430ED9BE40B0F,
+  0x3EA9055BC28E4C1B, 0x3EEA8AD31AC5EFFB, 0x3F1E43C0085937BB, 0x3F5704FD98D83A7D,
+  0x3F9D4C825E02F34D, 0x3FD5AF13FABF1775, 0x40132ABEB4791047, 0x4073A1008F8CFACB,
+  0x40A405F751E50AB3, 0x40D81700673988A5, 0x4114DDF1E4614FA7, 0x4154B0E607D36591,
+  0x419288329B38FD25, 0x41C5B7B73351A2BB, 0x41F3F56DACB55D7B, 0x423751787CA6F6A9,
+  0x426FF76F899B6EF9, 0x42AE98FCE8AF70BD, 0x42E03C738AE281FD, 0x431FE76F82BEF75F,
+  0x438BE0E0ECE10B55, 0x43F56AA543E484B3, 0x443990478ECF09E7, 0x44743F40A7AD7675,
+  0x44967B84768962C1, 0x44F5421613E2FE0B, 0x454C2A69A8CD73A7, 0x4577BDA5CCC4596F,
+  0x45B3376739BC2E39, 0x45EF99E1BF3070B1, 0x4629DD6DE3FC433B, 0x467B0E94DAE0DFC1,
+  0x46B5AAF5F6458CFF, 0x46E4F4D635E33DCF, 0x4727791A4673C2F5, 0x4764CC5994261EC5,
+  0x479E6E548AFBAE8F, 0x47E174F8FC0A7071, 0x480D77CF7490F137, 0x485D331B9ABCC2B1,
+  0x488EDEBEEEBFB0C1, 0x48D41C16EEE6241F, 0x49279C7F9FE4B3B1, 0x495CD2C17FB66835,
+  0x499548A1D2B37465, 0x49EFBBD6D5E4E6C3, 0x4A4823D466B53307, 0x4A8D05EEF29F1CBD,
+  0x4AD612F3FE563C45, 0x4B29B22E3EA0DE3F, 0x4B77FDC6F6CB3B5B, 0x4BC0E8B994A8F7DD,
+  0x4C16E9437C87212F, 0x4C535C8EEEFA8859, 0x4C9F548A27CAD889, 0x4CC8A2A52266909F,
+  0x4D0240DA058DB975, 0x4D49D65A36AB2B1D, 0x4D94E297350EFCE9, 0x4DD6519EE568FD71,
+  0x4E364B8496F402A7, 0x4E7C41BD8D4FD0B1, 0x4EAA70F74507C651, 0x4EE0F9CA60A3CFFD,
+  0x4F1E4112F6925CC9, 0x4F64CD37F573116B, 0x4FD96C139D8671EF, 0x501A9CB15DF9A3EF,
+  0x5047D57A5AAECB8F, 0x509868AB95C5F627, 0x50D2794CD19F3DD5, 0x511BDB5BA9931DB7,
+  0x51511E48E23F3E31, 0x518FCD7B94D8AF5D, 0x51E9DAD846C63161, 0x5241A1EC6CBDD66F,
+  0x52836ED08B80A8C1, 0x52C1F55EF9B5D037, 0x52FE0ACAD2C9B4CF, 0x5348E4CB70FB570D,
+  0x538FA1ED137D3181, 0x53D6889A188A7F7D, 0x542EFE0045FBF099, 0x54780A311C46CF01,
+  0x54CC9E5FE38D9EDB, 0x550FF015217315ED, 0x55544B50C9567FE9, 0x558ABD57DB593E41,
+  0x55DBB7CC14644BCD, 0x56394CFDFF13B789, 0x56710DD9C9FB125F, 0x56CC72ED04AF83F5,
+  0x570E48DF1173DCE1, 0x574D961F96C7E9FB, 0x5786C365FC34E0CF, 0x57B631ED0C844691,
+  0x5811AEDDAF81B35D, 0x5873C6069D7A6B3F, 0x58C500E50B21F7AB, 0x590E4C4DE504B359,
+  0x5955F34CC109D03B, 0x599CDC47BF347457, 0x5A0123E220F50347, 0x5A6796BD80C15923,
+  0x5AA8B51E9444DDF1, 0x5AEBCECEF2D064E3, 0x5B53F3DD52F1F909, 0x5BCB456A19F18B9F,
+  0x5C2F86CB926B4B43, 0x5C92399429DA2CCF, 0x5CDECC4C3B32ACF3, 0x5D2E5C7C9C2F3091,
+  0x5D8785A1DBE8C8B3, 0x5DCD261587DE99D7, 0x5E37C2EB695E3379, 0x5E9299A6406D57CD,
+  0x5EF45FF6378724CF, 0x5F4A09EF0A00D28B, 0x5F880C3FD31E2151, 0x5FD29D590257D70D,
+  0x603C0F59BA9B23B9, 0x607D6C7742DDD781, 0x60E862A030AE207F, 0x6115C8A81343874D,
+  0x61490C071341F983, 0x61870F4569A9BA8F, 0x61CA0B79E8FE2801, 0x6223915F86CA78D9,
+  0x6267D88EAE836DBD, 0x62B7062D1C9DEB77, 0x63017C960D6CF9A7, 0x6357E851C9C42D1B,
+  0x63C3430B98D954D9, 0x64104B0C959FBD5D, 0x64578D673D42FE05, 0x64A1F0103A74E53B,
+  0x64F274DA9C260661, 0x654C25378F8BD421, 0x65AE10E725F95B1D, 0x660138AF15AC7647,
+  0x6671BD39F72309C3, 0x66CA67DF0447B737, 0x6707FEF0A97B30ED, 0x676E37A47A938093,
+  0x67BA4FEF362EB5CD, 0x68251DABF86E9C8B, 0x687ACE0988C62C67, 0x691763A91855ADE5,
+  0x698B7CED5EF10067, 0x69D397C5DCF51E4B, 0x6A08379754914231, 0x6A72BA8EB2ABCDEB,
+  0x6AE5DD60539878B9, 0x6B2EA9A9B0AC8BF5, 0x6B768EF9B3E2E2AB, 0x6BE65501AA507C45,
+  0x6C577E8A612EBA45, 0x6CA10782A6F8E971, 0x6D03FFD241691DF5, 0x6D43509609639BE5,
+  0x6DA3899CBB6F3F93, 0x6E172185387ADFB5, 0x6E52A82E903984D9, 0x6EA064064827146B,
+  0x6EF17E270D7B7143, 0x6F4B544BB946F3A3, 0x6FB243F4206EED27, 0x70072E607C9CBD0D,
+  0x707518EAA59BE129, 0x70D8837726CD41C9, 0x7129BF0A37268EB3, 0x71BA37BD12540EBD,
+  0x723F37BEA6524C05, 0x729135E25D65985F, 0x72C39509ABF2F56B, 0x7309C493DDB3966B,
+  0x7376979AF3271A05, 0x73EB705A88E31909, 0x74472DCC8F99392F, 0x74B18D678388B52B,
+  0x75094D9052AFF6BD, 0x75468192A019BFEB, 0x75A54695EB9A3171, 0x760AFE300F9F6E37,
+  0x7680AB162BA9AAF5, 0x76FB31E467EEFB4B, 0x775D42A0F5F4DE41, 0x77DAB48DC6EAAABF,
+  0x787BC6BA9D8A758B, 0x78D5A753008C38E9, 0x7932023E03BEF407, 0x7984465EC01CD293,
+  0x79BD80B45825B0AF, 0x7A1B84BD26056FEB, 0x7A789C0B8D8965B9, 0x7AC49BDE9B8DA1B5,
+  0x7B10BF4579ADB6D1, 0x7B63F6162304E4C9, 0x7BBAD24B38B035F7, 0x7C2EE95F44F35D1B,
+  0x7C9EA8BA0B9ED957, 0x7D0305A1D171BDAB, 0x7D91CAD9F46AD8A3, 0x7E072CD67F571B0B,
+  0x7E74A1AB5EB1E6F9, 0x7ED7BC4811E9C1D9, 0x7F4A73D7B3B105C7, 0x7F9D6F6ED7A7C0C3,
+  0x800BEBF7DF94A029, 0x80928A01F0A05D9B, 0x80FA7A4743A867D1, 0x8144B0EF97F759D5,
+  0x81F18ABCA18A7205, 0x822EEDCC31A19A2B, 0x82A3E76D26355215, 0x833642737DB9A033,
+  0x83BCF03746FF871D, 0x8447AD1414F9A6A1, 0x84BF4B8A413EDC55, 0x8503C8CEC059A9F5,
+  0x854D48EB72124FF5, 0x859E44DAF6F275D9, 0x8611D9311FA2FE6D, 0x8692177789FA055D,
+  0x86C10903354849D1, 0x87064C558C287131, 0x877C0B7898BBFEFB, 0x87C7CEA3FBDC77E9,
+  0x883CCA9153BA8B65, 0x88B493CA7F1EFBA5, 0x893F76DE76371AC7, 0x898BF7C443D48465,
+  0x89FE51E31CC5F833, 0x8A6BE95CB1BAAB41, 0x8AE7A9AE0FEF192D, 0x8B4BA69C31953393,
+  0x8C050192FECA5373, 0x8C6854338CC585C7, 0x8CD4CC96925B5BBD, 0x8D293117B8549011,
+  0x8D6D1135D6298D2F, 0x8DB252AB91FA2127, 0x8E2C64689BA0D03D, 0x8E9B2D59D2ED13A1,
+  0x8F1D9A7AA7AB0B23, 0x8F76E7937538628D, 0x8FE523001F1FF397, 0x904D1D01651EDF2F,
+  0x90A0748C08ADC9E3, 0x911F075E7187F689, 0x917E827C592CFB37, 0x91C2A19E82A04307,
+  0x921E7AA8656C8447, 0x928A48F64072B50F, 0x930F66CFC4230665, 0x937279FD18AA1AA7,
+  0x93DDB2716D9FC9B9, 0x94353A9B189270E9, 0x9494E464BC92D201, 0x950364F403230BCF,
+  0x955E1BF14215399F, 0x95E2758BF9AF1DBD, 0x9650596C3EF9FC11, 0x96B7BFDBD637AB0F,
+  0x9772EFDCBC98D449, 0x9802234378C7BA75, 0x988588F23AF6A0A7, 0x99199350EC635A5D,
+  0x998680CCE8E917A9, 0x99ECD3FF99CC959B, 0x9A369F9245B31A93, 0x9AB5F5A796908B15,
+  0x9AFBEA930AAC8387, 0x9B6C98FE6B0E8E9F, 0x9BF6551F3F234ADB, 0x9C7820B7D6F60733,
+  0x9D11CE92774D1D51, 0x9D892F652798A3FD, 0x9DDC9F36CEA05D2D, 0x9E652F36AD81F6F9,
+  0x9ECC895061DF019D, 0x9F314822DF609685, 0x9F775A50C4FEBDF1, 0x9FF011C0908C66CD,
+  0xA0B0F7361A03C523, 0xA12A66C463A1B703, 0xA17DDCF0B55C41A9, 0xA1DCCB7E4B4B111F,
+  0xA251319823B4A8EF, 0xA3143BC528A0CB65, 0xA3866FDA087B8605, 0xA419D0A7B27826BF,
+  0xA4A669B033766E6F, 0xA5151F341A8DC4D1, 0xA58CB40C3715B5DF, 0xA679AF9CB26D54F3,
+  0xA71C2D29476E939B, 0xA77D91940DA43F0D, 0xA7F95FBEFD337987, 0xA8583AE3B8737249,
+  0xA8B8B35817D9C02D, 0xA914F116BADD38F7, 0xA97B9AA0AB889DCF, 0xA9ECBD9F96129D09,
+  0xAA71429EDB33198D, 0xAAC6D2B3D16DB9E9, 0xAB342AE3C6566E8D, 0xAC22C8CA70E972DB,
+  0xAC74854C87E5BE5D, 0xACD0CC20971C8A41, 0xAD34AD377955B027, 0xAD89C8AA3D527521,
+  0xAE1AE3E166C7AF8F, 0xAEB6DF0427DA9037, 0xAF54C3A891CA606D, 0xAFB3B24486E43143,
+  0xB015CDB190E89E05, 0xB09656F74DD6AB47, 0xB106771C36CB89EB, 0xB18F1CE90576BD83,
+  0xB282CDD863964EDF, 0xB3480082F6AEAA89, 0xB3E2D6AA2463A8A7, 0xB46885A8E8386845,
+  0xB4F322041C45961D, 0xB544E5BF154FF07F, 0xB5B5B2FE12D0CE51, 0xB65218A1F623C40F,
+  0xB6FCE5B2B9603FDF, 0xB79253D4D8E31F5B, 0xB81BA0B04F87BA93, 0xB8C2F8B65E5DBF2D,
+  0xB9710A9AD06493D7, 0xBA17BA2FD1C3257B, 0xBAF61B66C0407BD9, 0xBB699207F1CB6EE3,
+  0xBBC0B025E6AF5DF9, 0xBC2FBB7726D4257D, 0xBCC1FABF68E45135, 0xBD2FE13A013C8B3B,
+  0xBDA78AF944967EA5, 0xBE978C824A75B3D9, 0xBEFC9E21771514AB, 0xBF46829D579F0BBB,
+  0xBFE76CC3E326DD0F, 0xC0A0FE537C994015, 0xC14FB8AAD09C4621, 0xC1F6D0A00DC7A8C3,
+  0xC2CA492E3042EE23, 0xC3998CB10C422621, 0xC44706FD4DDF92C5, 0xC4BB7AD0595824FB,
+  0xC545831AE5BB5FFF, 0xC6063EDC4E1190C5, 0xC66E411D7EEFA17B, 0xC6EA46E645433FD5,
+  0xC75AED45E12D50A1, 0xC7FD99E350F77885, 0xC859116638335E6B, 0xC8B9A7C5AA10CE33,
+  0xC9386C16154D1677, 0xC9D589729B77AED7, 0xCACBF81F9B73DD11, 0xCB7AD6E034D70D21,
+  0xCC4D9D03CBC8F9E7, 0xCCC74F6FC65771C3, 0xCD22B7F3E5131827, 0xCDB63DF383962815,
+  0xCE4A1118682D08F3, 0xCED91AFF4F786C7F, 0xCF5E2B6817DB886F, 0xCFDAF2E8DF36A981,
+  0xD0BB628A97F257AB, 0xD1468A9ABD1D8D0D, 0xD202321DEB3DEE0B, 0xD2F76AE84D105717,
+  0xD3856A9FF003568F, 0xD407860538BC21D1, 0xD4B8DA2580F27F95, 0xD5443D93D06C15FD,
+  0xD5BE6C2A35530041, 0xD6761329D76CEE23, 0xD72026E3CE461D25, 0xD7CC602F2DCBC109,
+  0xD891B3ECE870A4D1, 0xD935F445AC55A567, 0xD9CC659B391EA1FD, 0xDA588011B29F8C7B,
+  0xDAFDBED6D230B645, 0xDBB7008775E13A15, 0xDC440590AA03412B, 0xDD23B00EBC523B0D,
+  0xDE05D1CE30AF7DA9, 0xDED30350DA8BC22D, 0xDF467290F0898A75, 0xDFB83FD8756345BF,
+  0xE02C07E3FE53F7BF, 0xE0A73D268C58DB33, 0xE13FB6A95C9A2EC3, 0xE1C81A74EC69D481,
+  0xE262F8EE9C57065F, 0xE2FA81D51BAEF7F1, 0xE34AF45A09606249, 0xE3DB9AFCAD371C6F,
+  0xE44F26F46EF79FD5, 0xE4B42AE7394E8453, 0xE543A57CE981177B, 0xE5D8EE20969D7D31,
+  0xE65677E5C92537F1, 0xE6EC442AAFF6D26F, 0xE7BBDFFE85085767, 0xE8CF0D35B99D3487,
+  0xE962531690DFDD21, 0xEA196650483BCB0D, 0xEAF6655520134651, 0xEB9F5BD744C1A43D,
+  0xEC59A14B9C0C038B, 0xED1A01545650C087, 0xEDC9CA46D8B62B29, 0xEEC3F66465C24459,
+  0xEF8B83856E4B8A0B, 0xF064B5AF015D07E3, 0xF15D1E90B3B6E3EB, 0xF1D99948E76444B9,
+  0xF25FDB5A44917FB1, 0xF2FD6A78914D0445, 0xF3F7CF3BEE41B011, 0xF4B515B34B3A1A6D,
+  0xF5A33D97461886E7, 0xF62B137F47839D2F, 0xF6B8F8F5709466A9, 0xF7A6A41DC49B879D,
+  0xF844D071935D4B4B, 0xF8F4E6C360F61DC3, 0xF976453E077009BF, 0xF9F5DD43594D71E1,
+  0xFA6DC9D49468538B, 0xFB38A4E94B0C6BA9, 0xFC020700F1AB8ED5, 0xFCC3F1E46FB9C8B9,
+  0xFD8059698237104B, 0xFE1F539D8692F3C7, 0xFEB49F686CA6B6B5, 0x0000FFB905DED927
+};
+
+static const unsigned int primesProductsIndices[][2] = {
+  {16, 26}, {26, 35}, {35, 43}, {43, 51}, {51, 58}, {58, 65},
+  {65, 72}, {72, 79}, {79, 86}, {86, 93}, {93, 100}, {100, 106},
+  {106, 112}, {112, 118}, {118, 124}, {124, 130}, {130, 136}, {136, 142},
+  {142, 148}, {148, 154}, {154, 160}, {160, 166}, {166, 172}, {172, 178},
+  {178, 184}, {184, 190}, {190, 196}, {196, 202}, {202, 208}, {208, 214},
+  {214, 220}, {220, 226}, {226, 232}, {232, 238}, {238, 244}, {244, 250},
+  {250, 256}, {256, 261}, {261, 266}, {266, 271}, {271, 276}, {276, 281},
+  {281, 286}, {286, 291}, {291, 296}, {296, 301}, {301, 306}, {306, 311},
+  {311, 316}, {316, 321}, {321, 326}, {326, 331}, {331, 336}, {336, 341},
+  {341, 346}, {346, 351}, {351, 356}, {356, 361}, {361, 366}, {366, 371},
+  {371, 376}, {376, 381}, {381, 386}, {386, 391}, {391, 396}, {396, 401},
+  {401, 406}, {406, 411}, {411, 416}, {416, 421}, {421, 426}, {426, 431},
+  {431, 436}, {436, 441}, {441, 446}, {446, 451}, {451, 456}, {456, 461},
+  {461, 466}, {466, 471}, {471, 476}, {476, 481}, {481, 486}, {486, 491},
+  {491, 496}, {496, 501}, {501, 506}, {506, 511}, {511, 516}, {516, 521},
+  {521, 526}, {526, 531}, {531, 536}, {536, 541}, {541, 546}, {546, 551},
+  {551, 556}, {556, 561}, {561, 566}, {566, 571}, {571, 576}, {576, 581},
+  {581, 586}, {586, 591}, {591, 596}, {596, 601}, {601, 606}, {606, 611},
+  {611, 616}, {616, 621}, {621, 626}, {626, 631}, {631, 636}, {636, 641},
+  {641, 646}, {646, 651}, {651, 656}, {656, 661}, {661, 666}, {666, 671},
+  {671, 676}, {676, 681}, {681, 686}, {686, 691}, {691, 696}, {696, 701},
+  {701, 706}, {706, 711}, {711, 716}, {716, 721}, {721, 726}, {726, 731},
+  {731, 736}, {736, 741}, {741, 746}, {746, 751}, {751, 756}, {756, 761},
+  {761, 766}, {766, 771}, {771, 776}, {776, 781}, {781, 786}, {786, 791},
+  {791, 796}, {796, 801}, {801, 806}, {806, 811}, {811, 816}, {816, 821},
+  {821, 826}, {826, 831}, {831, 836}, {836, 841}, {841, 846}, {846, 851},
+  {851, 856}, {856, 861}, {861, 866}, {866, 871}, {871, 876}, {876, 881},
+  {881, 886}, {886, 891}, {891, 896}, {896, 901}, {901, 906}, {906, 911},
+  {911, 915}, {915, 919}, {919, 923}, {923, 927}, {927, 931}, {931, 935},
+  {935, 939}, {939, 943}, {943, 947}, {947, 951}, {951, 955}, {955, 959},
+  {959, 963}, {963, 967}, {967, 971}, {971, 975}, {975, 979}, {979, 983},
+  {983, 987}, {987, 991}, {991, 995}, {995, 999}, {999, 1003}, {1003, 1007},
+  {1007, 1011}, {1011, 1015}, {1015, 1019}, {1019, 1023}, {1023, 1027}, {1027, 1031},
+  {1031, 1035}, {1035, 1039}, {1039, 1043}, {1043, 1047}, {1047, 1051}, {1051, 1055},
+  {1055, 1059}, {1059, 1063}, {1063, 1067}, {1067, 1071}, {1071, 1075}, {1075, 1079},
+  {1079, 1083}, {1083, 1087}, {1087, 1091}, {1091, 1095}, {1095, 1099}, {1099, 1103},
+  {1103, 1107}, {1107, 1111}, {1111, 1115}, {1115, 1119}, {1119, 1123}, {1123, 1127},
+  {1127, 1131}, {1131, 1135}, {1135, 1139}, {1139, 1143}, {1143, 1147}, {1147, 1151},
+  {1151, 1155}, {1155, 1159}, {1159, 1163}, {1163, 1167}, {1167, 1171}, {1171, 1175},
+  {1175, 1179}, {1179, 1183}, {1183, 1187}, {1187, 1191}, {1191, 1195}, {1195, 1199},
+  {1199, 1203}, {1203, 1207}, {1207, 1211}, {1211, 1215}, {1215, 1219}, {1219, 1223},
+  {1223, 1227}, {1227, 1231}, {1231, 1235}, {1235, 1239}, {1239, 1243}, {1243, 1247},
+  {1247, 1251}, {1251, 1255}, {1255, 1259}, {1259, 1263}, {1263, 1267}, {1267, 1271},
+  {1271, 1275}, {1275, 1279}, {1279, 1283}, {1283, 1287}, {1287, 1291}, {1291, 1295},
+  {1295, 1299}, {1299, 1303}, {1303, 1307}, {1307, 1311}, {1311, 1315}, {1315, 1319},
+  {1319, 1323}, {1323, 1327}, {1327, 1331}, {1331, 1335}, {1335, 1339}, {1339, 1343},
+  {1343, 1347}, {1347, 1351}, {1351, 1355}, {1355, 1359}, {1359, 1363}, {1363, 1367},
+  {1367, 1371}, {1371, 1375}, {1375, 1379}, {1379, 1383}, {1383, 1387}, {1387, 1391},
+  {1391, 1395}, {1395, 1399}, {1399, 1403}, {1403, 1407}, {1407, 1411}, {1411, 1415},
+  {1415, 1419}, {1419, 1423}, {1423, 1427}, {1427, 1431}, {1431, 1435}, {1435, 1439},
+  {1439, 1443}, {1443, 1447}, {1447, 1451}, {1451, 1455}, {1455, 1459}, {1459, 1463},
+  {1463, 1467}, {1467, 1471}, {1471, 1475}, {1475, 1479}, {1479, 1483}, {1483, 1487},
+  {1487, 1491}, {1491, 1495}, {1495, 1499}, {1499, 1503}, {1503, 1507}, {1507, 1511},
+  {1511, 1515}, {1515, 1519}, {1519, 1523}, {1523, 1527}, {1527, 1531}, {1531, 1535},
+  {1535, 1539}, {1539, 1543}, {1543, 1547}, {1547, 1551}, {1551, 1555}, {1555, 1559},
+  {1559, 1563}, {1563, 1567}, {1567, 1571}, {1571, 1575}, {1575, 1579}, {1579, 1583},
+  {1583, 1587}, {1587, 1591}, {1591, 1595}, {1595, 1599}, {1599, 1603}, {1603, 1607},
+  {1607, 1611}, {1611, 1615}, {1615, 1619}, {1619, 1623}, {1623, 1627}, {1627, 1631},
+  {1631, 1635}, {1635, 1639}, {1639, 1643}, {1643, 1647}, {1647, 1651}, {1651, 1655},
+  {1655, 1659}, {1659, 1663}, {1663, 1667}, {1667, 1671}, {1671, 1675}, {1675, 1679},
+  {1679, 1683}, {1683, 1687}, {1687, 1691}, {1691, 1695}, {1695, 1699}, {1699, 1703},
+  {1703, 1707}, {1707, 1711}, {1711, 1715}, {1715, 1719}, {1719, 1723}, {1723, 1727},
+  {1727, 1731}, {1731, 1735}, {1735, 1739}, {1739, 1743}, {1743, 1747}, {1747, 1751},
+  {1751, 1755}, {1755, 1759}, {1759, 1763}, {1763, 1767}, {1767, 1771}, {1771, 1775},
+  {1775, 1779}, {1779, 1783}, {1783, 1787}, {1787, 1791}, {1791, 1795}, {1795, 1799},
+  {1799, 1803}, {1803, 1807}, {1807, 1811}, {1811, 1815}, {1815, 1819}, {1819, 1823},
+  {1823, 1827}, {1827, 1831}, {1831, 1835}, {1835, 1839}, {1839, 1843}, {1843, 1847},
+  {1847, 1851}, {1851, 1855}, {1855, 1859}, {1859, 1863}, {1863, 1867}, {1867, 1871},
+  {1871, 1875}, {1875, 1879}, {1879, 1883}, {1883, 1887}, {1887, 1891}, {1891, 1895},
+  {1895, 1899}, {1899, 1903}, {1903, 1907}, {1907, 1911}, {1911, 1915}, {1915, 1919},
+  {1919, 1923}, {1923, 1927}, {1927, 1931}, {1931, 1935}, {1935, 1939}, {1939, 1943},
+  {1943, 1947}, {1947, 1951}, {1951, 1955}, {1955, 1959}, {1959, 1963}, {1963, 1967},
+  {1967, 1971}, {1971, 1975}, {1975, 1979}, {1979, 1983}, {1983, 1987}, {1987, 1991},
+  {1991, 1995}, {1995, 1999}, {1999, 2003}, {2003, 2007}, {2007, 2011}, {2011, 2015},
+  {2015, 2019}, {2019, 2023}, {2023, 2027}, {2027, 2031}, {2031, 2035}, {2035, 2039},
+  {2039, 2043}, {2043, 2047}, {2047, 2051}, {2051, 2055}, {2055, 2059}, {2059, 2063},
+  {2063, 2067}, {2067, 2071}, {2071, 2075}, {2075, 2079}, {2079, 2083}, {2083, 2087},
+  {2087, 2091}, {2091, 2095}, {2095, 2099}, {2099, 2103}, {2103, 2107}, {2107, 2111},
+  {2111, 2115}, {2115, 2119}, {2119, 2123}, {2123, 2127}, {2127, 2131}, {2131, 2135},
+  {2135, 2139}, {2139, 2143}, {2143, 2147}, {2147, 2151}, {2151, 2155}, {2155, 2159},
+  {2159, 2163}, {2163, 2167}, {2167, 2171}, {2171, 2175}, {2175, 2179}, {2179, 2183},
+  {2183, 2187}, {2187, 2191}, {2191, 2195}, {2195, 2199}, {2199, 2203}, {2203, 2207},
+  {2207, 2211}, {2211, 2215}, {2215, 2219}, {2219, 2223}, {2223, 2227}, {2227, 2231},
+  {2231, 2235}, {2235, 2239}, {2239, 2243}, {2243, 2247}, {2247, 2251}, {2251, 2255},
+  {2255, 2259}, {2259, 2263}, {2263, 2267}, {2267, 2271}, {2271, 2275}, {2275, 2279},
+  {2279, 2283}, {2283, 2287}, {2287, 2291}, {2291, 2295}, {2295, 2299}, {2299, 2303},
+  {2303, 2307}, {2307, 2311}, {2311, 2315}, {2315, 2319}, {2319, 2323}, {2323, 2327},
+  {2327, 2331}, {2331, 2335}, {2335, 2339}, {2339, 2343}, {2343, 2347}, {2347, 2351},
+  {2351, 2355}, {2355, 2359}, {2359, 2363}, {2363, 2367}, {2367, 2371}, {2371, 2375},
+  {2375, 2379}, {2379, 2383}, {2383, 2387}, {2387, 2391}, {2391, 2395}, {2395, 2399},
+  {2399, 2403}, {2403, 2407}, {2407, 2411}, {2411, 2415}, {2415, 2419}, {2419, 2423},
+  {2423, 2427}, {2427, 2431}, {2431, 2435}, {2435, 2439}, {2439, 2443}, {2443, 2447},
+  {2447, 2451}, {2451, 2455}, {2455, 2459}, {2459, 2463}, {2463, 2467}, {2467, 2471},
+  {2471, 2475}, {2475, 2479}, {2479, 2483}, {2483, 2487}, {2487, 2491}, {2491, 2495},
+  {2495, 2499}, {2499, 2503}, {2503, 2507}, {2507, 2511}, {2511, 2515}, {2515, 2519},
+  {2519, 2523}, {2523, 2527}, {2527, 2531}, {2531, 2535}, {2535, 2539}, {2539, 2543},
+  {2543, 2547}, {2547, 2551}, {2551, 2555}, {2555, 2559}, {2559, 2563}, {2563, 2567},
+  {2567, 2571}, {2571, 2575}, {2575, 2579}, {2579, 2583}, {2583, 2587}, {2587, 2591},
+  {2591, 2595}, {2595, 2599}, {2599, 2603}, {2603, 2607}, {2607, 2611}, {2611, 2615},
+  {2615, 2619}, {2619, 2623}, {2623, 2627}, {2627, 2631}, {2631, 2635}, {2635, 2639},
+  {2639, 2643}, {2643, 2647}, {2647, 2651}, {2651, 2655}, {2655, 2659}, {2659, 2663},
+  {2663, 2667}, {2667, 2671}, {2671, 2675}, {2675, 2679}, {2679, 2683}, {2683, 2687},
+  {2687, 2691}, {2691, 2695}, {2695, 2699}, {2699, 2703}, {2703, 2707}, {2707, 2711},
+  {2711, 2715}, {2715, 2719}, {2719, 2723}, {2723, 2727}, {2727, 2731}, {2731, 2735},
+  {2735, 2739}, {2739, 2743}, {2743, 2747}, {2747, 2751}, {2751, 2755}, {2755, 2759},
+  {2759, 2763}, {2763, 2767}, {2767, 2771}, {2771, 2775}, {2775, 2779}, {2779, 2783},
+  {2783, 2787}, {2787, 2791}, {2791, 2795}, {2795, 2799}, {2799, 2803}, {2803, 2807},
+  {2807, 2811}, {2811, 2815}, {2815, 2819}, {2819, 2823}, {2823, 2827}, {2827, 2831},
+  {2831, 2835}, {2835, 2839}, {2839, 2843}, {2843, 2847}, {2847, 2851}, {2851, 2855},
+  {2855, 2859}, {2859, 2863}, {2863, 2867}, {2867, 2871}, {2871, 2875}, {2875, 2879},
+  {2879, 2883}, {2883, 2887}, {2887, 2891}, {2891, 2895}, {2895, 2899}, {2899, 2903},
+  {2903, 2907}, {2907, 2911}, {2911, 2915}, {2915, 2919}, {2919, 2923}, {2923, 2927},
+  {2927, 2931}, {2931, 2935}, {2935, 2939}, {2939, 2943}, {2943, 2947}, {2947, 2951},
+  {2951, 2955}, {2955, 2959}, {2959, 2963}, {2963, 2967}, {2967, 2971}, {2971, 2975},
+  {2975, 2979}, {2979, 2983}, {2983, 2987}, {2987, 2991}, {2991, 2995}, {2995, 2999},
+  {2999, 3003}, {3003, 3007}, {3007, 3011}, {3011, 3015}, {3015, 3019}, {3019, 3023},
+  {3023, 3027}, {3027, 3031}, {3031, 3035}, {3035, 3039}, {3039, 3043}, {3043, 3047},
+  {3047, 3051}, {3051, 3055}, {3055, 3059}, {3059, 3063}, {3063, 3067}, {3067, 3071},
+  {3071, 3075}, {3075, 3079}, {3079, 3083}, {3083, 3087}, {3087, 3091}, {3091, 3095},
+  {3095, 3099}, {3099, 3103}, {3103, 3107}, {3107, 3111}, {3111, 3115}, {3115, 3119},
+  {3119, 3123}, {3123, 3127}, {3127, 3131}, {3131, 3135}, {3135, 3139}, {3139, 3143},
+  {3143, 3147}, {3147, 3151}, {3151, 3155}, {3155, 3159}, {3159, 3163}, {3163, 3167},
+  {3167, 3171}, {3171, 3175}, {3175, 3179}, {3179, 3183}, {3183, 3187}, {3187, 3191},
+  {3191, 3195}, {3195, 3199}, {3199, 3203}, {3203, 3207}, {3207, 3211}, {3211, 3215},
+  {3215, 3219}, {3219, 3223}, {3223, 3227}, {3227, 3231}, {3231, 3235}, {3235, 3239},
+  {3239, 3243}, {3243, 3247}, {3247, 3251}, {3251, 3255}, {3255, 3259}, {3259, 3263},
+  {3263, 3267}, {3267, 3271}, {3271, 3275}, {3275, 3279}, {3279, 3283}, {3283, 3287},
+  {3287, 3291}, {3291, 3295}, {3295, 3299}, {3299, 3303}, {3303, 3307}, {3307, 3311},
+  {3311, 3315}, {3315, 3319}, {3319, 3323}, {3323, 3327}, {3327, 3331}, {3331, 3335},
+  {3335, 3339}, {3339, 3343}, {3343, 3347}, {3347, 3351}, {3351, 3355}, {3355, 3359},
+  {3359, 3363}, {3363, 3367}, {3367, 3371}, {3371, 3375}, {3375, 3379}, {3379, 3383},
+  {3383, 3387}, {3387, 3391}, {3391, 3395}, {3395, 3399}, {3399, 3403}, {3403, 3407},
+  {3407, 3411}, {3411, 3415}, {3415, 3419}, {3419, 3423}, {3423, 3427}, {3427, 3431},
+  {3431, 3435}, {3435, 3439}, {3439, 3443}, {3443, 3447}, {3447, 3451}, {3451, 3455},
+  {3455, 3459}, {3459, 3463}, {3463, 3467}, {3467, 3471}, {3471, 3475}, {3475, 3479},
+  {3479, 3483}, {3483, 3487}, {3487, 3491}, {3491, 3495}, {3495, 3499}, {3499, 3503},
+  {3503, 3507}, {3507, 3511}, {3511, 3515}, {3515, 3519}, {3519, 3523}, {3523, 3527},
+  {3527, 3531}, {3531, 3535}, {3535, 3539}, {3539, 3543}, {3543, 3547}, {3547, 3551},
+  {3551, 3555}, {3555, 3559}, {3559, 3563}, {3563, 3567}, {3567, 3571}, {3571, 3575},
+  {3575, 3579}, {3579, 3583}, {3583, 3587}, {3587, 3591}, {3591, 3595}, {3595, 3599},
+  {3599, 3603}, {3603, 3607}, {3607, 3611}, {3611, 3615}, {3615, 3619}, {3619, 3623},
+  {3623, 3627}, {3627, 3631}, {3631, 3635}, {3635, 3639}, {3639, 3643}, {3643, 3647},
+  {3647, 3651}, {3651, 3655}, {3655, 3659}, {3659, 3663}, {3663, 3667}, {3667, 3671},
+  {3671, 3675}, {3675, 3679}, {3679, 3683}, {3683, 3687}, {3687, 3691}, {3691, 3695},
+  {3695, 3699}, {3699, 3703}, {3703, 3707}, {3707, 3711}, {3711, 3715}, {3715, 3719},
+  {3719, 3723}, {3723, 3727}, {3727, 3731}, {3731, 3735}, {3735, 3739}, {3739, 3743},
+  {3743, 3747}, {3747, 3751}, {3751, 3755}, {3755, 3759}, {3759, 3763}, {3763, 3767},
+  {3767, 3771}, {3771, 3775}, {3775, 3779}, {3779, 3783}, {3783, 3787}, {3787, 3791},
+  {3791, 3795}, {3795, 3799}, {3799, 3803}, {3803, 3807}, {3807, 3811}, {3811, 3815},
+  {3815, 3819}, {3819, 3823}, {3823, 3827}, {3827, 3831}, {3831, 3835}, {3835, 3839},
+  {3839, 3843}, {3843, 3847}, {3847, 3851}, {3851, 3855}, {3855, 3859}, {3859, 3863},
+  {3863, 3867}, {3867, 3871}, {3871, 3875}, {3875, 3879}, {3879, 3883}, {3883, 3887},
+  {3887, 3891}, {3891, 3895}, {3895, 3899}, {3899, 3903}, {3903, 3907}, {3907, 3911},
+  {3911, 3915}, {3915, 3919}, {3919, 3923}, {3923, 3927}, {3927, 3931}, {3931, 3935},
+  {3935, 3939}, {3939, 3943}, {3943, 3947}, {3947, 3951}, {3951, 3955}, {3955, 3959},
+  {3959, 3963}, {3963, 3967}, {3967, 3971}, {3971, 3975}, {3975, 3979}, {3979, 3983},
+  {3983, 3987}, {3987, 3991}, {3991, 3995}, {3995, 3999}, {3999, 4003}, {4003, 4007},
+  {4007, 4011}, {4011, 4015}, {4015, 4019}, {4019, 4023}, {4023, 4027}, {4027, 4031},
+  {4031, 4035}, {4035, 4039}, {4039, 4043}, {4043, 4047}, {4047, 4051}, {4051, 4055},
+  {4055, 4059}, {4059, 4063}, {4063, 4067}, {4067, 4071}, {4071, 4075}, {4075, 4079},
+  {4079, 4083}, {4083, 4087}, {4087, 4091}, {4091, 4095}, {4095, 4099}, {4099, 4103},
+  {4103, 4107}, {4107, 4111}, {4111, 4115}, {4115, 4119}, {4119, 4123}, {4123, 4127},
+  {4127, 4131}, {4131, 4135}, {4135, 4139}, {4139, 4143}, {4143, 4147}, {4147, 4151},
+  {4151, 4155}, {4155, 4159}, {4159, 4163}, {4163, 4167}, {4167, 4171}, {4171, 4175},
+  {4175, 4179}, {4179, 4183}, {4183, 4187}, {4187, 4191}, {4191, 4195}, {4195, 4199},
+  {4199, 4203}, {4203, 4207}, {4207, 4211}, {4211, 4215}, {4215, 4219}, {4219, 4223},
+  {4223, 4227}, {4227, 4231}, {4231, 4235}, {4235, 4239}, {4239, 4243}, {4243, 4247},
+  {4247, 4251}, {4251, 4255}, {4255, 4259}, {4259, 4263}, {4263, 4267}, {4267, 4271},
+  {4271, 4275}, {4275, 4279}, {4279, 4283}, {4283, 4287}, {4287, 4291}, {4291, 4295},
+  {4295, 4299}, {4299, 4303}, {4303, 4307}, {4307, 4311}, {4311, 4315}, {4315, 4319},
+  {4319, 4323}, {4323, 4327}, {4327, 4331}, {4331, 4335}, {4335, 4339}, {4339, 4343},
+  {4343, 4347}, {4347, 4351}, {4351, 4355}, {4355, 4359}, {4359, 4363}, {4363, 4367},
+  {4367, 4371}, {4371, 4375}, {4375, 4379}, {4379, 4383}, {4383, 4387}, {4387, 4391},
+  {4391, 4395}, {4395, 4399}, {4399, 4403}, {4403, 4407}, {4407, 4411}, {4411, 4415},
+  {4415, 4419}, {4419, 4423}, {4423, 4427}, {4427, 4431}, {4431, 4435}, {4435, 4439},
+  {4439, 4443}, {4443, 4447}, {4447, 4451}, {4451, 4455}, {4455, 4459}, {4459, 4463},
+  {4463, 4467}, {4467, 4471}, {4471, 4475}, {4475, 4479}, {4479, 4483}, {4483, 4487},
+  {4487, 4491}, {4491, 4495}, {4495, 4499}, {4499, 4503}, {4503, 4507}, {4507, 4511},
+  {4511, 4515}, {4515, 4519}, {4519, 4523}, {4523, 4527}, {4527, 4531}, {4531, 4535},
+  {4535, 4539}, {4539, 4543}, {4543, 4547}, {4547, 4551}, {4551, 4555}, {4555, 4559},
+  {4559, 4563}, {4563, 4567}, {4567, 4571}, {4571, 4575}, {4575, 4579}, {4579, 4583},
+  {4583, 4587}, {4587, 4591}, {4591, 4595}, {4595, 4599}, {4599, 4603}, {4603, 4607},
+  {4607, 4611}, {4611, 4615}, {4615, 4619}, {4619, 4623}, {4623, 4627}, {4627, 4631},
+  {4631, 4635}, {4635, 4639}, {4639, 4643}, {4643, 4647}, {4647, 4651}, {4651, 4655},
+  {4655, 4659}, {4659, 4663}, {4663, 4667}, {4667, 4671}, {4671, 4675}, {4675, 4679},
+  {4679, 4683}, {4683, 4687}, {4687, 4691}, {4691, 4695}, {4695, 4699}, {4699, 4703},
+  {4703, 4707}, {4707, 4711}, {4711, 4715}, {4715, 4719}, {4719, 4723}, {4723, 4727},
+  {4727, 4731}, {4731, 4735}, {4735, 4739}, {4739, 4743}, {4743, 4747}, {4747, 4751},
+  {4751, 4755}, {4755, 4759}, {4759, 4763}, {4763, 4767}, {4767, 4771}, {4771, 4775},
+  {4775, 4779}, {4779, 4783}, {4783, 4787}, {4787, 4791}, {4791, 4795}, {4795, 4799},
+  {4799, 4803}, {4803, 4807}, {4807, 4811}, {4811, 4815}, {4815, 4819}, {4819, 4823},
+  {4823, 4827}, {4827, 4831}, {4831, 4835}, {4835, 4839}, {4839, 4843}, {4843, 4847},
+  {4847, 4851}, {4851, 4855}, {4855, 4859}, {4859, 4863}, {4863, 4867}, {4867, 4871},
+  {4871, 4875}, {4875, 4879}, {4879, 4883}, {4883, 4887}, {4887, 4891}, {4891, 4895},
+  {4895, 4899}, {4899, 4903}, {4903, 4907}, {4907, 4911}, {4911, 4915}, {4915, 4919},
+  {4919, 4923}, {4923, 4927}, {4927, 4931}, {4931, 4935}, {4935, 4939}, {4939, 4943},
+  {4943, 4947}, {4947, 4951}, {4951, 4955}, {4955, 4959}, {4959, 4963}, {4963, 4967},
+  {4967, 4971}, {4971, 4975}, {4975, 4979}, {4979, 4983}, {4983, 4987}, {4987, 4991},
+  {4991, 4995}, {4995, 4999}, {4999, 5003}, {5003, 5007}, {5007, 5011}, {5011, 5015},
+  {5015, 5019}, {5019, 5023}, {5023, 5027}, {5027, 5031}, {5031, 5035}, {5035, 5039},
+  {5039, 5043}, {5043, 5047}, {5047, 5051}, {5051, 5055}, {5055, 5059}, {5059, 5063},
+  {5063, 5067}, {5067, 5071}, {5071, 5075}, {5075, 5079}, {5079, 5083}, {5083, 5087},
+  {5087, 5091}, {5091, 5095}, {5095, 5099}, {5099, 5103}, {5103, 5107}, {5107, 5111},
+  {5111, 5115}, {5115, 5119}, {5119, 5123}, {5123, 5127}, {5127, 5131}, {5131, 5135},
+  {5135, 5139}, {5139, 5143}, {5143, 5147}, {5147, 5151}, {5151, 5155}, {5155, 5159},
+  {5159, 5163}, {5163, 5167}, {5167, 5171}, {5171, 5175}, {5175, 5179}, {5179, 5183},
+  {5183, 5187}, {5187, 5191}, {5191, 5195}, {5195, 5199}, {5199, 5203}, {5203, 5207},
+  {5207, 5211}, {5211, 5215}, {5215, 5219}, {5219, 5223}, {5223, 5227}, {5227, 5231},
+  {5231, 5235}, {5235, 5239}, {5239, 5243}, {5243, 5247}, {5247, 5251}, {5251, 5255},
+  {5255, 5259}, {5259, 5263}, {5263, 5267}, {5267, 5271}, {5271, 5275}, {5275, 5279},
+  {5279, 5283}, {5283, 5287}, {5287, 5291}, {5291, 5295}, {5295, 5299}, {5299, 5303},
+  {5303, 5307}, {5307, 5311}, {5311, 5315}, {5315, 5319}, {5319, 5323}, {5323, 5327},
+  {5327, 5331}, {5331, 5335}, {5335, 5339}, {5339, 5343}, {5343, 5347}, {5347, 5351},
+  {5351, 5355}, {5355, 5359}, {5359, 5363}, {5363, 5367}, {5367, 5371}, {5371, 5375},
+  {5375, 5379}, {5379, 5383}, {5383, 5387}, {5387, 5391}, {5391, 5395}, {5395, 5399},
+  {5399, 5403}, {5403, 5407}, {5407, 5411}, {5411, 5415}, {5415, 5419}, {5419, 5423},
+  {5423, 5427}, {5427, 5431}, {5431, 5435}, {5435, 5439}, {5439, 5443}, {5443, 5447},
+  {5447, 5451}, {5451, 5455}, {5455, 5459}, {5459, 5463}, {5463, 5467}, {5467, 5471},
+  {5471, 5475}, {5475, 5479}, {5479, 5483}, {5483, 5487}, {5487, 5491}, {5491, 5495},
+  {5495, 5499}, {5499, 5503}, {5503, 5507}, {5507, 5511}, {5511, 5515}, {5515, 5519},
+  {5519, 5523}, {5523, 5527}, {5527, 5531}, {5531, 5535}, {5535, 5539}, {5539, 5543},
+  {5543, 5547}, {5547, 5551}, {5551, 5555}, {5555, 5559}, {5559, 5563}, {5563, 5567},
+  {5567, 5571}, {5571, 5575}, {5575, 5579}, {5579, 5583}, {5583, 5587}, {5587, 5591},
+  {5591, 5595}, {5595, 5599}, {5599, 5603}, {5603, 5607}, {5607, 5611}, {5611, 5615},
+  {5615, 5619}, {5619, 5623}, {5623, 5627}, {5627, 5631}, {5631, 5635}, {5635, 5639},
+  {5639, 5643}, {5643, 5647}, {5647, 5651}, {5651, 5655}, {5655, 5659}, {5659, 5663},
+  {5663, 5667}, {5667, 5671}, {5671, 5675}, {5675, 5679}, {5679, 5683}, {5683, 5687},
+  {5687, 5691}, {5691, 5695}, {5695, 5699}, {5699, 5703}, {5703, 5707}, {5707, 5711},
+  {5711, 5715}, {5715, 5719}, {5719, 5723}, {5723, 5727}, {5727, 5731}, {5731, 5735},
+  {5735, 5739}, {5739, 5743}, {5743, 5747}, {5747, 5751}, {5751, 5755}, {5755, 5759},
+  {5759, 5763}, {5763, 5767}, {5767, 5771}, {5771, 5775}, {5775, 5779}, {5779, 5783},
+  {5783, 5787}, {5787, 5791}, {5791, 5795}, {5795, 5799}, {5799, 5803}, {5803, 5807},
+  {5807, 5811}, {5811, 5815}, {5815, 5819}, {5819, 5823}, {5823, 5827}, {5827, 5831},
+  {5831, 5835}, {5835, 5839}, {5839, 5843}, {5843, 5847}, {5847, 5851}, {5851, 5855},
+  {5855, 5859}, {5859, 5863}, {5863, 5867}, {5867, 5871}, {5871, 5875}, {5875, 5879},
+  {5879, 5883}, {5883, 5887}, {5887, 5891}, {5891, 5895}, {5895, 5899}, {5899, 5903},
+  {5903, 5907}, {5907, 5911}, {5911, 5915}, {5915, 5919}, {5919, 5923}, {5923, 5927},
+  {5927, 5931}, {5931, 5935}, {5935, 5939}, {5939, 5943}, {5943, 5947}, {5947, 5951},
+  {5951, 5955}, {5955, 5959}, {5959, 5963}, {5963, 5967}, {5967, 5971}, {5971, 5975},
+  {5975, 5979}, {5979, 5983}, {5983, 5987}, {5987, 5991}, {5991, 5995}, {5995, 5999},
+  {5999, 6003}, {6003, 6007}, {6007, 6011}, {6011, 6015}, {6015, 6019}, {6019, 6023},
+  {6023, 6027}, {6027, 6031}, {6031, 6035}, {6035, 6039}, {6039, 6043}, {6043, 6047},
+  {6047, 6051}, {6051, 6055}, {6055, 6059}, {6059, 6063}, {6063, 6067}, {6067, 6071},
+  {6071, 6075}, {6075, 6079}, {6079, 6083}, {6083, 6087}, {6087, 6091}, {6091, 6095},
+  {6095, 6099}, {6099, 6103}, {6103, 6107}, {6107, 6111}, {6111, 6115}, {6115, 6119},
+  {6119, 6123}, {6123, 6127}, {6127, 6131}, {6131, 6135}, {6135, 6139}, {6139, 6143},
+  {6143, 6147}, {6147, 6151}, {6151, 6155}, {6155, 6159}, {6159, 6163}, {6163, 6167},
+  {6167, 6171}, {6171, 6175}, {6175, 6179}, {6179, 6183}, {6183, 6187}, {6187, 6191},
+  {6191, 6195}, {6195, 6199}, {6199, 6203}, {6203, 6207}, {6207, 6211}, {6211, 6215},
+  {6215, 6219}, {6219, 6223}, {6223, 6227}, {6227, 6231}, {6231, 6235}, {6235, 6239},
+  {6239, 6243}, {6243, 6247}, {6247, 6251}, {6251, 6255}, {6255, 6259}, {6259, 6263},
+  {6263, 6267}, {6267, 6271}, {6271, 6275}, {6275, 6279}, {6279, 6283}, {6283, 6287},
+  {6287, 6291}, {6291, 6295}, {6295, 6299}, {6299, 6303}, {6303, 6307}, {6307, 6311},
+  {6311, 6315}, {6315, 6319}, {6319, 6323}, {6323, 6327}, {6327, 6331}, {6331, 6335},
+  {6335, 6339}, {6339, 6343}, {6343, 6347}, {6347, 6351}, {6351, 6355}, {6355, 6359},
+  {6359, 6363}, {6363, 6367}, {6367, 6371}, {6371, 6375}, {6375, 6379}, {6379, 6383},
+  {6383, 6387}, {6387, 6391}, {6391, 6395}, {6395, 6399}, {6399, 6403}, {6403, 6407},
+  {6407, 6411}, {6411, 6415}, {6415, 6419}, {6419, 6423}, {6423, 6427}, {6427, 6431},
+  {6431, 6435}, {6435, 6439}, {6439, 6443}, {6443, 6447}, {6447, 6451}, {6451, 6455},
+  {6455, 6459}, {6459, 6463}, {6463, 6467}, {6467, 6471}, {6471, 6475}, {6475, 6479},
+  {6479, 6483}, {6483, 6487}, {6487, 6491}, {6491, 6495}, {6495, 6499}, {6499, 6503},
+  {6503, 6507}, {6507, 6511}, {6511, 6515}, {6515, 6519}, {6519, 6523}, {6523, 6527},
+  {6527, 6531}, {6531, 6535}, {6535, 6539}, {6539, 6542}
+};
+#else
+#if (GMP_NUMB_BITS == 32)
+static const mp_limb_t primesProducts[] = {
+  0x05AA381F, 0x361592B7, 0xF64D985D, 0x073B5A0D, 0x0F5A0395, 0x1D43FFDD,
+  0x323E7003, 0x4E5884B7, 0x7EB0F0B1, 0xB72EFC93, 0x0102DEDD, 0x01341EFF,
+  0x0163888F, 0x01C7FF8D, 0x021B8E8F, 0x028C4DAF, 0x02EDE03D, 0x035D9A99,
+  0x03E18615, 0x04881841, 0x0504EB9D, 0x05A363B5, 0x062C59C3, 0x071CAB57,
+  0x07F35EF3, 0x0939999D, 0x0AA2ACFF, 0x0B870189, 0x0CB96FEF, 0x0DAF1D73,
+  0x0EEC4E3D, 0x10313A91, 0x11793CEF, 0x130B5E75, 0x154CB85F, 0x17790271,
+  0x192D52BD, 0x1AF690DD, 0x1E3EDD3F, 0x20A97EA1, 0x2248EB29, 0x256DB61F,
+  0x27BE57C3, 0x2A578F87, 0x2E5BC8F9, 0x31C4E00F, 0x3555F625, 0x38BA8399,
+  0x3CBD7A99, 0x3FEF5C69, 0x431B892F, 0x46A73431, 0x4B9041F9, 0x4ED40E63,
+  0x52EACD03, 0x594E3B97, 0x5FDDCF2D, 0x655F022B, 0x6B9C7F2B, 0x6F8C273F,
+  0x77B0BB5F, 0x7E134AE5, 0x81D83257, 0x85E3959B, 0x8E343CB7, 0x9A7E9327,
+  0xA730F9F9, 0xAE2C7577, 0xB415AF93, 0xB9DF3349, 0xC2AA2C0D, 0xC6A045E7,
+  0xD2000BA7, 0xDD3E200B, 0xE4C1637B, 0xEDEDEB91, 0xF6BDFDFF, 0xFC50D403,
+  0x0028A3E7, 0x002A0C07, 0x002A740F, 0x002BD6BD, 0x002C4E27, 0x002D3F23,
+  0x002E09C1, 0x002EBADB, 0x002FB1EF, 0x00309E2D, 0x003129E5, 0x0032604D,
+  0x00339A61, 0x00350437, 0x003578FF, 0x0035D0E3, 0x0036CB4D, 0x0037AA5B,
+  0x0038F48F, 0x003A0583, 0x003B9437, 0x003C6D1B, 0x003CE9C3, 0x003D7681,
+  0x003E628B, 0x003F20AB, 0x0040A04B, 0x0041B2B5, 0x00425555, 0x0042E82B,
+  0x00440FFF, 0x00453A43, 0x0045D055, 0x004666F7, 0x0047D9D3, 0x004A3045,
+  0x004AFF81, 0x004C6D03, 0x004D0AA1, 0x004E7D0F, 0x004F1CC9, 0x005004BB,
+  0x0050EDDD, 0x005244CB, 0x00538D0F, 0x005431E5, 0x005545DF, 0x00565BF5,
+  0x0056DE3B, 0x00579907, 0x0058EB3B, 0x005A19D3, 0x005B2487, 0x005C90B1,
+  0x005D7835, 0x006048AF, 0x00620E61, 0x0062E8BB, 0x0063881B, 0x0065F64D,
+  0x00673A51, 0x0068A995, 0x006A58CF, 0x006BCD83, 0x006C88A9, 0x006D9837,
+  0x006E3FFF, 0x006EE837, 0x006FFAB5, 0x00708F07, 0x0071B8E3, 0x0072F9A1,
+  0x00743C0F, 0x00762E1D, 0x00771DDB, 0x0077CCC3, 0x0079DC33, 0x007B1237,
+  0x007C499B, 0x007DAF13, 0x007F9E77, 0x0080DB9B, 0x008247CB, 0x00846DD3,
+  0x0085B0F7, 0x008698A3, 0x0089543F, 0x008AB4A1, 0x008C16B3, 0x008D7AC9,
+  0x008F4037, 0x0090D84D, 0x00928A75, 0x009488FF, 0x0097671B, 0x009923FF,
+  0x009AB0F7, 0x009BF4E5, 0x009D8599, 0x009EB361, 0x00A15E8F, 0x00A1F723,
+  0x00A4A875, 0x00A69237, 0x00A7C887, 0x00A8CBFB, 0x00A9EA2D, 0x00AB8C4D,
+  0x00ACE18B, 0x00AE6CB9, 0x00B04971, 0x00B2C8DD, 0x00B5EEF9, 0x00B6E223,
+  0x00B7848F, 0x00BA62E1, 0x00BC6B1B, 0x00BDEC3F, 0x00BEC8F7, 0x00BFA637,
+  0x00C12AA3, 0x00C32027, 0x00C46FF7, 0x00C6DA9B, 0x00C7F507, 0x00C981BB,
+  0x00CB6549, 0x00CDBE3F, 0x00CF16DF, 0x00D0C7A5, 0x00D279EB, 0x00D44B3B,
+  0x00D6932B, 0x00D8A43F, 0x00DAB733, 0x00DC5637, 0x00DEE543, 0x00E0FFCF,
+  0x00E2688F, 0x00E48753, 0x00E64DD9, 0x00E92895, 0x00EA3BC3, 0x00EB30DB,
+  0x00EC829D, 0x00EEEB15, 0x00F387B5, 0x00F4C055, 0x00F618F7, 0x00F71437,
+  0x00FA4843, 0x00FC2381, 0x00FEA055, 0x00FFFFF7, 0x0102E1D1, 0x010464C5,
+  0x01064993, 0x0107CF03, 0x010BC139, 0x010EF65B, 0x01103FE7, 0x0111CC77,
+  0x01135A27, 0x0114E90F, 0x011678FF, 0x01184CFB, 0x011BB55F, 0x011F24C3,
+  0x012121F1, 0x012320E7, 0x01269ADB, 0x01296D5D, 0x012BB8AF, 0x012E06BD,
+  0x012F8587, 0x01328603, 0x0134FD5F, 0x01370DC5, 0x0137E18D, 0x013B9E0F,
+  0x013DD787, 0x01410DA9, 0x0142E037, 0x0146F579, 0x0148A83D, 0x0149EEE3,
+  0x014B5A87, 0x014DA207, 0x0150A2CD, 0x01543AC3, 0x01558715, 0x01590059,
+  0x015D5E5D, 0x015E3ECD, 0x015F8FFF, 0x0161C35D, 0x01665463, 0x016A7C5B,
+  0x016DC3CF, 0x017075AB, 0x01732A0F, 0x01745E87, 0x01767B9B, 0x01789A3F,
+  0x017A6C5F, 0x017CDC07, 0x017E62BB, 0x017FEA27, 0x018236B1, 0x0185E871,
+  0x01899E8D, 0x018BCAB5, 0x018D80F7, 0x018F6007, 0x0194B37B, 0x0197B15D,
+  0x019A0FE7, 0x019D12C5, 0x01A13665, 0x01A22BA5, 0x01A74C45, 0x01A963FF,
+  0x01AC9E87, 0x01AF35DF, 0x01B31CDF, 0x01B75B83, 0x01BB4CBB, 0x01BD70C9,
+  0x01BF6BED, 0x01C1133D, 0x01C3657D, 0x01C48F1B, 0x01C9397B, 0x01CA650D,
+  0x01CDEA03, 0x01CFC32D, 0x01D19D87, 0x01D4FD97, 0x01D8B8FB, 0x01DA97C1,
+  0x01DFB571, 0x01E5603F, 0x01E6ED1D, 0x01E7F60D, 0x01E983E7, 0x01ED535B,
+  0x01EF3C71, 0x01F2323B, 0x01F690B5, 0x01F7CABB, 0x01FDF2B5, 0x020098F7,
+  0x020313BB, 0x02058FF7, 0x0208969D, 0x020A31A3, 0x020BCD45, 0x020D698F,
+  0x020F903F, 0x02132887, 0x0217AB55, 0x021B78F3, 0x022263F7, 0x0226F72D,
+  0x022B6011, 0x022D9645, 0x02305B5F, 0x02335207, 0x0235EB63, 0x02391535,
+  0x023CA12B, 0x023EE00B, 0x02427085, 0x0247B601, 0x024ABCAD, 0x024D331B,
+  0x024F4991, 0x02546D77, 0x02571A1B, 0x0258A1FB, 0x025C4695, 0x025EC66B,
+  0x026178F7, 0x0263FB79, 0x0266E277, 0x0269363F, 0x026B277B, 0x026DE0E7,
+  0x0272C1C1, 0x0278712B, 0x027CC5BF, 0x02802119, 0x0285DF03, 0x028C3E13,
+  0x028F0A3F, 0x0291D79B, 0x0293723B, 0x0296A8B3, 0x029B4B15, 0x02A1C439,
+  0x02A4D00F, 0x02A81187, 0x02AAEC83, 0x02AD6043, 0x02AFD50B, 0x02B4245D,
+  0x02B9B3E3, 0x02BD6C0F, 0x02BFE83F, 0x02C443E5, 0x02C7638F, 0x02C943E9,
+  0x02CE1287, 0x02D02AE3, 0x02D49379, 0x02D85E05, 0x02DD38AF, 0x02E1E2CB,
+  0x02E40287, 0x02E622FB, 0x02E8E7E9, 0x02EB778D, 0x02EF1A37, 0x02F2BF0D,
+  0x02F66633, 0x02FB926B, 0x03027EFB, 0x03066787, 0x0309E297, 0x030FFFAF,
+  0x0314D1DB, 0x0318FE8D, 0x031A88F7, 0x031E4871, 0x0320EF25, 0x0326062F,
+  0x032D960B, 0x03307C45, 0x0334490F, 0x03385163, 0x033F48A9, 0x0346BC5B,
+  0x034D14F3, 0x0350B883, 0x035581CD, 0x03578FFF, 0x035AFE51, 0x035EE3F7,
+  0x0361E059, 0x03646837, 0x0366B5EB, 0x0369B5BD, 0x036CB707, 0x036F07A3,
+  0x037281F5, 0x03785173, 0x037C0C7B, 0x0381E44D, 0x0384F007, 0x038784D1,
+  0x038B0B53, 0x038E93E5, 0x0393C565, 0x03965FC3, 0x039E341D, 0x03A51C87,
+  0x03A8B1B5, 0x03AEAE5F, 0x03B24885, 0x03B3B9CD, 0x03B943F7, 0x03BDDA99,
+  0x03C0C1FD, 0x03C464C3, 0x03CB3203, 0x03D30163, 0x03D76897, 0x03DE4837,
+  0x03E2F555, 0x03E62A3F, 0x03E86331, 0x03EC97BB, 0x03F1CC21, 0x03F90307,
+  0x03FBC111, 0x0401FFEF, 0x0407030F, 0x040A063F, 0x040C08F7, 0x0412955B,
+  0x04161E0F, 0x0419270F, 0x041C30CF, 0x042102E5, 0x0429EB8B, 0x042DBFE9,
+  0x0431960F, 0x043A0CD5, 0x043C5D43, 0x04403A05, 0x044520F7, 0x04504375,
+  0x0454AE87, 0x045853A3, 0x045C3CAD, 0x046282F1, 0x046803E3, 0x046CBE0F,
+  0x046FE68F, 0x04741E07, 0x0479ED9B, 0x047D5E6D, 0x04808CA5, 0x0483BBF1,
+  0x04873087, 0x048BFB7B, 0x048EA637, 0x04921EE9, 0x04988B25, 0x049EFBD5,
+  0x04A3048F, 0x04A6C9FB, 0x04A97C77, 0x04AE5983, 0x04B26885, 0x04BAD1AF,
+  0x04C11545, 0x04C52CAB, 0x04CAA41B, 0x04CFD7AD, 0x04D50F87, 0x04D7428F,
+  0x04DD97D5, 0x04E0A0DB, 0x04E55361, 0x04EEBF2D, 0x04F49533, 0x04F9519D,
+  0x04FE9EFB, 0x0502413D, 0x050703F7, 0x050BC8DD, 0x050FB7DD, 0x0514C8FD,
+  0x05194C01, 0x0521C77D, 0x05245427, 0x052BFE39, 0x05304293, 0x0533AE03,
+  0x0538D087, 0x053FAE0F, 0x05444437, 0x0548DC37, 0x054BBC2B, 0x054E5355,
+  0x0552A56B, 0x0556FA2D, 0x055A2807, 0x055F5DDB, 0x0565BF77, 0x056B8FF7,
+  0x056F5925, 0x057C7DF3, 0x0582F0F7, 0x0585E09B, 0x05891C35, 0x058E68AD,
+  0x059531C3, 0x0599A0B9, 0x05A1A03F, 0x05A66037, 0x05A9593B, 0x05AFE63F,
+  0x05B4AC37, 0x05B88E75, 0x05BDA4DB, 0x05C2BD6D, 0x05C6F155, 0x05CADA03,
+  0x05D09295, 0x05D5B373, 0x05DC0C59, 0x05E09763, 0x05E523E1, 0x05ECBCBB,
+  0x05F8523F, 0x06017F63, 0x060978F7, 0x060C8B8B, 0x0612158F, 0x0614DB75,
+  0x061B55EB, 0x0620E70F, 0x06258C29, 0x0628F55B, 0x062CFE85, 0x06342553,
+  0x063DCFCD, 0x0643205B, 0x06473201, 0x064A03FF, 0x06513BAD, 0x065551F7,
+  0x065AFCCB, 0x065DD33D, 0x06628F13, 0x066C0C17, 0x06768425, 0x067C3E7D,
+  0x0683E48D, 0x0685CEC5, 0x068C84AB, 0x0692480F, 0x06990431, 0x06A0BA9D,
+  0x06AB5DCB, 0x06B2276D, 0x06B5B6BB, 0x06BBDF15, 0x06C11095, 0x06C5F107,
+  0x06CB7995, 0x06D2FA3F, 0x06D888A5, 0x06DD1DB5, 0x06E207F3, 0x06EBE227,
+  0x06F1CECB, 0x06FF023B, 0x07044D7B, 0x07079D8F, 0x070C96D9, 0x07119263,
+  0x0716E49B, 0x07218F23, 0x072691C1, 0x072E43F7, 0x0732F53B, 0x073B59A1,
+  0x0747CF77, 0x074BDC27, 0x07504075, 0x0754A63B, 0x075D1EB5, 0x07608355,
+  0x076A5F2B, 0x076E756B, 0x077186ED, 0x077BC559, 0x07881A0D, 0x078C905B,
+  0x079107E5, 0x07968959, 0x079E1E6D, 0x07A2F3CD, 0x07AA3617, 0x07B17C81,
+  0x07BADBF7, 0x07C0C585, 0x07C97B73, 0x07CEB7F5, 0x07D71C25, 0x07DD107B,
+  0x07DFDE9B, 0x07E5D611, 0x07EF54CB, 0x07F8D925, 0x0801AF1B, 0x0807B32D,
+  0x080ECA95, 0x081D0205, 0x08236C49, 0x0828C68F, 0x082F3523, 0x083601CD,
+  0x0844B803, 0x0847985B, 0x084E1307, 0x0852C281, 0x085716F5, 0x08599E07,
+  0x08641AED, 0x086DE477, 0x0872F9FB, 0x0879E2B5, 0x087DE3F7, 0x0881E615,
+  0x088819F7, 0x088C7C27, 0x08942A65, 0x089E0F97, 0x08A4AC63, 0x08AB4A97,
+  0x08B48069, 0x08BB8437, 0x08BE1A5D, 0x08C57FB9, 0x08CDA721, 0x08D0FE03,
+  0x08DF1E37, 0x08E63259, 0x08EE08FF, 0x08F2850F, 0x08F7C1DB, 0x08FCA04D,
+  0x0902A00D, 0x090E459B, 0x09156CAD, 0x0920BD8D, 0x0924849D, 0x092C1569,
+  0x0930A0F1, 0x09377465, 0x093EAB9B, 0x09470A07, 0x094BFDCD, 0x09502F87,
+  0x0955877B, 0x095CCA55, 0x0960FFF7, 0x096782E1, 0x096ECD07, 0x09749005,
+  0x097B1A0F, 0x0981433F, 0x09876F07, 0x098C10F7, 0x099557EF, 0x099D1707,
+  0x09A3AED9, 0x09AD0195, 0x09B46637, 0x09BE88AB, 0x09C58FF7, 0x09CC99E3,
+  0x09D1B0A5, 0x09DFCE6D, 0x09E9A3F7, 0x09EEC265, 0x09F24E63, 0x09F7D3BF,
+  0x0A014F07, 0x0A06D8DB, 0x0A0B33F5, 0x0A138763, 0x0A15E8FF, 0x0A20A3B5,
+  0x0A25045B, 0x0A31C503, 0x0A3AF5E5, 0x0A408F75, 0x0A495F3D, 0x0A509839,
+  0x0A556A11, 0x0A5AA407, 0x0A637E63, 0x0A6C5E27, 0x0A74D979, 0x0A7C2151,
+  0x0A88B13B, 0x0A8F97FD, 0x0A96E91D, 0x0A9A92A3, 0x0AA93ED3, 0x0AB30CE3,
+  0x0AB9989B, 0x0AC08EED, 0x0AC9FEBB, 0x0ACEEC9B, 0x0AD580CB, 0x0ADF62D3,
+  0x0AE94973, 0x0AF5B00F, 0x0AFFA0CF, 0x0B085719, 0x0B0FD1C1, 0x0B174E91,
+  0x0B250FCB, 0x0B293C87, 0x0B2C940F, 0x0B312D0D, 0x0B369D77, 0x0B3ACD7B,
+  0x0B468B1B, 0x0B497B7D, 0x0B5391E1, 0x0B5B25A9, 0x0B668823, 0x0B6EFA53,
+  0x0B798E25, 0x0B7C18AD, 0x0B84FFC3, 0x0B8864DB, 0x0B8F308B, 0x0B988B2F,
+  0x0BA708A3, 0x0BB06E77, 0x0BB745BF, 0x0BC0B153, 0x0BCA20CF, 0x0BD1DC03,
+  0x0BD84EBD, 0x0BED6CFB, 0x0BF1BE87, 0x0BF9F53D, 0x0C05A60B, 0x0C12A9C7,
+  0x0C1A7CE3, 0x0C2A993D, 0x0C3581EF, 0x0C3B3075, 0x0C438037, 0x0C526693,
+  0x0C59DD75, 0x0C6004CD, 0x0C654C35, 0x0C6B057B, 0x0C7130FF, 0x0C7AE5D3,
+  0x0C8663CF, 0x0C93ACD3, 0x0C99E287, 0x0C9E52E3, 0x0CA2523D, 0x0CAA521D,
+  0x0CB7AE1D, 0x0CC10D0F, 0x0CC49F87, 0x0CCD1D7D, 0x0CD6835F, 0x0CE3F693,
+  0x0CEA3FF7, 0x0CF08ABB, 0x0CF50A37, 0x0CFA7107, 0x0D004C5D, 0x0D05B585,
+  0x0D108AF9, 0x0D192237, 0x0D1F0455, 0x0D28FC39, 0x0D2FCA8B, 0x0D369A8D,
+  0x0D40265B, 0x0D4B14CB, 0x0D51EBD5, 0x0D584F85, 0x0D684F03, 0x0D7438CF,
+  0x0D835E91, 0x0D8BA545, 0x0D912B11, 0x0D98FFF7, 0x0DA325CB, 0x0DA8B083,
+  0x0DB08C05, 0x0DBC1E5F, 0x0DC38907, 0x0DCF9A4B, 0x0DD69309, 0x0DE1BE45,
+  0x0DE5EFA3, 0x0DEB87AB, 0x0DF120EB, 0x0DF899BB, 0x0DFF24F7, 0x0E06A13F,
+  0x0E0FFFFF, 0x0E1708DD, 0x0E1CAAC9, 0x0E26107D, 0x0E324CAD, 0x0E38E581,
+  0x0E40EA37, 0x0E49E2B5, 0x0E53D0CF, 0x0E620613, 0x0E6BFC79, 0x0E757C6D,
+  0x0E7D91EF, 0x0E8791E5, 0x0E920F45, 0x0E96D545, 0x0E9B9BCD, 0x0EA24CF5,
+  0x0EA80A7D, 0x0EBF0BDD, 0x0EC1ED4D, 0x0EC63FE7, 0x0ECFDD87, 0x0ED790DF,
+  0x0EDE4FBB, 0x0EE418FB, 0x0EEADA87, 0x0F020FBF, 0x0F09D087, 0x0F0F25ED,
+  0x0F166D9B, 0x0F1BC55D, 0x0F28E617, 0x0F34970F, 0x0F404BF7, 0x0F4C04E7,
+  0x0F5F1C95, 0x0F620D7D, 0x0F64FEAD, 0x0F6DD3ED, 0x0F733B07, 0x0F7C9211,
+  0x0F86E88F, 0x0F9D1AAD, 0x0FA0117D, 0x0FAE6907, 0x0FB35CA3, 0x0FBDC515,
+  0x0FC732BB, 0x0FDB1513, 0x0FE808F7, 0x0FF18325, 0x0FF7013B, 0x1005FFAF,
+  0x101184C5, 0x1017083B, 0x1020907D, 0x10289911, 0x10322707, 0x103D397B,
+  0x104D5C53, 0x1056F4D9, 0x105D871B, 0x106F3EC5, 0x107962BD, 0x108181C1,
+  0x10881CBB, 0x108EB8B5, 0x109B728F, 0x10A00885, 0x10B1611D, 0x10BA93BD,
+  0x10C5D4A1, 0x10DB5C3D, 0x10E20903, 0x10EFE92D, 0x10FC44DD, 0x11037BDD,
+  0x110C40AF, 0x1115083D, 0x111AB787, 0x112AC1B9, 0x11317E37, 0x113AD393,
+  0x11463FF7, 0x1149E32D, 0x1150A587, 0x115B9301, 0x116BBC37, 0x11741627,
+  0x117D7DB3, 0x118EC269, 0x119AD07B, 0x11A095C5, 0x11A65C3F, 0x11B48CD9,
+  0x11C91503, 0x11D4B0F7, 0x11E0D6ED, 0x11E6A7BB, 0x11EF1EEB, 0x11FAC5EF,
+  0x1203CA0D, 0x1206F91D, 0x121087C1, 0x121908FD, 0x1224359B, 0x12307685,
+  0x12365437, 0x123BAA43, 0x12429B1D, 0x125080CD, 0x126119EF, 0x1269AE37,
+  0x1270A7B9, 0x1278B5F7, 0x1283FFED, 0x1295C423, 0x129EEE55, 0x12A9B931,
+  0x12B7C671, 0x12C323AB, 0x12CA2E35, 0x12DAFE1B, 0x12E20CF1, 0x12F3FE27,
+  0x12FB11D5, 0x1309C8AF, 0x13176DED, 0x131E8863, 0x13251803, 0x132BA8AB,
+  0x1338CDA3, 0x1341935B, 0x13470FF7, 0x13506511, 0x1366F223, 0x136A3FFF,
+  0x1370DC8F, 0x137D8BA5, 0x138B5997, 0x13943287, 0x13989F8F, 0x13A05F7B,
+  0x13B071DD, 0x13BB8B59, 0x13C6199B, 0x13CCC5BB, 0x13D5ACB3, 0x13DCEA5D,
+  0x13E9BC53, 0x13F3392D, 0x13FB0B15, 0x1401BFE1, 0x14104C15, 0x141C9F7D,
+  0x1427473F, 0x1431F24D, 0x143EDFFB, 0x1445104D, 0x144C61DB, 0x1455F58D,
+  0x146530EB, 0x14710D8D, 0x1477D609, 0x1480E385, 0x14966B6D, 0x14A1C459,
+  0x14BAC761, 0x14C99699, 0x14D59027, 0x14E0FB07, 0x14ECFB3D, 0x14F62271,
+  0x150598DF, 0x150E32B5, 0x151D1DD5, 0x1535D8E7, 0x154D79CD, 0x15533F45,
+  0x155DA3B5, 0x1570B9B3, 0x157E9FCB, 0x158ACD85, 0x1598279B, 0x15A7443F,
+  0x15B09407, 0x15B53C87, 0x15D00ED3, 0x15DB27E9, 0x15E89ABF, 0x15F61189,
+  0x1600088F, 0x1607A84D, 0x16123915, 0x161DF971, 0x16288F61, 0x1636B101,
+  0x164311D3, 0x166098F7, 0x16655437, 0x166D0575, 0x167A0D55, 0x167D9BBD,
+  0x16812A6D, 0x1688E087, 0x16926007, 0x169850C3, 0x169E4237, 0x16A72DCD,
+  0x16B576F1, 0x16C32CE3, 0x16CB8707, 0x16D6465B, 0x16DFD5F3, 0x16E967DB,
+  0x17105C2D, 0x171CF977, 0x17243027, 0x172F044B, 0x173CDE1D, 0x17437F87,
+  0x174BF0F3, 0x175C3E29, 0x1767BA37, 0x17777603, 0x17808C11, 0x178D472B,
+  0x179BD88B, 0x17A89BD9, 0x17B4C64D, 0x17C05823, 0x17C8E037, 0x17D2A23F,
+  0x17D9F4DF, 0x17E4F363, 0x17EEBAD3, 0x17FA5ACD, 0x180870AF, 0x18172837,
+  0x181DE865, 0x1824A97B, 0x1830565D, 0x18367C75, 0x1842CB5D, 0x184D43AF,
+  0x18619DDD, 0x186B7EE1, 0x187A5481, 0x188B09F7, 0x189F7DD5, 0x18A6EFD1,
+  0x18AF01FB, 0x18B3FA23, 0x18C10775, 0x18CB9B87, 0x18D3B3AD, 0x18E48777,
+  0x18F3806F, 0x19009FFD, 0x1911830F, 0x191D687D, 0x192950FB, 0x19303705,
+  0x1948B487, 0x19572B39, 0x196463FF, 0x19788FAF, 0x198A3CDF, 0x19959D43,
+  0x19A1A1DD, 0x19A8988F, 0x19ADA987, 0x19B7CD0F, 0x19C84AB3, 0x19DBFA39,
+  0x19F2E2C1, 0x19FE5A59, 0x1A07EA83, 0x1A10D8AF, 0x1A1EE50B, 0x1A2B09CD,
+  0x1A37313F, 0x1A43FFAF, 0x1A50D18F, 0x1A54AAA3, 0x1A5A70B9, 0x1A6FA20F,
+  0x1A7B346B, 0x1A8BF0F7, 0x1A9CB213, 0x1AA7049B, 0x1AB00E37, 0x1AB9194B,
+  0x1AC2CB95, 0x1ACB33F3, 0x1AD97237, 0x1AEF7BEB, 0x1AFDC3F7, 0x1B148385,
+  0x1B186ACD, 0x1B2763F7, 0x1B3D8E03, 0x1B436D69, 0x1B4B430D, 0x1B546835,
+  0x1B6C9A43, 0x1B82E187, 0x1B88208F, 0x1B8E0805, 0x1B99D8DD, 0x1B9E71DB,
+  0x1BB37B63, 0x1BB8BEFB, 0x1BC347AB, 0x1BCB2F8B, 0x1BD3188B, 0x1BD9081D,
+  0x1BEED0FF, 0x1BFB5FA5, 0x1C0BE9BF, 0x1C1E760F, 0x1C2A65E3, 0x1C35041B,
+  0x1C3FA45B, 0x1C4EEE1D, 0x1C5A3D93, 0x1C678ED3, 0x1C7238CB, 0x1C7C39D5,
+  0x1C863C77, 0x1C979A73, 0x1CAC56D9, 0x1CB90FAF, 0x1CCE83CF, 0x1CD940F7,
+  0x1CE6AFDF, 0x1CF0193B, 0x1CF77F25, 0x1D04F55D, 0x1D0C5E07, 0x1D17268F,
+  0x1D234A83, 0x1D2E173B, 0x1D378BDF, 0x1D41AF75, 0x1D487295, 0x1D5A0B9D,
+  0x1D79E833, 0x1D8C3E0D, 0x1D930A05, 0x1D971E4D, 0x1DA2004D, 0x1DB50FB5,
+  0x1DCB9093, 0x1DD72B4D, 0x1DE4261B, 0x1DF69C29, 0x1E065B87, 0x1E120149,
+  0x1E206843, 0x1E30E1CB, 0x1E458027, 0x1E4C613B, 0x1E5C368D, 0x1E6CBEF1,
+  0x1E7F610F, 0x1E8BCF43, 0x1E920741, 0x1EA4B32B, 0x1EB28B9B, 0x1EB978E7,
+  0x1EC3DE7D, 0x1ECD9405, 0x1ED6998B, 0x1EE95A69, 0x1EF1B1FD, 0x1F02646D,
+  0x1F147EE5, 0x1F25EE8F, 0x1F2FB39B, 0x1F44A837, 0x1F5623E1, 0x1F663DEF,
+  0x1F717427, 0x1F867ECB, 0x1F91BA9B, 0x1F98C0F7, 0x1F9FC80B, 0x1FA8EC0D,
+  0x1FB0A943, 0x1FB6FEC9, 0x1FC2F787, 0x1FD3E1BF, 0x1FE8589D, 0x1FFAB709,
+  0x20077169, 0x20142EBD, 0x2019239B, 0x20308621, 0x20495DCB, 0x2056280F,
+  0x205EB00F, 0x206CEB07, 0x20757637, 0x2088B365, 0x2098642D, 0x20B43FCF,
+  0x20C8FE25, 0x20DFE8F9, 0x20F90387, 0x2105F0C3, 0x2110B7F1, 0x21173063,
+  0x211FD1B3, 0x212FA787, 0x2136DB5B, 0x21448CCD, 0x2148E05D, 0x216222BB,
+  0x2167EA1B, 0x2172083F, 0x21906B4B, 0x219B497D, 0x21A3FC19, 0x21AD699B,
+  0x21BF8E85, 0x21CED037, 0x21D843B5, 0x21E3E6C9, 0x21F6D57D, 0x21FF93E9,
+  0x22090E37, 0x221344A3, 0x221CC185, 0x223AB6DF, 0x2245B035, 0x2252DD79,
+  0x225E9605, 0x22681D9B, 0x2276C93B, 0x228577EB, 0x228FC0F7, 0x229A0B7B,
+  0x22A2228D, 0x22A68C9D, 0x22B2535D, 0x22BED8CF, 0x22D4F72B, 0x22E008C9,
+  0x22F1C255, 0x230148CB, 0x230C61AD, 0x23316A75, 0x234AA699, 0x23626DC5,
+  0x236A9C37, 0x237BBA21, 0x238863F7, 0x2392D2F3, 0x23A63797, 0x23B5E639,
+  0x23CA1427, 0x23D78B4B, 0x23E504DF, 0x23F4C07D, 0x24138253, 0x24264A19,
+  0x2442DECD, 0x244E2A37, 0x2458B65B, 0x246D1191, 0x24877E5F, 0x249518F3,
+  0x24A5BD07, 0x24B41EFD, 0x24CA1887, 0x24D27001, 0x24E7B005, 0x24FDB8E7,
+  0x250490ED, 0x25191C77, 0x25291B4D, 0x252FF743, 0x25418101, 0x25592C3F,
+  0x2564A22D, 0x257DE00F, 0x259040CF, 0x259BBFBD, 0x25A98CFD, 0x25B9AB0B,
+  0x25C2E243, 0x25CF2D7B, 0x25EC6827, 0x25F8BA37, 0x26006E7B, 0x261853F1,
+  0x262ADBED, 0x26329525, 0x2646AE05, 0x264FF641, 0x265D1E9B, 0x26745BEF,
+  0x26818AAD, 0x2695B839, 0x269F0A1D, 0x26A7961B, 0x26BFAECD, 0x26E06685,
+  0x26F7CB81, 0x27012965, 0x270C17F5, 0x2714B01B, 0x27251AB5, 0x27300E8D,
+  0x27407EEB, 0x274B7687, 0x275CB56B, 0x2771E4C9, 0x2780D0F7, 0x278E2D3D,
+  0x279EB0EB, 0x27ACDC3F, 0x27C47E2B, 0x27D2B03F, 0x27E40CBB, 0x27F8960F,
+  0x28086607, 0x28150E8F, 0x281C2E35, 0x282B39EF, 0x284236D9, 0x284BBC1D,
+  0x285A05C5, 0x2866BB05, 0x2880F6AF, 0x289CD441, 0x28A3FFFF, 0x28B258CB,
+  0x28C7E3D9, 0x28D576FB, 0x28DF0D5B, 0x28EF0A7B, 0x2903D827, 0x29124263,
+  0x291BDFE3, 0x292A4D97, 0x293CC25D, 0x29499B5D, 0x295CE461, 0x296DC7DF,
+  0x2982B5DB, 0x298D2EB9, 0x299AE287, 0x29A62CFB, 0x29B650CB, 0x29CE8C77,
+  0x29DAAD05, 0x29F084DB, 0x2A0B407D, 0x2A1DE693, 0x2A363FAF, 0x2A4A9099,
+  0x2A5BA40B, 0x2A6F2D23, 0x2A75B0FB, 0x2A7DD68F, 0x2A879E3F, 0x2A8E23F7,
+  0x2A964BE3, 0x2AA4FB97, 0x2ABF1F07, 0x2AD532AD, 0x2AE590D5, 0x2AF37CF7,
+  0x2B023D43, 0x2B10FFFF, 0x2B1AD88F, 0x2B2B43AF, 0x2B3FCE4D, 0x2B4C243F,
+  0x2B5AF32B, 0x2B6B6B3B, 0x2B7F321B, 0x2B922A25, 0x2BA5268F, 0x2BAD68FB,
+  0x2BB8FA5F, 0x2BCA57BD, 0x2BD518F3, 0x2BF8B52D, 0x2C14151B, 0x2C2DD22D,
+  0x2C401BFD, 0x2C4F14DD, 0x2C5ABBDD, 0x2C64B999, 0x2C87BB89, 0x2CA19B07,
+  0x2CC15C4B, 0x2CCEBE53, 0x2CDC22DB, 0x2CEC0C79, 0x2D02AE3F, 0x2D11C76B,
+  0x2D2AF83F, 0x2D350D8F, 0x2D4AE963, 0x2D650165, 0x2D7BC20F, 0x2D91AFFB,
+  0x2DABDC01, 0x2DB6D83B, 0x2DCA4999, 0x2DDC0FA3, 0x2DE2D57B, 0x2DEC2645,
+  0x2DF72A1B, 0x2E03E12D, 0x2E0D3587, 0x2E15B17B, 0x2E219387, 0x2E300325,
+  0x2E498259, 0x2E630A21, 0x2E74ECC3, 0x2E8961A3, 0x2E90343B, 0x2E9C2607,
+  0x2EB258B3, 0x2EC36F93, 0x2ED3AF05, 0x2EE913DB, 0x2EFB1015, 0x2F09A1F7,
+  0x2F13EC27, 0x2F1F1315, 0x2F416BE5, 0x2F56E9E3, 0x2F6B902B, 0x2F7B0FE7,
+  0x2FA99E63, 0x2FB085FB, 0x2FBE56AB, 0x2FC8B48B, 0x2FE7D503, 0x300A769B,
+  0x3018545B, 0x302477BF, 0x30325987, 0x3042D7B1, 0x305CE859, 0x306F2B73,
+  0x308171BD, 0x30903FF7, 0x3098F64B, 0x30A8A70F, 0x30B3FD6D, 0x30C11437,
+  0x30CC6D75, 0x30D608F7, 0x30E164A5, 0x30EF6159, 0x30F74063, 0x31053FD3,
+  0x31188307, 0x312767C5, 0x313B9197, 0x31499B87, 0x315EAD3F, 0x31703FCF,
+  0x317D6FDD, 0x31936E37, 0x31A7AE71, 0x31B240E9, 0x31CCB401, 0x31DD7807,
+  0x31EC7A69, 0x32061A93, 0x322C2629, 0x32341E83, 0x323B349B, 0x3256AF15,
+  0x326F86B1, 0x3290651B, 0x329781BB, 0x32A5BC7B, 0x32B788BB, 0x32C4E3DD,
+  0x32D5D187, 0x32DF9F9D, 0x32F33ED5, 0x3307C63F, 0x33245D77, 0x3331C709,
+  0x33465B3B, 0x3351FEB1, 0x336CDF25, 0x337A528F, 0x3385163F, 0x339457ED,
+  0x33A2B621, 0x33B03027, 0x33CB298B, 0x33EB90BB, 0x33FD967B, 0x341C3FFF,
+  0x34245F41, 0x3432D14D, 0x344B363F, 0x345A9589, 0x3474D37B, 0x347EC945,
+  0x34A5C237, 0x34BE4205, 0x34CA0FFF, 0x34EAC6DF, 0x350611D3, 0x3516755F,
+  0x3529978D, 0x35339E87, 0x354897B5, 0x355F6B07, 0x3579E9DD, 0x3598187B,
+  0x35AFE60F, 0x35C7B893, 0x35E07BBD, 0x35F76E63, 0x36009D87, 0x360AB8BD,
+  0x36188213, 0x36238B23, 0x363C6329, 0x364DE237, 0x365CA037, 0x366C4C2D,
+  0x3687F9CD, 0x3697AC27, 0x36A84CEB, 0x36C2309B, 0x36CC5DDD, 0x36E1A837,
+  0x3701286B, 0x3712C765, 0x37307AC5, 0x374B6BD3, 0x375FE087, 0x376DD5BD,
+  0x377E9751, 0x3792270B, 0x37A5BA55, 0x37B1D9EF, 0x37DAEC27, 0x37F518F7,
+  0x3803205D, 0x3814E83B, 0x3826B2C9, 0x3831F0DD, 0x383FFFCF, 0x38658637,
+  0x38757CA1, 0x3890BCDB, 0x38A0B94D, 0x38B0B83F, 0x38BC040F, 0x38C750E7,
+  0x38D29EF7, 0x38EB2113, 0x390952DB, 0x3913B5B1, 0x392F1BFB, 0x3945CD03,
+  0x39604D93, 0x39724C75, 0x3986339B, 0x39937A3F, 0x39AC2523, 0x39C3E399,
+  0x39D4FEE5, 0x39DBA687, 0x39F186F5, 0x39F8303B, 0x3A0B39FB, 0x3A1F3C09,
+  0x3A2D884B, 0x3A361D65, 0x3A418FB1, 0x3A4C0EDB, 0x3A714D7D, 0x3A7BD107,
+  0x3A86556D, 0x3AA5E7C7, 0x3ABA0445, 0x3ABFC3C5, 0x3B0A96D1, 0x3B161DF9,
+  0x3B30123F, 0x3B3B9CDF, 0x3B4CEF63, 0x3B5B6035, 0x3B6F9B8B, 0x3B88AC87,
+  0x3BA69629, 0x3BB7F849, 0x3BC3905D, 0x3BDEA205, 0x3BFAB1E3, 0x3C0080FF,
+  0x3C11EFEB, 0x3C2932A3, 0x3C426A87, 0x3C655D5F, 0x3C7ABF2B, 0x3C92160B,
+  0x3CA68599, 0x3CE1F637, 0x3CF28C01, 0x3D0611E5, 0x3D1A94F3, 0x3D3015C7,
+  0x3D41B123, 0x3D4984FB, 0x3D5738F7, 0x3D64EE6B, 0x3D7C7263, 0x3D93FAC3,
+  0x3DAB8773, 0x3DBF2B1B, 0x3DC9F975, 0x3DE387DD, 0x3DF8305F, 0x3E06F405,
+  0x3E2D5EE3, 0x3E3541BB, 0x3E450903, 0x3E50DF93, 0x3E669707, 0x3E70773B,
+  0x3E785E5B, 0x3E892ACD, 0x3E9DEF0F, 0x3EABC8DB, 0x3EBB9F23, 0x3EDA53CD,
+  0x3EEF253B, 0x3EFA0E2D, 0x3F14D98F, 0x3F25BAC9, 0x3F369F5B, 0x3F408FF7,
+  0x3F5374A9, 0x3F626183, 0x3F734D85, 0x3F8A365B, 0x3FB217BB, 0x3FC60D1B,
+  0x3FCE09C3, 0x3FF7FFC7, 0x400D00A5, 0x40190261, 0x40220483, 0x40400FFF,
+  0x404914CD, 0x406E2EF3, 0x408E4EC3, 0x409D6009, 0x40AC738F, 0x40C39465,
+  0x40D1AA7D, 0x40DEC07B, 0x40EEDD13, 0x410303FB, 0x41142745, 0x41275153,
+  0x4137774B, 0x414CABB9, 0x415DD907, 0x41803A03, 0x419476F3, 0x41A4AA6B,
+  0x41B3DC5D, 0x41C4135D, 0x41F6CB19, 0x42133CBD, 0x42268C7B, 0x4236D1C3,
+  0x4246147D, 0x424C2FAD, 0x425D7DEF, 0x427B0955, 0x42894F05, 0x42A8EDA3,
+  0x42C069A1, 0x42D2CCE9, 0x42E2218B, 0x42FDBE69, 0x430D17DF, 0x4327B77B,
+  0x43350935, 0x433E428F, 0x434A8FFF, 0x4359F25D, 0x43601A35, 0x436C6AB1,
+  0x4377B587, 0x43A7FF49, 0x43C2BDE9, 0x43DE88E7, 0x43E8D59B, 0x43F7423F,
+  0x4405B013, 0x441B5855, 0x442BDA99, 0x44418887, 0x44563207, 0x446ADDEF,
+  0x44819EF3, 0x449B7F21, 0x44A7EC65, 0x44C1D387, 0x44EF75C7, 0x450860FF,
+  0x4518FFAF, 0x4546BBCF, 0x456C38FF, 0x457CE3F7, 0x458B7B43, 0x459F4ADD,
+  0x45C3D10F, 0x45D058CF, 0x45F1C8F7, 0x45FA2637, 0x4608CA8B, 0x461EC415,
+  0x46282FF7, 0x4637E559, 0x464DE60F, 0x4662DE07, 0x466E678D, 0x46953D3F,
+  0x46AC59EB, 0x46CAD69D, 0x46D990C5, 0x46EA6765, 0x46F8174B, 0x47029F87,
+  0x471BE987, 0x47375303, 0x4750A783, 0x47607DE5, 0x477272B3, 0x47900BA3,
+  0x47A5333B, 0x47B2F509, 0x47C2D64B, 0x47DF7049, 0x47F284C1, 0x48026D23,
+  0x4811473F, 0x483CCFE5, 0x485BA2A3, 0x486203FF, 0x487DAD1B, 0x488EB533,
+  0x48AA6707, 0x48C83FE7, 0x48DB7343, 0x4906256B, 0x492DB1B1, 0x493FE0F7,
+  0x495435E5, 0x495FFCBB, 0x497231B1, 0x497DFADB, 0x49947D5D, 0x49A5A65D,
+  0x49B4ABA5, 0x49E61115, 0x4A042A61, 0x4A1CE8EB, 0x4A3048FF, 0x4A46E675,
+  0x4A5B6037, 0x4A6963F5, 0x4A845B6B, 0x4AA3A975, 0x4AB60687, 0x4AC865C5,
+  0x4ADF1AAB, 0x4AED2ADD, 0x4B1CCDF9, 0x4B2E2475, 0x4B3D51CD, 0x4B43D35D,
+  0x4B5A9A67, 0x4B76D3B3, 0x4B84F275, 0x4B953E73, 0x4BDADB9B, 0x4C17DF43,
+  0x4C2DAF9B, 0x4C3E0DD5, 0x4C632E8D, 0x4C6AD47B, 0x4C89701B, 0x4C9577F5,
+  0x4CAC729B, 0x4CC488AF, 0x4CD7285D, 0x4CF05E27, 0x4D102D55, 0x4D21BD09,
+  0x4D323577, 0x4D42AFB9, 0x4D4C938F, 0x4D5D1035, 0x4D85C3F7, 0x4D952D2B,
+  0x4DAF9C0B, 0x4DC371C7, 0x4DDDE8CF, 0x4DFF031B, 0x4E1BB9EF, 0x4E3524DD,
+  0x4E4E93CB, 0x4E64B4DB, 0x4E79BD49, 0x4E8DAD51, 0x4E9C1507, 0x4EB8E863,
+  0x4ED03415, 0x4EE9BC7B, 0x4F27F753, 0x4F3E372B, 0x4F483B4D, 0x4F58EDF3,
+  0x4F73A8DB, 0x4F87B8FF, 0x4F9BCAEB, 0x4FAC869D, 0x4FBE619D, 0x4FD03EBD,
+  0x4FEC2BEB, 0x5004C3F7, 0x501D5F13, 0x50318437, 0x504130DB, 0x50543B6D,
+  0x506985D3, 0x50858E45, 0x5099C035, 0x50A618F7, 0x50AF143F, 0x50C8E93D,
+  0x50E5020F, 0x50FFFFCF, 0x5114412B, 0x5128850F, 0x513A8A87, 0x5145CEFB,
+  0x515234AD, 0x516C2357, 0x518BBBBF, 0x51A250E7, 0x51AFDF0F, 0x51CAFE77,
+  0x51DBF485, 0x52014AF7, 0x5220FFF7, 0x5241DCE5, 0x52607C27, 0x5274E94B,
+  0x5285F0B1, 0x52A1337D, 0x52C34D7D, 0x52E44AAF, 0x52F9EC7D, 0x530E6C61,
+  0x532412BF, 0x533408C3, 0x5341B7EB, 0x5362CEB5, 0x5383EBEF, 0x539E3421,
+  0x53C1A73B, 0x53CE3D21, 0x53DBF915, 0x53EC0045, 0x5401C38B, 0x5410A905,
+  0x5420B57D, 0x5428BC37, 0x5438CAE3, 0x54532F45, 0x546FE40B, 0x54811FA9,
+  0x549CB525, 0x54B28FF7, 0x54DBFE2F, 0x55159BE3, 0x553022C5, 0x5543C0B3,
+  0x5564159B, 0x557691CB, 0x558B5FF7, 0x55A030AB, 0x55DC60FB, 0x55E91F25,
+  0x5604EFD5, 0x560BE4B5, 0x562EB08D, 0x564BB67B, 0x5669E9DF, 0x56986B07,
+  0x56C1262D, 0x56D99AF7, 0x56E9EADB, 0x56F911CD, 0x5717637D, 0x57268E83,
+  0x574868F5, 0x575C4487, 0x57702245, 0x57852D9D, 0x578FB43F, 0x57A014D3,
+  0x57C58A9B, 0x57F20F27, 0x581C48FF, 0x5825AC37, 0x58430411, 0x58941FB3,
+  0x58A49907, 0x58B89B69, 0x58D60DBB, 0x58E68CBF, 0x59040655, 0x5916E5D9,
+  0x59263D3B, 0x59403637, 0x594F90F5, 0x595A32EB, 0x596BED19, 0x597DA90F,
+  0x599D9911, 0x59B7A385, 0x59DB2C15, 0x59F08165, 0x5A0708F7, 0x5A1C6333,
+  0x5A3D9FD3, 0x5A4BE063, 0x5A64D35D, 0x5A7EFAD5, 0x5A96C491, 0x5AC19E65,
+  0x5ADAA203, 0x5AF3A811, 0x5B176FE9, 0x5B25C17D, 0x5B32E287, 0x5B4AC3F7,
+  0x5B663E4D, 0x5B75C7BF, 0x5B9148C9, 0x5BA6D1D9, 0x5BB8C60F, 0x5BC25A07,
+  0x5BCE53AB, 0x5C0B72F1, 0x5C210A65, 0x5C3570BF, 0x5C4C4091, 0x5C61DFCD,
+  0x5C6CB02B, 0x5C8ABD95, 0x5CAA03B5, 0x5CBFAE01, 0x5CE76AD7, 0x5D06C23B,
+  0x5D12D0F7, 0x5D37020B, 0x5D4F26BB, 0x5D70F83B, 0x5D919B95, 0x5DAEA205,
+  0x5DCBAE75, 0x5DE651E9, 0x5E02306B, 0x5E1595BB, 0x5E33E7D5, 0x5E4AF66B,
+  0x5E647599, 0x5E87B0F7, 0x5E93D88B, 0x5EA00107, 0x5EB37687, 0x5EC34771,
+  0x5ED1E225, 0x5EF668F5, 0x5F1AF811, 0x5F3F8DE1, 0x5F4CF9BB, 0x5F6B7DF5,
+  0x5F87957B, 0x5F9C5B19, 0x5FCC0C9B, 0x5FDE676D, 0x5FF6E385, 0x60094217,
+  0x601F506B, 0x6031B359, 0x6047C5FD, 0x606DCF33, 0x6082AE9D, 0x60A29E41,
+  0x60BC6E7B, 0x61077BC9, 0x611642ED, 0x614EF1F5, 0x616B518F, 0x6181875B,
+  0x61A7CF25, 0x61B7DEDB, 0x61C7EFC1, 0x61E1E677, 0x61F1FACD, 0x621857EF,
+  0x622FDF69, 0x6243B1B5, 0x6267A427, 0x6291CECB, 0x62B98C23, 0x62D9D8AF,
+  0x63006419, 0x630F5171, 0x6330EB73, 0x634C50F7, 0x6358C61B, 0x636F3487,
+  0x6377EE65, 0x63935D6D, 0x63A892F3, 0x63C7C759, 0x63E20237, 0x63F9BFF5,
+  0x641CC1AD, 0x64438B5B, 0x6458D371, 0x646F5EED, 0x6485EC55, 0x64AB8851,
+  0x64CD68DF, 0x64E40163, 0x64F45465, 0x651139A3, 0x651B477B, 0x652F64C3,
+  0x654241F1, 0x65515AA5, 0x655CADCB, 0x65785F87, 0x658B4375, 0x65BEEDEF,
+  0x65E4C5EB, 0x6601CCE1, 0x6619CB8F, 0x662F4565, 0x664C56AF, 0x6674D05F,
+  0x66947485, 0x66B41D9B, 0x66C0C8FF, 0x66DB6695, 0x66F8902F, 0x671FE715,
+  0x672DDE1B, 0x673806BB, 0x6744BA37, 0x675E2387, 0x676C1EC1, 0x67858CD5,
+  0x67A92B71, 0x67CF5E09, 0x67F1C3FF, 0x68039C3B, 0x682B2519, 0x68487E2F,
+  0x68649623, 0x687F69A1, 0x6897B27B, 0x68A47B87, 0x68BCC841, 0x68DCC637,
+  0x68EADB45, 0x68F66177, 0x690D7003, 0x692C31B3, 0x693B9483, 0x694ED0FD,
+  0x69792A2B, 0x6988926B, 0x699E67FD, 0x69D1D101, 0x69F5D505, 0x6A0BB60F,
+  0x6A1895BB, 0x6A295335, 0x6A41CD43, 0x6A4FFA0D, 0x6A7E64B9, 0x6A96E8E7,
+  0x6AAA4571, 0x6AC94381, 0x6ADDEF4D, 0x6AFBA9D3, 0x6B143BFD, 0x6B27A3F7,
+  0x6B31FE3F, 0x6B54F285, 0x6B647D51, 0x6B740955, 0x6B7BCFBD, 0x6B8F40CF,
+  0x6BA2B3F1, 0x6BC46DE1, 0x6BFAF565, 0x6C093FBB, 0x6C2B09C7, 0x6C61AB43,
+  0x6C767E33, 0x6C932437, 0x6CA41389, 0x6CAFCDC3, 0x6CBF718B, 0x6CD6E977,
+  0x6CEA7A09, 0x6D087D3B, 0x6D22999B, 0x6D3B6A21, 0x6D5C162B, 0x6D6D151D,
+  0x6D7F6465, 0x6DB26D8F, 0x6DD47A3B, 0x6DE6D207, 0x6DFD1A19, 0x6E1214A5,
+  0x6E30405F, 0x6E4A8037, 0x6E6DF4A5, 0x6E80593D, 0x6E9E9397, 0x6EC60873,
+  0x6EF025D3, 0x6F1263AF, 0x6F35F875, 0x6F505721, 0x6F7D3251, 0x6FA22A85,
+  0x6FC3312B, 0x6FDAFC3F, 0x7011333D, 0x70423223, 0x704E1DD1, 0x7071E4B3,
+  0x708C68FB, 0x70B43507, 0x70D4103F, 0x710139E3, 0x712D17CD, 0x713A645D,
+  0x7151022B, 0x715CFC55, 0x7176473B, 0x7190EA03, 0x71A4E611, 0x71D4E395,
+  0x71ECE6AD, 0x721E4987, 0x723D0205, 0x7245064D, 0x724D0ADD, 0x727D2985,
+  0x72C16C2B, 0x72E1918B, 0x7311D26B, 0x7329F677, 0x733760FB, 0x734A2A5F,
+  0x735CF59B, 0x737E88A5, 0x738AA00F, 0x73A428BD, 0x73BC5C1D, 0x73DB4C3F,
+  0x73F3854B, 0x7407B6ED, 0x7413D583, 0x7442FCF5, 0x745C9A27, 0x7474E0E3,
+  0x74851133, 0x74B9B6B9, 0x74C9EC0D, 0x74D2071D, 0x74DE303F, 0x7516F53B,
+  0x754FCE5F, 0x75682E83, 0x7584A0E5, 0x75C5B5C5, 0x75F690A1, 0x7606DBE5,
+  0x7619DF9D, 0x7633B08F, 0x763E9007, 0x7654505F, 0x767909E1, 0x76AA09F5,
+  0x76B64B77, 0x76CC1707, 0x76D9B73B, 0x7703F9A5, 0x77186F0F, 0x7733B8AF,
+  0x775894D5, 0x777ABB0F, 0x7789C2FD, 0x77A519E5, 0x77C8A8E5, 0x77E14A91,
+  0x7804E2AD, 0x781C2B9B, 0x783BAFD1, 0x78571AF5, 0x7876A707, 0x7885BEE1,
+  0x789E73AD, 0x78C0C83B, 0x79015FF1, 0x79210237, 0x79580FFF, 0x796474CD,
+  0x7970DA43, 0x799CF273, 0x79B301EB, 0x79DB017D, 0x7A0F7775, 0x7A29B5EF,
+  0x7A43F7B5, 0x7A60FFE7, 0x7A719877, 0x7A8658D5, 0x7A9855EF, 0x7AC3418D,
+  0x7AE5E3E7, 0x7B04625B, 0x7B2DFBD7, 0x7B5D2D5B, 0x7B778F6D, 0x7B98E7B1,
+  0x7BB1ECA5, 0x7BD1E813, 0x7BE82A8B, 0x7C0F2313, 0x7C3621F3, 0x7C52009B,
+  0x7C65845F, 0x7C7E9E0B, 0x7CB938CF, 0x7CCF8FF7, 0x7CE1B805, 0x7D220215,
+  0x7D2A65FD, 0x7D3B2E99, 0x7D58906B, 0x7D748F13, 0x7DAC9413, 0x7DDAD8FD,
+  0x7DEE7B85, 0x7E0923E7, 0x7E414C37, 0x7E65D383, 0x7E7DB885, 0x7EA0E08F,
+  0x7EAD89B5, 0x7EE034A1, 0x7EF2831B, 0x7F1723E7, 0x7F23D30D, 0x7F45A89D,
+  0x7F678361, 0x7F96170B, 0x7FA43607, 0x7FCBC3F7, 0x7FDF8CF3, 0x8002E60D,
+  0x80236EA3, 0x805AA475, 0x808C3A3F, 0x8098FBDD, 0x80AE3FCF, 0x80C93245,
+  0x80E592E1, 0x80F971D5, 0x812DFD8B, 0x8144B9DB, 0x81612803, 0x817D98F3,
+  0x81A29787, 0x81B0D35B, 0x81D46C21, 0x81E6F107, 0x81F976ED, 0x82216115,
+  0x82439C45, 0x82579615, 0x827CB255, 0x82A0687B, 0x82AEB227, 0x82C86BAB,
+  0x82E7E0F7, 0x83030EA5, 0x8329B2B3, 0x835BD231, 0x83A37E65, 0x83D44569,
+  0x83F829BB, 0x841372FD, 0x843D1FB3, 0x8458711D, 0x8469B339, 0x847AF68D,
+  0x84895A05, 0x84C74233, 0x84F3ECC9, 0x85209EBF, 0x8541CD19, 0x85531E7D,
+  0x8562FF5B, 0x8582C387, 0x85A5703F, 0x85C2583F, 0x85D97B0F, 0x85FC3277,
+  0x860F025D, 0x86333353, 0x8672F21B, 0x868170F7, 0x86944A39, 0x86A724DB,
+  0x86C8831D, 0x86E8726D, 0x87057DA9, 0x8723FFCF, 0x873E292B, 0x875CB1ED,
+  0x877282EB, 0x879E2B8F, 0x87AFA3FF, 0x87C57BBD, 0x87DB5603, 0x880FCE83,
+  0x882723BB, 0x883B8FFF, 0x8858BF3F, 0x8878DDB3, 0x889D61E5, 0x88CC26B9,
+  0x88E678B9, 0x8900CDA1, 0x89154A15, 0x892CB5C9, 0x8952C7BD, 0x897A589B,
+  0x89ADA8F9, 0x89D0DF15, 0x89FB70AB, 0x8A0D0FEB, 0x8A3F03F7, 0x8A60D3C1,
+  0x8A727985, 0x8AA5F853, 0x8AC7D4E5, 0x8AE9B577, 0x8B14723D, 0x8B31EF09,
+  0x8B526335, 0x8B7EAA0D, 0x8BA3952B, 0x8BB0E0D5, 0x8BE02B75, 0x8C052377,
+  0x8C16E3FF, 0x8C24350D, 0x8C43495B, 0x8C60E73B, 0x8C6FB70F, 0x8C97B8C1,
+  0x8CBB4D5D, 0x8CDEE661, 0x8CFC9389, 0x8D1A44BD, 0x8D37F8C5, 0x8D6489DD,
+  0x8D9B9053, 0x8DB4DB4D, 0x8DC9B0F5, 0x8DDA10F7, 0x8DF7D8F7, 0x8E0E3125,
+  0x8E2607F9, 0x8E4851A3, 0x8E5A36A3, 0x8E72145B, 0x8EAF4431, 0x8EE50B25,
+  0x8F0D6683, 0x8F25533B, 0x8F41BEDD, 0x8F50B575, 0x8F672873, 0x8F8C9705,
+  0x8FBB083B, 0x8FCE843D, 0x8FE08179, 0x90108055, 0x902101DB, 0x90420787,
+  0x904E0A87, 0x9061905D, 0x909DAB01, 0x90BD3E03, 0x90E157CB, 0x910E7E8F,
+  0x912B1A21, 0x9144B63F, 0x9168E0FF, 0x91840403, 0x91979EBD, 0x91B44833,
+  0x91D0F4F5, 0x91EC21AD, 0x921C76E1, 0x92392E23, 0x924B520B, 0x925D772B,
+  0x92A30FF7, 0x92C1575F, 0x92D99307, 0x930583FD, 0x9314AC55, 0x9340A60F,
+  0x936CA675, 0x937D58F7, 0x93A4D33B, 0x93C02C0F, 0x93D87C87, 0x93EC3F4D,
+  0x940AA8C5, 0x9430B0D3, 0x94522CDF, 0x9488FFFF, 0x949B4877, 0x94A8FFB5,
+  0x94DB4E43, 0x94FCDE87, 0x95248CA3, 0x9540080F, 0x95525C0F, 0x95727161,
+  0x958C6CDB, 0x95A4E30B, 0x95BBD3CD, 0x95C99843, 0x95E8329B, 0x9603BFEF,
+  0x964A3573, 0x966132F5, 0x9693CCE3, 0x96AF6A0F, 0x96CFA4A5, 0x96F47EA9,
+  0x9706ED31, 0x972BCDAD, 0x97490287, 0x976639B1, 0x97868887, 0x97B4B4F3,
+  0x97E15D5D, 0x980E0E77, 0x983499B5, 0x9848A6BB, 0x98678143, 0x988B0245,
+  0x9895D107, 0x98D525C5, 0x98FA3E75, 0x992ED3A1, 0x9968173F, 0x9993740F,
+  0x99AAB18D, 0x99D93079, 0x9A094587, 0x9A23A649, 0x9A3E095B, 0x9A60328F,
+  0x9A857ADF, 0x9AAAC797, 0x9ACE8B45, 0x9AE8FCBF, 0x9B0370E9, 0x9B41B7A5,
+  0x9B5AA445, 0x9B6EE60B, 0x9BC31887, 0x9BDA807D, 0x9BF8283B, 0x9C2250D9,
+  0x9C3CE003, 0x9C4FA033, 0x9C75246B, 0x9C8C9921, 0x9CB2246D, 0x9CD7B45D,
+  0x9D13370D, 0x9D22E21D, 0x9D328DB5, 0x9D7143F9, 0x9D923637, 0x9D9EC3F7,
+  0x9DAE75DB, 0x9DBE2877, 0x9DE24655, 0x9DF6B23F, 0x9E0E43B1, 0x9E2C211B,
+  0x9E454913, 0x9E6FC1B5, 0x9E926115, 0x9EAD2487, 0x9EC3309B, 0x9EE8FFBB,
+  0x9F06F175, 0x9F2B3507, 0x9F3C8E61, 0x9F6A5007, 0x9F884D4D, 0x9FBC6C3F,
+  0x9FE258E7, 0x9FFECD53, 0xA01B448F, 0xA037BDF3, 0xA0543A27, 0xA070B86B,
+  0xA091FA71, 0xA0AE7E61, 0xA0D48801, 0xA0FF580F, 0xA11260CF, 0xA143927D,
+  0xA169AD21, 0xA18E366B, 0xA1A2DE95, 0xA1DDB0AF, 0xA205752D, 0xA226E0EB,
+  0xA2484FE5, 0xA253759B, 0xA27CE017, 0xA2AE4945, 0xA2C303F7, 0xA2E61AEB,
+  0xA302D427, 0xA32459B9, 0xA36C3A63, 0xA37F67CB, 0xA3976255, 0xA3EDC2F5,
+  0xA41DC931, 0xA452A68B, 0xA46DE515, 0xA48C5B03, 0xA4A46919, 0xA4B7A8ED,
+  0xA4CAE9D5, 0xA5064E13, 0xA5219BC9, 0xA559D8FB, 0xA5806EDB, 0xA59A2AA3,
+  0xA5B0B087, 0xA5CA6FDF, 0xA5EF76B5, 0xA6230109, 0xA6433C5D, 0xA6787087,
+  0xA69BEDD3, 0xA6B5BFDB, 0xA6CF93A3, 0xA6F98FAF, 0xA723919B, 0xA73558D5,
+  0xA748BED1, 0xA76F8E4D, 0xA7A1B55F, 0xA7CF09BF, 0xA7F2AB8B, 0xA8014045,
+  0xA81B2D85, 0xA8351CE5, 0xA85DA70F, 0xA87ADA2B, 0xA8933149, 0xA8B0695D,
+  0xA8E600FF, 0xA9081F55, 0xA92A428B, 0xA9444693, 0xA96E91DF, 0xA995A067,
+  0xA9C337EF, 0xA9E8AF7D, 0xAA06053D, 0xAA24FE3F, 0xAA43FA8D, 0xAA8BC619,
+  0xAAB63A45, 0xAAEC2443, 0xAB1D2E17, 0xAB35B655, 0xAB4E3FE3, 0xAB5E9C87,
+  0xAB709CFD, 0xAB892A93, 0xABAED3C9, 0xABDB0FF7, 0xABFF1EE3, 0xAC2B641D,
+  0xAC5C9CDD, 0xAC704EC9, 0xAC9FEC37, 0xACC758AF, 0xACE69245, 0xAD0FAC07,
+  0xAD201E1B, 0xAD37253F, 0xAD531E55, 0xAD74098D, 0xADA22475, 0xADC9AF59,
+  0xADE2680F, 0xAE1584B5, 0xAE43B541, 0xAE6CF8E7, 0xAEA029FD, 0xAEBDE6DD,
+  0xAEDEF4B5, 0xAF035415, 0xAF511483, 0xAF91A7F1, 0xAFADD13B, 0xAFD73F29,
+  0xAFEB23C1, 0xB017EA13, 0xB030CCBD, 0xB051FCE9, 0xB06E361B, 0xB07ED0F7,
+  0xB0946809, 0xB0B0A63B, 0xB0EAD211, 0xB1071783, 0xB11B0D13, 0xB13C53B3,
+  0xB153A0F7, 0xB16FEE3D, 0xB18DE825, 0xB1A38FAF, 0xB1D23907, 0xB1E2E4A3,
+  0xB20FEA9D, 0xB22F9D87, 0xB26A08CD, 0xB27FBE07, 0xB2BA3631, 0xB2D6A037,
+  0xB2F30C2D, 0xB3329C9D, 0xB363263F, 0xB382F73D, 0xB3BA3FE7, 0xB3D86ACB,
+  0xB400A8CB, 0xB4258FF7, 0xB44068AF, 0xB467044D, 0xB4A1CC63, 0xB4B0EB65,
+  0xB4CD7D07, 0xB4FFECFB, 0xB51AD62B, 0xB5525D69, 0xB5868E63, 0xB5AEFCDB,
+  0xB5BC77C3, 0xB5DACDDF, 0xB5F926CB, 0xB64A1FAB, 0xB67CC50F, 0xB686E6E3,
+  0xB6961A19, 0xB6C8C991, 0xB6F81E45, 0xB73350FF, 0xB75A3CCD, 0xB78EB8F3,
+  0xB7BAC3AF, 0xB7E37037, 0xB82743E7, 0xB84C975B, 0xB8645A0F, 0xB878B8FF,
+  0xB897490B, 0xB8B0C3DD, 0xB8C526F9, 0xB8E20ABB, 0xB9040A7B, 0xB91A257D,
+  0xB96BCFB1, 0xB98F9087, 0xB9A767FB, 0xB9B50863, 0xB9C2A93B, 0xB9DA83F7,
+  0xB9FC9A17, 0xBA34E029, 0xBA443A83, 0xBA69C487, 0xBA776C0F, 0xBAA3CF93,
+  0xBADDE427, 0xBAF5D11B, 0xBB2FF23F, 0xBB5E2145, 0xBB857E9B, 0xBB969D0F,
+  0xBBB56F4B, 0xBBDB1E3F, 0xBC0CD10D, 0xBC2D63BF, 0xBC4FB0FF, 0xBC832A43,
+  0xBCA20FCF, 0xBCB6AA8F, 0xBCF638BD, 0xBD3CB1FB, 0xBD6B22E9, 0xBD84F1F7,
+  0xBDA916B1, 0xBDD422BB, 0xBDEC3FE7, 0xBE1227DB, 0xBE1FF183, 0xBE3D3F7D,
+  0xBE50371B, 0xBE6D88E9, 0xBE7D0F8F, 0xBEA678E7, 0xBEE8153B, 0xBEFB1525,
+  0xBF2801CD, 0xBF5BDE35, 0xBF75CEF7, 0xBF94F233, 0xBFB4183F, 0xBFDA2D7B,
+  0xC0020195, 0xC022EC37, 0xC043D8C9, 0xC05F95B5, 0xC0762037, 0xC0A33913,
+  0xC0DAC173, 0xC0F1537D, 0xC10B5FC3, 0xC12037A3, 0xC136CD4D, 0xC157D21B,
+  0xC178D945, 0xC19826BD, 0xC1C71DBB, 0xC1F45F87, 0xC21AADB3, 0xC23849F5,
+  0xC25964AB, 0xC2817B35, 0xC29D60F5, 0xC2B789DF, 0xC2DA6E37, 0xC2F65A3F,
+  0xC31943BF, 0xC33C30AF, 0xC3645EE1, 0xC37E9563, 0xC398CD95, 0xC3CD4285,
+  0xC3F73FD9, 0xC4188073, 0xC43B846B, 0xC455C951, 0xC485165F, 0xC4CEB64B,
+  0xC4FFD33B, 0xC52BB1A9, 0xC55CD9ED, 0xC5837EA5, 0xC5AF6C5B, 0xC5E26625,
+  0xC61021D9, 0xC62A85DF, 0xC654C377, 0xC676374D, 0xC68D1C87, 0xC6A402FD,
+  0xC6BE70CF, 0xC6F89C51, 0xC70DC585, 0xC71DA50B, 0xC742B0F5, 0xC76D0C99,
+  0xC783FFF7, 0xC7C00C33, 0xC7E19EB9, 0xC80C0AC5, 0xC83BC997, 0xC8663FCF,
+  0xC8A5F8DF, 0xC8C413D5, 0xC8E06B89, 0xC8F3E8F7, 0xC91AE5FB, 0xC9457403,
+  0xC9771E53, 0xC98FF63F, 0xC9AFE923, 0xC9D5325D, 0xC9EA8249, 0xC9FE0C9B,
+  0xCA1A7A63, 0xCA2C3FF7, 0xCA85265B, 0xCAB53219, 0xCAEFF09B, 0xCB0FFFFF,
+  0xCB2E48FD, 0xCB45736B, 0xCB61F83B, 0xCB83D85D, 0xCB9B07AB, 0xCBBCEC31,
+  0xCBF43F1F, 0xCC42D387, 0xCC62FCB3, 0xCC8328F7, 0xCCB1A5E3, 0xCCD56BB3,
+  0xCD17A2C5, 0xCD429B89, 0xCD59E437, 0xCD831901, 0xCDA35BD1, 0xCDCC9837,
+  0xCDEEAB99, 0xCE26496B, 0xCEBB5C99, 0xCECF2237, 0xCEDBB7BD, 0xCEFC1521,
+  0xCF27406D, 0xCF4B3DA5, 0xCF710ABB, 0xCF8DDA03, 0xCFA376C3, 0xCFC3E387,
+  0xCFE453AB, 0xCFFF5D71, 0xD01A68E7, 0xD042169B, 0xD055EEDD, 0xD0813E41,
+  0xD0A1BCC9, 0xD0D27F33, 0xD0F3043F, 0xD108B38F, 0xD1259F07, 0xD1445B15,
+  0xD16FC399, 0xD1DC5BC1, 0xD1FB259B, 0xD20D42F7, 0xD22DE04B, 0xD2474007,
+  0xD2644177, 0xD284E52B, 0xD2A01AF5, 0xD2BB51DF, 0xD2D118FF, 0xD3095FFD,
+  0xD333257B, 0xD36F1CED, 0xD38A6133, 0xD3D3207B, 0xD3E55237, 0xD4026FC7,
+  0xD428AAA5, 0xD4390DE3, 0xD46868F7, 0xD48B0749, 0xD4B14E0F, 0xD4CAD49B,
+  0xD4F86CF1, 0xD51B173B, 0xD54C5E59, 0xD5A7B001, 0xD5E3FEDF, 0xD625D497,
+  0xD651BDDF, 0xD6815493, 0xD6AF1C1D, 0xD6D014F1, 0xD6FFB895, 0xD731395B,
+  0xD7438FE7, 0xD75411CD, 0xD781EF7B, 0xD79BA0E7, 0xD7C05807, 0xD7EE3FB9,
+  0xD8273607, 0xD865B67B, 0xD879F0ED, 0xD8A9C505, 0xD8E680DF, 0xD903F687,
+  0xD92E5295, 0xD9601273, 0xD9975FDF, 0xD9C7537B, 0xD9FCD455, 0xDA30856D,
+  0xDA574D87, 0xDAA1331F, 0xDAEB2A07, 0xDAFDA91B, 0xDB15B5D9, 0xDB31776B,
+  0xDB47AD2B, 0xDB654BB3, 0xDB95720F, 0xDBC77819, 0xDBDDB57D, 0xDC0A338D,
+  0xDC1AE3E7, 0xDC3C4693, 0xDC73F0E7, 0xDCCD0FE7, 0xDCF9A63F, 0xDD0FF30F,
+  0xDD2BD4A5, 0xDD36FC2D, 0xDD5A5087, 0xDD79EF39, 0xDDD16687, 0xDDFFF3D5,
+  0xDE217B41, 0xDE53CA23, 0xDE96E8EB, 0xDEC58B3D, 0xDEE543FF, 0xDF2C326B,
+  0xDF715129, 0xDFA962C1, 0xDFE17B61, 0xE013FCE3, 0xE03D2A37, 0xE0575F73,
+  0xE07EB259, 0xE0A60887, 0xE0CD62C9, 0xE1168017, 0xE1384383, 0xE15467E5,
+  0xE1708DDF, 0xE18CB5E9, 0xE1C50B0D, 0xE1D9B487, 0xE1F7C397, 0xE237AB9B,
+  0xE251FE5F, 0xE26C52FB, 0xE284C751, 0xE2A1006B, 0xE2BD3B59, 0xE2DF1DC1,
+  0xE30E3237, 0xE333DF17, 0xE36A8641, 0xE3C32837, 0xE3F070F7, 0xE42184CB,
+  0xE4566443, 0xE49A69DB, 0xE4C9ABE5, 0xE4EBB595, 0xE50083F7, 0xE5191BC5,
+  0xE53946FB, 0xE5702C49, 0xE586E56D, 0xE5AEABF7, 0xE5ED33E5, 0xE61503C3,
+  0xE6261495, 0xE6483765, 0xE686D543, 0xE6A16807, 0xE6B83037, 0xE6FE7459,
+  0xE753FBA3, 0xE7651839, 0xE7875375, 0xE7B4FBA5, 0xE806D3EF, 0xE83C2787,
+  0xE88E17F1, 0xE8A4F875, 0xE8C19273, 0xE8DC4637, 0xE9195437, 0xE93F80DF,
+  0xE978CA0B, 0xE9938837, 0xE9BD916B, 0xE9D85387, 0xE9FE8FF7, 0xEA3606C5,
+  0xEA69AFC7, 0xEA998AFD, 0xEABFD749, 0xEAEFBAB3, 0xEB256353, 0xEB5CFCC1,
+  0xEB8EDC11, 0xEBB53BC9, 0xEBE90FAF, 0xEC07C8FF, 0xEC39B903, 0xEC63FFE7,
+  0xEC754C4D, 0xECA36EB1, 0xECE8ADD5, 0xED18CA7B, 0xED3B70AF, 0xED61F3F7,
+  0xED8A676D, 0xEDCDD92F, 0xEE0F6883, 0xEE456B43, 0xEE8AE6A3, 0xEEC0F8D3,
+  0xEEEB78FF, 0xEF02A8DF, 0xEF25732B, 0xEF4272F9, 0xEF5F7477, 0xEF824583,
+  0xEF9B6C15, 0xEFBC520F, 0xEFE4F89D, 0xF013720D, 0xF030800F, 0xF04F8037,
+  0xF085C507, 0xF09EF951, 0xF0DB18AF, 0xF101E70F, 0xF11930FF, 0xF12AA92D,
+  0xF145D70D, 0xF17663FF, 0xF1938791, 0xF1B48FAF, 0xF1CFC5BB, 0xF1E7199B,
+  0xF20827A9, 0xF2293807, 0xF25DBFED, 0xF284AD15, 0xF29FEEAD, 0xF2BD240F,
+  0xF2EBE3FF, 0xF3091E1D, 0xF33DBCFB, 0xF374579B, 0xF3ACEA25, 0xF40A9C45,
+  0xF437885B, 0xF456CA73, 0xF485B11B, 0xF4B49D33, 0xF4E776BF, 0xF52FDC8D,
+  0xF55319D5, 0xF58218E9, 0xF5B11C35, 0xF5E02539, 0xF61512E3, 0xF64A086D,
+  0xF6733C43, 0xF69C7379, 0xF6D75931, 0xF72009D3, 0xF75711A3, 0xF78C2965,
+  0xF7B966AF, 0xF7EC912B, 0xF8395829, 0xF8862DF7, 0xF89FCCAD, 0xF8C739B9,
+  0xF8DEE301, 0xF8F8865B, 0xF937A7E3, 0xF94D5D1D, 0xF984A349, 0xF9C1DC2F,
+  0xFA10E7BF, 0xFA308977, 0xFA63F43B, 0xFAAD28E5, 0xFADAAFDB, 0xFAF07755,
+  0xFB21FA73, 0xFB3DB707, 0xFB6558CF, 0xFBB2A9CD, 0xFBE24511, 0xFC0BF00F,
+  0xFC29B505, 0xFC595B29, 0xFC8EFB0B, 0xFCA6D22B, 0xFCC4A0BD, 0xFCE073FD,
+  0xFD0C30B5, 0xFD2A058F, 0xFD3BEC45, 0xFD71A427, 0xFDC143AF, 0xFDE9188F,
+  0xFE14EC5B, 0xFE48BCDF, 0xFE789567, 0xFEA8735F, 0xFED65695, 0xFF043DFB,
+  0xFF1A33A5, 0xFF44226B, 0xFF70135F, 0xFFC80297, 0x0000FFF1
+};
+
+static const unsigned int primesProductsIndices[][2] = {
+  {10, 15}, {15, 20}, {20, 25}, {25, 29}, {29, 33}, {33, 37},
+  {37, 41}, {41, 45}, {45, 49}, {49, 53}, {53, 56}, {56, 59},
+  {59, 62}, {62, 65}, {65, 68}, {68, 71}, {71, 74}, {74, 77},
+  {77, 80}, {80, 83}, {83, 86}, {86, 89}, {89, 92}, {92, 95},
+  {95, 98}, {98, 101}, {101, 104}, {104, 107}, {107, 110}, {110, 113},
+  {113, 116}, {116, 119}, {119, 122}, {122, 125}, {125, 128}, {128, 131},
+  {131, 134}, {134, 137}, {137, 140}, {140, 143}, {143, 146}, {146, 149},
+  {149, 152}, {152, 155}, {155, 158}, {158, 161}, {161, 164}, {164, 167},
+  {167, 170}, {170, 173}, {173, 176}, {176, 179}, {179, 182}, {182, 185},
+  {185, 188}, {188, 191}, {191, 194}, {194, 197}, {197, 200}, {200, 203},
+  {203, 206}, {206, 209}, {209, 212}, {212, 215}, {215, 218}, {218, 221},
+  {221, 224}, {224, 227}, {227, 230}, {230, 233}, {233, 236}, {236, 239},
+  {239, 242}, {242, 245}, {245, 248}, {248, 251}, {251, 254}, {254, 257},
+  {257, 259}, {259, 261}, {261, 263}, {263, 265}, {265, 267}, {267, 269},
+  {269, 271}, {271, 273}, {273, 275}, {275, 277}, {277, 279}, {279, 281},
+  {281, 283}, {283, 285}, {285, 287}, {287, 289}, {289, 291}, {291, 293},
+  {293, 295}, {295, 297}, {297, 299}, {299, 301}, {301, 303}, {303, 305},
+  {305, 307}, {307, 309}, {309, 311}, {311, 313}, {313, 315}, {315, 317},
+  {317, 319}, {319, 321}, {321, 323}, {323, 325}, {325, 327}, {327, 329},
+  {329, 331}, {331, 333}, {333, 335}, {335, 337}, {337, 339}, {339, 341},
+  {341, 343}, {343, 345}, {345, 347}, {347, 349}, {349, 351}, {351, 353},
+  {353, 355}, {355, 357}, {357, 359}, {359, 361}, {361, 363}, {363, 365},
+  {365, 367}, {367, 369}, {369, 371}, {371, 373}, {373, 375}, {375, 377},
+  {377, 379}, {379, 381}, {381, 383}, {383, 385}, {385, 387}, {387, 389},
+  {389, 391}, {391, 393}, {393, 395}, {395, 397}, {397, 399}, {399, 401},
+  {401, 403}, {403, 405}, {405, 407}, {407, 409}, {409, 411}, {411, 413},
+  {413, 415}, {415, 417}, {417, 419}, {419, 421}, {421, 423}, {423, 425},
+  {425, 427}, {427, 429}, {429, 431}, {431, 433}, {433, 435}, {435, 437},
+  {437, 439}, {439, 441}, {441, 443}, {443, 445}, {445, 447}, {447, 449},
+  {449, 451}, {451, 453}, {453, 455}, {455, 457}, {457, 459}, {459, 461},
+  {461, 463}, {463, 465}, {465, 467}, {467, 469}, {469, 471}, {471, 473},
+  {473, 475}, {475, 477}, {477, 479}, {479, 481}, {481, 483}, {483, 485},
+  {485, 487}, {487, 489}, {489, 491}, {491, 493}, {493, 495}, {495, 497},
+  {497, 499}, {499, 501}, {501, 503}, {503, 505}, {505, 507}, {507, 509},
+  {509, 511}, {511, 513}, {513, 515}, {515, 517}, {517, 519}, {519, 521},
+  {521, 523}, {523, 525}, {525, 527}, {527, 529}, {529, 531}, {531, 533},
+  {533, 535}, {535, 537}, {537, 539}, {539, 541}, {541, 543}, {543, 545},
+  {545, 547}, {547, 549}, {549, 551}, {551, 553}, {553, 555}, {555, 557},
+  {557, 559}, {559, 561}, {561, 563}, {563, 565}, {565, 567}, {567, 569},
+  {569, 571}, {571, 573}, {573, 575}, {575, 577}, {577, 579}, {579, 581},
+  {581, 583}, {583, 585}, {585, 587}, {587, 589}, {589, 591}, {591, 593},
+  {593, 595}, {595, 597}, {597, 599}, {599, 601}, {601, 603}, {603, 605},
+  {605, 607}, {607, 609}, {609, 611}, {611, 613}, {613, 615}, {615, 617},
+  {617, 619}, {619, 621}, {621, 623}, {623, 625}, {625, 627}, {627, 629},
+  {629, 631}, {631, 633}, {633, 635}, {635, 637}, {637, 639}, {639, 641},
+  {641, 643}, {643, 645}, {645, 647}, {647, 649}, {649, 651}, {651, 653},
+  {653, 655}, {655, 657}, {657, 659}, {659, 661}, {661, 663}, {663, 665},
+  {665, 667}, {667, 669}, {669, 671}, {671, 673}, {673, 675}, {675, 677},
+  {677, 679}, {679, 681}, {681, 683}, {683, 685}, {685, 687}, {687, 689},
+  {689, 691}, {691, 693}, {693, 695}, {695, 697}, {697, 699}, {699, 701},
+  {701, 703}, {703, 705}, {705, 707}, {707, 709}, {709, 711}, {711, 713},
+  {713, 715}, {715, 717}, {717, 719}, {719, 721}, {721, 723}, {723, 725},
+  {725, 727}, {727, 729}, {729, 731}, {731, 733}, {733, 735}, {735, 737},
+  {737, 739}, {739, 741}, {741, 743}, {743, 745}, {745, 747}, {747, 749},
+  {749, 751}, {751, 753}, {753, 755}, {755, 757}, {757, 759}, {759, 761},
+  {761, 763}, {763, 765}, {765, 767}, {767, 769}, {769, 771}, {771, 773},
+  {773, 775}, {775, 777}, {777, 779}, {779, 781}, {781, 783}, {783, 785},
+  {785, 787}, {787, 789}, {789, 791}, {791, 793}, {793, 795}, {795, 797},
+  {797, 799}, {799, 801}, {801, 803}, {803, 805}, {805, 807}, {807, 809},
+  {809, 811}, {811, 813}, {813, 815}, {815, 817}, {817, 819}, {819, 821},
+  {821, 823}, {823, 825}, {825, 827}, {827, 829}, {829, 831}, {831, 833},
+  {833, 835}, {835, 837}, {837, 839}, {839, 841}, {841, 843}, {843, 845},
+  {845, 847}, {847, 849}, {849, 851}, {851, 853}, {853, 855}, {855, 857},
+  {857, 859}, {859, 861}, {861, 863}, {863, 865}, {865, 867}, {867, 869},
+  {869, 871}, {871, 873}, {873, 875}, {875, 877}, {877, 879}, {879, 881},
+  {881, 883}, {883, 885}, {885, 887}, {887, 889}, {889, 891}, {891, 893},
+  {893, 895}, {895, 897}, {897, 899}, {899, 901}, {901, 903}, {903, 905},
+  {905, 907}, {907, 909}, {909, 911}, {911, 913}, {913, 915}, {915, 917},
+  {917, 919}, {919, 921}, {921, 923}, {923, 925}, {925, 927}, {927, 929},
+  {929, 931}, {931, 933}, {933, 935}, {935, 937}, {937, 939}, {939, 941},
+  {941, 943}, {943, 945}, {945, 947}, {947, 949}, {949, 951}, {951, 953},
+  {953, 955}, {955, 957}, {957, 959}, {959, 961}, {961, 963}, {963, 965},
+  {965, 967}, {967, 969}, {969, 971}, {971, 973}, {973, 975}, {975, 977},
+  {977, 979}, {979, 981}, {981, 983}, {983, 985}, {985, 987}, {987, 989},
+  {989, 991}, {991, 993}, {993, 995}, {995, 997}, {997, 999}, {999, 1001},
+  {1001, 1003}, {1003, 1005}, {1005, 1007}, {1007, 1009}, {1009, 1011}, {1011, 1013},
+  {1013, 1015}, {1015, 1017}, {1017, 1019}, {1019, 1021}, {1021, 1023}, {1023, 1025},
+  {1025, 1027}, {1027, 1029}, {1029, 1031}, {1031, 1033}, {1033, 1035}, {1035, 1037},
+  {1037, 1039}, {1039, 1041}, {1041, 1043}, {1043, 1045}, {1045, 1047}, {1047, 1049},
+  {1049, 1051}, {1051, 1053}, {1053, 1055}, {1055, 1057}, {1057, 1059}, {1059, 1061},
+  {1061, 1063}, {1063, 1065}, {1065, 1067}, {1067, 1069}, {1069, 1071}, {1071, 1073},
+  {1073, 1075}, {1075, 1077}, {1077, 1079}, {1079, 1081}, {1081, 1083}, {1083, 1085},
+  {1085, 1087}, {1087, 1089}, {1089, 1091}, {1091, 1093}, {1093, 1095}, {1095, 1097},
+  {1097, 1099}, {1099, 1101}, {1101, 1103}, {1103, 1105}, {1105, 1107}, {1107, 1109},
+  {1109, 1111}, {1111, 1113}, {1113, 1115}, {1115, 1117}, {1117, 1119}, {1119, 1121},
+  {1121, 1123}, {1123, 1125}, {1125, 1127}, {1127, 1129}, {1129, 1131}, {1131, 1133},
+  {1133, 1135}, {1135, 1137}, {1137, 1139}, {1139, 1141}, {1141, 1143}, {1143, 1145},
+  {1145, 1147}, {1147, 1149}, {1149, 1151}, {1151, 1153}, {1153, 1155}, {1155, 1157},
+  {1157, 1159}, {1159, 1161}, {1161, 1163}, {1163, 1165}, {1165, 1167}, {1167, 1169},
+  {1169, 1171}, {1171, 1173}, {1173, 1175}, {1175, 1177}, {1177, 1179}, {1179, 1181},
+  {1181, 1183}, {1183, 1185}, {1185, 1187}, {1187, 1189}, {1189, 1191}, {1191, 1193},
+  {1193, 1195}, {1195, 1197}, {1197, 1199}, {1199, 1201}, {1201, 1203}, {1203, 1205},
+  {1205, 1207}, {1207, 1209}, {1209, 1211}, {1211, 1213}, {1213, 1215}, {1215, 1217},
+  {1217, 1219}, {1219, 1221}, {1221, 1223}, {1223, 1225}, {1225, 1227}, {1227, 1229},
+  {1229, 1231}, {1231, 1233}, {1233, 1235}, {1235, 1237}, {1237, 1239}, {1239, 1241},
+  {1241, 1243}, {1243, 1245}, {1245, 1247}, {1247, 1249}, {1249, 1251}, {1251, 1253},
+  {1253, 1255}, {1255, 1257}, {1257, 1259}, {1259, 1261}, {1261, 1263}, {1263, 1265},
+  {1265, 1267}, {1267, 1269}, {1269, 1271}, {1271, 1273}, {1273, 1275}, {1275, 1277},
+  {1277, 1279}, {1279, 1281}, {1281, 1283}, {1283, 1285}, {1285, 1287}, {1287, 1289},
+  {1289, 1291}, {1291, 1293}, {1293, 1295}, {1295, 1297}, {1297, 1299}, {1299, 1301},
+  {1301, 1303}, {1303, 1305}, {1305, 1307}, {1307, 1309}, {1309, 1311}, {1311, 1313},
+  {1313, 1315}, {1315, 1317}, {1317, 1319}, {1319, 1321}, {1321, 1323}, {1323, 1325},
+  {1325, 1327}, {1327, 1329}, {1329, 1331}, {1331, 1333}, {1333, 1335}, {1335, 1337},
+  {1337, 1339}, {1339, 1341}, {1341, 1343}, {1343, 1345}, {1345, 1347}, {1347, 1349},
+  {1349, 1351}, {1351, 1353}, {1353, 1355}, {1355, 1357}, {1357, 1359}, {1359, 1361},
+  {1361, 1363}, {1363, 1365}, {1365, 1367}, {1367, 1369}, {1369, 1371}, {1371, 1373},
+  {1373, 1375}, {1375, 1377}, {1377, 1379}, {1379, 1381}, {1381, 1383}, {1383, 1385},
+  {1385, 1387}, {1387, 1389}, {1389, 1391}, {1391, 1393}, {1393, 1395}, {1395, 1397},
+  {1397, 1399}, {1399, 1401}, {1401, 1403}, {1403, 1405}, {1405, 1407}, {1407, 1409},
+  {1409, 1411}, {1411, 1413}, {1413, 1415}, {1415, 1417}, {1417, 1419}, {1419, 1421},
+  {1421, 1423}, {1423, 1425}, {1425, 1427}, {1427, 1429}, {1429, 1431}, {1431, 1433},
+  {1433, 1435}, {1435, 1437}, {1437, 1439}, {1439, 1441}, {1441, 1443}, {1443, 1445},
+  {1445, 1447}, {1447, 1449}, {1449, 1451}, {1451, 1453}, {1453, 1455}, {1455, 1457},
+  {1457, 1459}, {1459, 1461}, {1461, 1463}, {1463, 1465}, {1465, 1467}, {1467, 1469},
+  {1469, 1471}, {1471, 1473}, {1473, 1475}, {1475, 1477}, {1477, 1479}, {1479, 1481},
+  {1481, 1483}, {1483, 1485}, {1485, 1487}, {1487, 1489}, {1489, 1491}, {1491, 1493},
+  {1493, 1495}, {1495, 1497}, {1497, 1499}, {1499, 1501}, {1501, 1503}, {1503, 1505},
+  {1505, 1507}, {1507, 1509}, {1509, 1511}, {1511, 1513}, {1513, 1515}, {1515, 1517},
+  {1517, 1519}, {1519, 1521}, {1521, 1523}, {1523, 1525}, {1525, 1527}, {1527, 1529},
+  {1529, 1531}, {1531, 1533}, {1533, 1535}, {1535, 1537}, {1537, 1539}, {1539, 1541},
+  {1541, 1543}, {1543, 1545}, {1545, 1547}, {1547, 1549}, {1549, 1551}, {1551, 1553},
+  {1553, 1555}, {1555, 1557}, {1557, 1559}, {1559, 1561}, {1561, 1563}, {1563, 1565},
+  {1565, 1567}, {1567, 1569}, {1569, 1571}, {1571, 1573}, {1573, 1575}, {1575, 1577},
+  {1577, 1579}, {1579, 1581}, {1581, 1583}, {1583, 1585}, {1585, 1587}, {1587, 1589},
+  {1589, 1591}, {1591, 1593}, {1593, 1595}, {1595, 1597}, {1597, 1599}, {1599, 1601},
+  {1601, 1603}, {1603, 1605}, {1605, 1607}, {1607, 1609}, {1609, 1611}, {1611, 1613},
+  {1613, 1615}, {1615, 1617}, {1617, 1619}, {1619, 1621}, {1621, 1623}, {1623, 1625},
+  {1625, 1627}, {1627, 1629}, {1629, 1631}, {1631, 1633}, {1633, 1635}, {1635, 1637},
+  {1637, 1639}, {1639, 1641}, {1641, 1643}, {1643, 1645}, {1645, 1647}, {1647, 1649},
+  {1649, 1651}, {1651, 1653}, {1653, 1655}, {1655, 1657}, {1657, 1659}, {1659, 1661},
+  {1661, 1663}, {1663, 1665}, {1665, 1667}, {1667, 1669}, {1669, 1671}, {1671, 1673},
+  {1673, 1675}, {1675, 1677}, {1677, 1679}, {1679, 1681}, {1681, 1683}, {1683, 1685},
+  {1685, 1687}, {1687, 1689}, {1689, 1691}, {1691, 1693}, {1693, 1695}, {1695, 1697},
+  {1697, 1699}, {1699, 1701}, {1701, 1703}, {1703, 1705}, {1705, 1707}, {1707, 1709},
+  {1709, 1711}, {1711, 1713}, {1713, 1715}, {1715, 1717}, {1717, 1719}, {1719, 1721},
+  {1721, 1723}, {1723, 1725}, {1725, 1727}, {1727, 1729}, {1729, 1731}, {1731, 1733},
+  {1733, 1735}, {1735, 1737}, {1737, 1739}, {1739, 1741}, {1741, 1743}, {1743, 1745},
+  {1745, 1747}, {1747, 1749}, {1749, 1751}, {1751, 1753}, {1753, 1755}, {1755, 1757},
+  {1757, 1759}, {1759, 1761}, {1761, 1763}, {1763, 1765}, {1765, 1767}, {1767, 1769},
+  {1769, 1771}, {1771, 1773}, {1773, 1775}, {1775, 1777}, {1777, 1779}, {1779, 1781},
+  {1781, 1783}, {1783, 1785}, {1785, 1787}, {1787, 1789}, {1789, 1791}, {1791, 1793},
+  {1793, 1795}, {1795, 1797}, {1797, 1799}, {1799, 1801}, {1801, 1803}, {1803, 1805},
+  {1805, 1807}, {1807, 1809}, {1809, 1811}, {1811, 1813}, {1813, 1815}, {1815, 1817},
+  {1817, 1819}, {1819, 1821}, {1821, 1823}, {1823, 1825}, {1825, 1827}, {1827, 1829},
+  {1829, 1831}, {1831, 1833}, {1833, 1835}, {1835, 1837}, {1837, 1839}, {1839, 1841},
+  {1841, 1843}, {1843, 1845}, {1845, 1847}, {1847, 1849}, {1849, 1851}, {1851, 1853},
+  {1853, 1855}, {1855, 1857}, {1857, 1859}, {1859, 1861}, {1861, 1863}, {1863, 1865},
+  {1865, 1867}, {1867, 1869}, {1869, 1871}, {1871, 1873}, {1873, 1875}, {1875, 1877},
+  {1877, 1879}, {1879, 1881}, {1881, 1883}, {1883, 1885}, {1885, 1887}, {1887, 1889},
+  {1889, 1891}, {1891, 1893}, {1893, 1895}, {1895, 1897}, {1897, 1899}, {1899, 1901},
+  {1901, 1903}, {1903, 1905}, {1905, 1907}, {1907, 1909}, {1909, 1911}, {1911, 1913},
+  {1913, 1915}, {1915, 1917}, {1917, 1919}, {1919, 1921}, {1921, 1923}, {1923, 1925},
+  {1925, 1927}, {1927, 1929}, {1929, 1931}, {1931, 1933}, {1933, 1935}, {1935, 1937},
+  {1937, 1939}, {1939, 1941}, {1941, 1943}, {1943, 1945}, {1945, 1947}, {1947, 1949},
+  {1949, 1951}, {1951, 1953}, {1953, 1955}, {1955, 1957}, {1957, 1959}, {1959, 1961},
+  {1961, 1963}, {1963, 1965}, {1965, 1967}, {1967, 1969}, {1969, 1971}, {1971, 1973},
+  {1973, 1975}, {1975, 1977}, {1977, 1979}, {1979, 1981}, {1981, 1983}, {1983, 1985},
+  {1985, 1987}, {1987, 1989}, {1989, 1991}, {1991, 1993}, {1993, 1995}, {1995, 1997},
+  {1997, 1999}, {1999, 2001}, {2001, 2003}, {2003, 2005}, {2005, 2007}, {2007, 2009},
+  {2009, 2011}, {2011, 2013}, {2013, 2015}, {2015, 2017}, {2017, 2019}, {2019, 2021},
+  {2021, 2023}, {2023, 2025}, {2025, 2027}, {2027, 2029}, {2029, 2031}, {2031, 2033},
+  {2033, 2035}, {2035, 2037}, {2037, 2039}, {2039, 2041}, {2041, 2043}, {2043, 2045},
+  {2045, 2047}, {2047, 2049}, {2049, 2051}, {2051, 2053}, {2053, 2055}, {2055, 2057},
+  {2057, 2059}, {2059, 2061}, {2061, 2063}, {2063, 2065}, {2065, 2067}, {2067, 2069},
+  {2069, 2071}, {2071, 2073}, {2073, 2075}, {2075, 2077}, {2077, 2079}, {2079, 2081},
+  {2081, 2083}, {2083, 2085}, {2085, 2087}, {2087, 2089}, {2089, 2091}, {2091, 2093},
+  {2093, 2095}, {2095, 2097}, {2097, 2099}, {2099, 2101}, {2101, 2103}, {2103, 2105},
+  {2105, 2107}, {2107, 2109}, {2109, 2111}, {2111, 2113}, {2113, 2115}, {2115, 2117},
+  {2117, 2119}, {2119, 2121}, {2121, 2123}, {2123, 2125}, {2125, 2127}, {2127, 2129},
+  {2129, 2131}, {2131, 2133}, {2133, 2135}, {2135, 2137}, {2137, 2139}, {2139, 2141},
+  {2141, 2143}, {2143, 2145}, {2145, 2147}, {2147, 2149}, {2149, 2151}, {2151, 2153},
+  {2153, 2155}, {2155, 2157}, {2157, 2159}, {2159, 2161}, {2161, 2163}, {2163, 2165},
+  {2165, 2167}, {2167, 2169}, {2169, 2171}, {2171, 2173}, {2173, 2175}, {2175, 2177},
+  {2177, 2179}, {2179, 2181}, {2181, 2183}, {2183, 2185}, {2185, 2187}, {2187, 2189},
+  {2189, 2191}, {2191, 2193}, {2193, 2195}, {2195, 2197}, {2197, 2199}, {2199, 2201},
+  {2201, 2203}, {2203, 2205}, {2205, 2207}, {2207, 2209}, {2209, 2211}, {2211, 2213},
+  {2213, 2215}, {2215, 2217}, {2217, 2219}, {2219, 2221}, {2221, 2223}, {2223, 2225},
+  {2225, 2227}, {2227, 2229}, {2229, 2231}, {2231, 2233}, {2233, 2235}, {2235, 2237},
+  {2237, 2239}, {2239, 2241}, {2241, 2243}, {2243, 2245}, {2245, 2247}, {2247, 2249},
+  {2249, 2251}, {2251, 2253}, {2253, 2255}, {2255, 2257}, {2257, 2259}, {2259, 2261},
+  {2261, 2263}, {2263, 2265}, {2265, 2267}, {2267, 2269}, {2269, 2271}, {2271, 2273},
+  {2273, 2275}, {2275, 2277}, {2277, 2279}, {2279, 2281}, {2281, 2283}, {2283, 2285},
+  {2285, 2287}, {2287, 2289}, {2289, 2291}, {2291, 2293}, {2293, 2295}, {2295, 2297},
+  {2297, 2299}, {2299, 2301}, {2301, 2303}, {2303, 2305}, {2305, 2307}, {2307, 2309},
+  {2309, 2311}, {2311, 2313}, {2313, 2315}, {2315, 2317}, {2317, 2319}, {2319, 2321},
+  {2321, 2323}, {2323, 2325}, {2325, 2327}, {2327, 2329}, {2329, 2331}, {2331, 2333},
+  {2333, 2335}, {2335, 2337}, {2337, 2339}, {2339, 2341}, {2341, 2343}, {2343, 2345},
+  {2345, 2347}, {2347, 2349}, {2349, 2351}, {2351, 2353}, {2353, 2355}, {2355, 2357},
+  {2357, 2359}, {2359, 2361}, {2361, 2363}, {2363, 2365}, {2365, 2367}, {2367, 2369},
+  {2369, 2371}, {2371, 2373}, {2373, 2375}, {2375, 2377}, {2377, 2379}, {2379, 2381},
+  {2381, 2383}, {2383, 2385}, {2385, 2387}, {2387, 2389}, {2389, 2391}, {2391, 2393},
+  {2393, 2395}, {2395, 2397}, {2397, 2399}, {2399, 2401}, {2401, 2403}, {2403, 2405},
+  {2405, 2407}, {2407, 2409}, {2409, 2411}, {2411, 2413}, {2413, 2415}, {2415, 2417},
+  {2417, 2419}, {2419, 2421}, {2421, 2423}, {2423, 2425}, {2425, 2427}, {2427, 2429},
+  {2429, 2431}, {2431, 2433}, {2433, 2435}, {2435, 2437}, {2437, 2439}, {2439, 2441},
+  {2441, 2443}, {2443, 2445}, {2445, 2447}, {2447, 2449}, {2449, 2451}, {2451, 2453},
+  {2453, 2455}, {2455, 2457}, {2457, 2459}, {2459, 2461}, {2461, 2463}, {2463, 2465},
+  {2465, 2467}, {2467, 2469}, {2469, 2471}, {2471, 2473}, {2473, 2475}, {2475, 2477},
+  {2477, 2479}, {2479, 2481}, {2481, 2483}, {2483, 2485}, {2485, 2487}, {2487, 2489},
+  {2489, 2491}, {2491, 2493}, {2493, 2495}, {2495, 2497}, {2497, 2499}, {2499, 2501},
+  {2501, 2503}, {2503, 2505}, {2505, 2507}, {2507, 2509}, {2509, 2511}, {2511, 2513},
+  {2513, 2515}, {2515, 2517}, {2517, 2519}, {2519, 2521}, {2521, 2523}, {2523, 2525},
+  {2525, 2527}, {2527, 2529}, {2529, 2531}, {2531, 2533}, {2533, 2535}, {2535, 2537},
+  {2537, 2539}, {2539, 2541}, {2541, 2543}, {2543, 2545}, {2545, 2547}, {2547, 2549},
+  {2549, 2551}, {2551, 2553}, {2553, 2555}, {2555, 2557}, {2557, 2559}, {2559, 2561},
+  {2561, 2563}, {2563, 2565}, {2565, 2567}, {2567, 2569}, {2569, 2571}, {2571, 2573},
+  {2573, 2575}, {2575, 2577}, {2577, 2579}, {2579, 2581}, {2581, 2583}, {2583, 2585},
+  {2585, 2587}, {2587, 2589}, {2589, 2591}, {2591, 2593}, {2593, 2595}, {2595, 2597},
+  {2597, 2599}, {2599, 2601}, {2601, 2603}, {2603, 2605}, {2605, 2607}, {2607, 2609},
+  {2609, 2611}, {2611, 2613}, {2613, 2615}, {2615, 2617}, {2617, 2619}, {2619, 2621},
+  {2621, 2623}, {2623, 2625}, {2625, 2627}, {2627, 2629}, {2629, 2631}, {2631, 2633},
+  {2633, 2635}, {2635, 2637}, {2637, 2639}, {2639, 2641}, {2641, 2643}, {2643, 2645},
+  {2645, 2647}, {2647, 2649}, {2649, 2651}, {2651, 2653}, {2653, 2655}, {2655, 2657},
+  {2657, 2659}, {2659, 2661}, {2661, 2663}, {2663, 2665}, {2665, 2667}, {2667, 2669},
+  {2669, 2671}, {2671, 2673}, {2673, 2675}, {2675, 2677}, {2677, 2679}, {2679, 2681},
+  {2681, 2683}, {2683, 2685}, {2685, 2687}, {2687, 2689}, {2689, 2691}, {2691, 2693},
+  {2693, 2695}, {2695, 2697}, {2697, 2699}, {2699, 2701}, {2701, 2703}, {2703, 2705},
+  {2705, 2707}, {2707, 2709}, {2709, 2711}, {2711, 2713}, {2713, 2715}, {2715, 2717},
+  {2717, 2719}, {2719, 2721}, {2721, 2723}, {2723, 2725}, {2725, 2727}, {2727, 2729},
+  {2729, 2731}, {2731, 2733}, {2733, 2735}, {2735, 2737}, {2737, 2739}, {2739, 2741},
+  {2741, 2743}, {2743, 2745}, {2745, 2747}, {2747, 2749}, {2749, 2751}, {2751, 2753},
+  {2753, 2755}, {2755, 2757}, {2757, 2759}, {2759, 2761}, {2761, 2763}, {2763, 2765},
+  {2765, 2767}, {2767, 2769}, {2769, 2771}, {2771, 2773}, {2773, 2775}, {2775, 2777},
+  {2777, 2779}, {2779, 2781}, {2781, 2783}, {2783, 2785}, {2785, 2787}, {2787, 2789},
+  {2789, 2791}, {2791, 2793}, {2793, 2795}, {2795, 2797}, {2797, 2799}, {2799, 2801},
+  {2801, 2803}, {2803, 2805}, {2805, 2807}, {2807, 2809}, {2809, 2811}, {2811, 2813},
+  {2813, 2815}, {2815, 2817}, {2817, 2819}, {2819, 2821}, {2821, 2823}, {2823, 2825},
+  {2825, 2827}, {2827, 2829}, {2829, 2831}, {2831, 2833}, {2833, 2835}, {2835, 2837},
+  {2837, 2839}, {2839, 2841}, {2841, 2843}, {2843, 2845}, {2845, 2847}, {2847, 2849},
+  {2849, 2851}, {2851, 2853}, {2853, 2855}, {2855, 2857}, {2857, 2859}, {2859, 2861},
+  {2861, 2863}, {2863, 2865}, {2865, 2867}, {2867, 2869}, {2869, 2871}, {2871, 2873},
+  {2873, 2875}, {2875, 2877}, {2877, 2879}, {2879, 2881}, {2881, 2883}, {2883, 2885},
+  {2885, 2887}, {2887, 2889}, {2889, 2891}, {2891, 2893}, {2893, 2895}, {2895, 2897},
+  {2897, 2899}, {2899, 2901}, {2901, 2903}, {2903, 2905}, {2905, 2907}, {2907, 2909},
+  {2909, 2911}, {2911, 2913}, {2913, 2915}, {2915, 2917}, {2917, 2919}, {2919, 2921},
+  {2921, 2923}, {2923, 2925}, {2925, 2927}, {2927, 2929}, {2929, 2931}, {2931, 2933},
+  {2933, 2935}, {2935, 2937}, {2937, 2939}, {2939, 2941}, {2941, 2943}, {2943, 2945},
+  {2945, 2947}, {2947, 2949}, {2949, 2951}, {2951, 2953}, {2953, 2955}, {2955, 2957},
+  {2957, 2959}, {2959, 2961}, {2961, 2963}, {2963, 2965}, {2965, 2967}, {2967, 2969},
+  {2969, 2971}, {2971, 2973}, {2973, 2975}, {2975, 2977}, {2977, 2979}, {2979, 2981},
+  {2981, 2983}, {2983, 2985}, {2985, 2987}, {2987, 2989}, {2989, 2991}, {2991, 2993},
+  {2993, 2995}, {2995, 2997}, {2997, 2999}, {2999, 3001}, {3001, 3003}, {3003, 3005},
+  {3005, 3007}, {3007, 3009}, {3009, 3011}, {3011, 3013}, {3013, 3015}, {3015, 3017},
+  {3017, 3019}, {3019, 3021}, {3021, 3023}, {3023, 3025}, {3025, 3027}, {3027, 3029},
+  {3029, 3031}, {3031, 3033}, {3033, 3035}, {3035, 3037}, {3037, 3039}, {3039, 3041},
+  {3041, 3043}, {3043, 3045}, {3045, 3047}, {3047, 3049}, {3049, 3051}, {3051, 3053},
+  {3053, 3055}, {3055, 3057}, {3057, 3059}, {3059, 3061}, {3061, 3063}, {3063, 3065},
+  {3065, 3067}, {3067, 3069}, {3069, 3071}, {3071, 3073}, {3073, 3075}, {3075, 3077},
+  {3077, 3079}, {3079, 3081}, {3081, 3083}, {3083, 3085}, {3085, 3087}, {3087, 3089},
+  {3089, 3091}, {3091, 3093}, {3093, 3095}, {3095, 3097}, {3097, 3099}, {3099, 3101},
+  {3101, 3103}, {3103, 3105}, {3105, 3107}, {3107, 3109}, {3109, 3111}, {3111, 3113},
+  {3113, 3115}, {3115, 3117}, {3117, 3119}, {3119, 3121}, {3121, 3123}, {3123, 3125},
+  {3125, 3127}, {3127, 3129}, {3129, 3131}, {3131, 3133}, {3133, 3135}, {3135, 3137},
+  {3137, 3139}, {3139, 3141}, {3141, 3143}, {3143, 3145}, {3145, 3147}, {3147, 3149},
+  {3149, 3151}, {3151, 3153}, {3153, 3155}, {3155, 3157}, {3157, 3159}, {3159, 3161},
+  {3161, 3163}, {3163, 3165}, {3165, 3167}, {3167, 3169}, {3169, 3171}, {3171, 3173},
+  {3173, 3175}, {3175, 3177}, {3177, 3179}, {3179, 3181}, {3181, 3183}, {3183, 3185},
+  {3185, 3187}, {3187, 3189}, {3189, 3191}, {3191, 3193}, {3193, 3195}, {3195, 3197},
+  {3197, 3199}, {3199, 3201}, {3201, 3203}, {3203, 3205}, {3205, 3207}, {3207, 3209},
+  {3209, 3211}, {3211, 3213}, {3213, 3215}, {3215, 3217}, {3217, 3219}, {3219, 3221},
+  {3221, 3223}, {3223, 3225}, {3225, 3227}, {3227, 3229}, {3229, 3231}, {3231, 3233},
+  {3233, 3235}, {3235, 3237}, {3237, 3239}, {3239, 3241}, {3241, 3243}, {3243, 3245},
+  {3245, 3247}, {3247, 3249}, {3249, 3251}, {3251, 3253}, {3253, 3255}, {3255, 3257},
+  {3257, 3259}, {3259, 3261}, {3261, 3263}, {3263, 3265}, {3265, 3267}, {3267, 3269},
+  {3269, 3271}, {3271, 3273}, {3273, 3275}, {3275, 3277}, {3277, 3279}, {3279, 3281},
+  {3281, 3283}, {3283, 3285}, {3285, 3287}, {3287, 3289}, {3289, 3291}, {3291, 3293},
+  {3293, 3295}, {3295, 3297}, {3297, 3299}, {3299, 3301}, {3301, 3303}, {3303, 3305},
+  {3305, 3307}, {3307, 3309}, {3309, 3311}, {3311, 3313}, {3313, 3315}, {3315, 3317},
+  {3317, 3319}, {3319, 3321}, {3321, 3323}, {3323, 3325}, {3325, 3327}, {3327, 3329},
+  {3329, 3331}, {3331, 3333}, {3333, 3335}, {3335, 3337}, {3337, 3339}, {3339, 3341},
+  {3341, 3343}, {3343, 3345}, {3345, 3347}, {3347, 3349}, {3349, 3351}, {3351, 3353},
+  {3353, 3355}, {3355, 3357}, {3357, 3359}, {3359, 3361}, {3361, 3363}, {3363, 3365},
+  {3365, 3367}, {3367, 3369}, {3369, 3371}, {3371, 3373}, {3373, 3375}, {3375, 3377},
+  {3377, 3379}, {3379, 3381}, {3381, 3383}, {3383, 3385}, {3385, 3387}, {3387, 3389},
+  {3389, 3391}, {3391, 3393}, {3393, 3395}, {3395, 3397}, {3397, 3399}, {3399, 3401},
+  {3401, 3403}, {3403, 3405}, {3405, 3407}, {3407, 3409}, {3409, 3411}, {3411, 3413},
+  {3413, 3415}, {3415, 3417}, {3417, 3419}, {3419, 3421}, {3421, 3423}, {3423, 3425},
+  {3425, 3427}, {3427, 3429}, {3429, 3431}, {3431, 3433}, {3433, 3435}, {3435, 3437},
+  {3437, 3439}, {3439, 3441}, {3441, 3443}, {3443, 3445}, {3445, 3447}, {3447, 3449},
+  {3449, 3451}, {3451, 3453}, {3453, 3455}, {3455, 3457}, {3457, 3459}, {3459, 3461},
+  {3461, 3463}, {3463, 3465}, {3465, 3467}, {3467, 3469}, {3469, 3471}, {3471, 3473},
+  {3473, 3475}, {3475, 3477}, {3477, 3479}, {3479, 3481}, {3481, 3483}, {3483, 3485},
+  {3485, 3487}, {3487, 3489}, {3489, 3491}, {3491, 3493}, {3493, 3495}, {3495, 3497},
+  {3497, 3499}, {3499, 3501}, {3501, 3503}, {3503, 3505}, {3505, 3507}, {3507, 3509},
+  {3509, 3511}, {3511, 3513}, {3513, 3515}, {3515, 3517}, {3517, 3519}, {3519, 3521},
+  {3521, 3523}, {3523, 3525}, {3525, 3527}, {3527, 3529}, {3529, 3531}, {3531, 3533},
+  {3533, 3535}, {3535, 3537}, {3537, 3539}, {3539, 3541}, {3541, 3543}, {3543, 3545},
+  {3545, 3547}, {3547, 3549}, {3549, 3551}, {3551, 3553}, {3553, 3555}, {3555, 3557},
+  {3557, 3559}, {3559, 3561}, {3561, 3563}, {3563, 3565}, {3565, 3567}, {3567, 3569},
+  {3569, 3571}, {3571, 3573}, {3573, 3575}, {3575, 3577}, {3577, 3579}, {3579, 3581},
+  {3581, 3583}, {3583, 3585}, {3585, 3587}, {3587, 3589}, {3589, 3591}, {3591, 3593},
+  {3593, 3595}, {3595, 3597}, {3597, 3599}, {3599, 3601}, {3601, 3603}, {3603, 3605},
+  {3605, 3607}, {3607, 3609}, {3609, 3611}, {3611, 3613}, {3613, 3615}, {3615, 3617},
+  {3617, 3619}, {3619, 3621}, {3621, 3623}, {3623, 3625}, {3625, 3627}, {3627, 3629},
+  {3629, 3631}, {3631, 3633}, {3633, 3635}, {3635, 3637}, {3637, 3639}, {3639, 3641},
+  {3641, 3643}, {3643, 3645}, {3645, 3647}, {3647, 3649}, {3649, 3651}, {3651, 3653},
+  {3653, 3655}, {3655, 3657}, {3657, 3659}, {3659, 3661}, {3661, 3663}, {3663, 3665},
+  {3665, 3667}, {3667, 3669}, {3669, 3671}, {3671, 3673}, {3673, 3675}, {3675, 3677},
+  {3677, 3679}, {3679, 3681}, {3681, 3683}, {3683, 3685}, {3685, 3687}, {3687, 3689},
+  {3689, 3691}, {3691, 3693}, {3693, 3695}, {3695, 3697}, {3697, 3699}, {3699, 3701},
+  {3701, 3703}, {3703, 3705}, {3705, 3707}, {3707, 3709}, {3709, 3711}, {3711, 3713},
+  {3713, 3715}, {3715, 3717}, {3717, 3719}, {3719, 3721}, {3721, 3723}, {3723, 3725},
+  {3725, 3727}, {3727, 3729}, {3729, 3731}, {3731, 3733}, {3733, 3735}, {3735, 3737},
+  {3737, 3739}, {3739, 3741}, {3741, 3743}, {3743, 3745}, {3745, 3747}, {3747, 3749},
+  {3749, 3751}, {3751, 3753}, {3753, 3755}, {3755, 3757}, {3757, 3759}, {3759, 3761},
+  {3761, 3763}, {3763, 3765}, {3765, 3767}, {3767, 3769}, {3769, 3771}, {3771, 3773},
+  {3773, 3775}, {3775, 3777}, {3777, 3779}, {3779, 3781}, {3781, 3783}, {3783, 3785},
+  {3785, 3787}, {3787, 3789}, {3789, 3791}, {3791, 3793}, {3793, 3795}, {3795, 3797},
+  {3797, 3799}, {3799, 3801}, {3801, 3803}, {3803, 3805}, {3805, 3807}, {3807, 3809},
+  {3809, 3811}, {3811, 3813}, {3813, 3815}, {3815, 3817}, {3817, 3819}, {3819, 3821},
+  {3821, 3823}, {3823, 3825}, {3825, 3827}, {3827, 3829}, {3829, 3831}, {3831, 3833},
+  {3833, 3835}, {3835, 3837}, {3837, 3839}, {3839, 3841}, {3841, 3843}, {3843, 3845},
+  {3845, 3847}, {3847, 3849}, {3849, 3851}, {3851, 3853}, {3853, 3855}, {3855, 3857},
+  {3857, 3859}, {3859, 3861}, {3861, 3863}, {3863, 3865}, {3865, 3867}, {3867, 3869},
+  {3869, 3871}, {3871, 3873}, {3873, 3875}, {3875, 3877}, {3877, 3879}, {3879, 3881},
+  {3881, 3883}, {3883, 3885}, {3885, 3887}, {3887, 3889}, {3889, 3891}, {3891, 3893},
+  {3893, 3895}, {3895, 3897}, {3897, 3899}, {3899, 3901}, {3901, 3903}, {3903, 3905},
+  {3905, 3907}, {3907, 3909}, {3909, 3911}, {3911, 3913}, {3913, 3915}, {3915, 3917},
+  {3917, 3919}, {3919, 3921}, {3921, 3923}, {3923, 3925}, {3925, 3927}, {3927, 3929},
+  {3929, 3931}, {3931, 3933}, {3933, 3935}, {3935, 3937}, {3937, 3939}, {3939, 3941},
+  {3941, 3943}, {3943, 3945}, {3945, 3947}, {3947, 3949}, {3949, 3951}, {3951, 3953},
+  {3953, 3955}, {3955, 3957}, {3957, 3959}, {3959, 3961}, {3961, 3963}, {3963, 3965},
+  {3965, 3967}, {3967, 3969}, {3969, 3971}, {3971, 3973}, {3973, 3975}, {3975, 3977},
+  {3977, 3979}, {3979, 3981}, {3981, 3983}, {3983, 3985}, {3985, 3987}, {3987, 3989},
+  {3989, 3991}, {3991, 3993}, {3993, 3995}, {3995, 3997}, {3997, 3999}, {3999, 4001},
+  {4001, 4003}, {4003, 4005}, {4005, 4007}, {4007, 4009}, {4009, 4011}, {4011, 4013},
+  {4013, 4015}, {4015, 4017}, {4017, 4019}, {4019, 4021}, {4021, 4023}, {4023, 4025},
+  {4025, 4027}, {4027, 4029}, {4029, 4031}, {4031, 4033}, {4033, 4035}, {4035, 4037},
+  {4037, 4039}, {4039, 4041}, {4041, 4043}, {4043, 4045}, {4045, 4047}, {4047, 4049},
+  {4049, 4051}, {4051, 4053}, {4053, 4055}, {4055, 4057}, {4057, 4059}, {4059, 4061},
+  {4061, 4063}, {4063, 4065}, {4065, 4067}, {4067, 4069}, {4069, 4071}, {4071, 4073},
+  {4073, 4075}, {4075, 4077}, {4077, 4079}, {4079, 4081}, {4081, 4083}, {4083, 4085},
+  {4085, 4087}, {4087, 4089}, {4089, 4091}, {4091, 4093}, {4093, 4095}, {4095, 4097},
+  {4097, 4099}, {4099, 4101}, {4101, 4103}, {4103, 4105}, {4105, 4107}, {4107, 4109},
+  {4109, 4111}, {4111, 4113}, {4113, 4115}, {4115, 4117}, {4117, 4119}, {4119, 4121},
+  {4121, 4123}, {4123, 4125}, {4125, 4127}, {4127, 4129}, {4129, 4131}, {4131, 4133},
+  {4133, 4135}, {4135, 4137}, {4137, 4139}, {4139, 4141}, {4141, 4143}, {4143, 4145},
+  {4145, 4147}, {4147, 4149}, {4149, 4151}, {4151, 4153}, {4153, 4155}, {4155, 4157},
+  {4157, 4159}, {4159, 4161}, {4161, 4163}, {4163, 4165}, {4165, 4167}, {4167, 4169},
+  {4169, 4171}, {4171, 4173}, {4173, 4175}, {4175, 4177}, {4177, 4179}, {4179, 4181},
+  {4181, 4183}, {4183, 4185}, {4185, 4187}, {4187, 4189}, {4189, 4191}, {4191, 4193},
+  {4193, 4195}, {4195, 4197}, {4197, 4199}, {4199, 4201}, {4201, 4203}, {4203, 4205},
+  {4205, 4207}, {4207, 4209}, {4209, 4211}, {4211, 4213}, {4213, 4215}, {4215, 4217},
+  {4217, 4219}, {4219, 4221}, {4221, 4223}, {4223, 4225}, {4225, 4227}, {4227, 4229},
+  {4229, 4231}, {4231, 4233}, {4233, 4235}, {4235, 4237}, {4237, 4239}, {4239, 4241},
+  {4241, 4243}, {4243, 4245}, {4245, 4247}, {4247, 4249}, {4249, 4251}, {4251, 4253},
+  {4253, 4255}, {4255, 4257}, {4257, 4259}, {4259, 4261}, {4261, 4263}, {4263, 4265},
+  {4265, 4267}, {4267, 4269}, {4269, 4271}, {4271, 4273}, {4273, 4275}, {4275, 4277},
+  {4277, 4279}, {4279, 4281}, {4281, 4283}, {4283, 4285}, {4285, 4287}, {4287, 4289},
+  {4289, 4291}, {4291, 4293}, {4293, 4295}, {4295, 4297}, {4297, 4299}, {4299, 4301},
+  {4301, 4303}, {4303, 4305}, {4305, 4307}, {4307, 4309}, {4309, 4311}, {4311, 4313},
+  {4313, 4315}, {4315, 4317}, {4317, 4319}, {4319, 4321}, {4321, 4323}, {4323, 4325},
+  {4325, 4327}, {4327, 4329}, {4329, 4331}, {4331, 4333}, {4333, 4335}, {4335, 4337},
+  {4337, 4339}, {4339, 4341}, {4341, 4343}, {4343, 4345}, {4345, 4347}, {4347, 4349},
+  {4349, 4351}, {4351, 4353}, {4353, 4355}, {4355, 4357}, {4357, 4359}, {4359, 4361},
+  {4361, 4363}, {4363, 4365}, {4365, 4367}, {4367, 4369}, {4369, 4371}, {4371, 4373},
+  {4373, 4375}, {4375, 4377}, {4377, 4379}, {4379, 4381}, {4381, 4383}, {4383, 4385},
+  {4385, 4387}, {4387, 4389}, {4389, 4391}, {4391, 4393}, {4393, 4395}, {4395, 4397},
+  {4397, 4399}, {4399, 4401}, {4401, 4403}, {4403, 4405}, {4405, 4407}, {4407, 4409},
+  {4409, 4411}, {4411, 4413}, {4413, 4415}, {4415, 4417}, {4417, 4419}, {4419, 4421},
+  {4421, 4423}, {4423, 4425}, {4425, 4427}, {4427, 4429}, {4429, 4431}, {4431, 4433},
+  {4433, 4435}, {4435, 4437}, {4437, 4439}, {4439, 4441}, {4441, 4443}, {4443, 4445},
+  {4445, 4447}, {4447, 4449}, {4449, 4451}, {4451, 4453}, {4453, 4455}, {4455, 4457},
+  {4457, 4459}, {4459, 4461}, {4461, 4463}, {4463, 4465}, {4465, 4467}, {4467, 4469},
+  {4469, 4471}, {4471, 4473}, {4473, 4475}, {4475, 4477}, {4477, 4479}, {4479, 4481},
+  {4481, 4483}, {4483, 4485}, {4485, 4487}, {4487, 4489}, {4489, 4491}, {4491, 4493},
+  {4493, 4495}, {4495, 4497}, {4497, 4499}, {4499, 4501}, {4501, 4503}, {4503, 4505},
+  {4505, 4507}, {4507, 4509}, {4509, 4511}, {4511, 4513}, {4513, 4515}, {4515, 4517},
+  {4517, 4519}, {4519, 4521}, {4521, 4523}, {4523, 4525}, {4525, 4527}, {4527, 4529},
+  {4529, 4531}, {4531, 4533}, {4533, 4535}, {4535, 4537}, {4537, 4539}, {4539, 4541},
+  {4541, 4543}, {4543, 4545}, {4545, 4547}, {4547, 4549}, {4549, 4551}, {4551, 4553},
+  {4553, 4555}, {4555, 4557}, {4557, 4559}, {4559, 4561}, {4561, 4563}, {4563, 4565},
+  {4565, 4567}, {4567, 4569}, {4569, 4571}, {4571, 4573}, {4573, 4575}, {4575, 4577},
+  {4577, 4579}, {4579, 4581}, {4581, 4583}, {4583, 4585}, {4585, 4587}, {4587, 4589},
+  {4589, 4591}, {4591, 4593}, {4593, 4595}, {4595, 4597}, {4597, 4599}, {4599, 4601},
+  {4601, 4603}, {4603, 4605}, {4605, 4607}, {4607, 4609}, {4609, 4611}, {4611, 4613},
+  {4613, 4615}, {4615, 4617}, {4617, 4619}, {4619, 4621}, {4621, 4623}, {4623, 4625},
+  {4625, 4627}, {4627, 4629}, {4629, 4631}, {4631, 4633}, {4633, 4635}, {4635, 4637},
+  {4637, 4639}, {4639, 4641}, {4641, 4643}, {4643, 4645}, {4645, 4647}, {4647, 4649},
+  {4649, 4651}, {4651, 4653}, {4653, 4655}, {4655, 4657}, {4657, 4659}, {4659, 4661},
+  {4661, 4663}, {4663, 4665}, {4665, 4667}, {4667, 4669}, {4669, 4671}, {4671, 4673},
+  {4673, 4675}, {4675, 4677}, {4677, 4679}, {4679, 4681}, {4681, 4683}, {4683, 4685},
+  {4685, 4687}, {4687, 4689}, {4689, 4691}, {4691, 4693}, {4693, 4695}, {4695, 4697},
+  {4697, 4699}, {4699, 4701}, {4701, 4703}, {4703, 4705}, {4705, 4707}, {4707, 4709},
+  {4709, 4711}, {4711, 4713}, {4713, 4715}, {4715, 4717}, {4717, 4719}, {4719, 4721},
+  {4721, 4723}, {4723, 4725}, {4725, 4727}, {4727, 4729}, {4729, 4731}, {4731, 4733},
+  {4733, 4735}, {4735, 4737}, {4737, 4739}, {4739, 4741}, {4741, 4743}, {4743, 4745},
+  {4745, 4747}, {4747, 4749}, {4749, 4751}, {4751, 4753}, {4753, 4755}, {4755, 4757},
+  {4757, 4759}, {4759, 4761}, {4761, 4763}, {4763, 4765}, {4765, 4767}, {4767, 4769},
+  {4769, 4771}, {4771, 4773}, {4773, 4775}, {4775, 4777}, {4777, 4779}, {4779, 4781},
+  {4781, 4783}, {4783, 4785}, {4785, 4787}, {4787, 4789}, {4789, 4791}, {4791, 4793},
+  {4793, 4795}, {4795, 4797}, {4797, 4799}, {4799, 4801}, {4801, 4803}, {4803, 4805},
+  {4805, 4807}, {4807, 4809}, {4809, 4811}, {4811, 4813}, {4813, 4815}, {4815, 4817},
+  {4817, 4819}, {4819, 4821}, {4821, 4823}, {4823, 4825}, {4825, 4827}, {4827, 4829},
+  {4829, 4831}, {4831, 4833}, {4833, 4835}, {4835, 4837}, {4837, 4839}, {4839, 4841},
+  {4841, 4843}, {4843, 4845}, {4845, 4847}, {4847, 4849}, {4849, 4851}, {4851, 4853},
+  {4853, 4855}, {4855, 4857}, {4857, 4859}, {4859, 4861}, {4861, 4863}, {4863, 4865},
+  {4865, 4867}, {4867, 4869}, {4869, 4871}, {4871, 4873}, {4873, 4875}, {4875, 4877},
+  {4877, 4879}, {4879, 4881}, {4881, 4883}, {4883, 4885}, {4885, 4887}, {4887, 4889},
+  {4889, 4891}, {4891, 4893}, {4893, 4895}, {4895, 4897}, {4897, 4899}, {4899, 4901},
+  {4901, 4903}, {4903, 4905}, {4905, 4907}, {4907, 4909}, {4909, 4911}, {4911, 4913},
+  {4913, 4915}, {4915, 4917}, {4917, 4919}, {4919, 4921}, {4921, 4923}, {4923, 4925},
+  {4925, 4927}, {4927, 4929}, {4929, 4931}, {4931, 4933}, {4933, 4935}, {4935, 4937},
+  {4937, 4939}, {4939, 4941}, {4941, 4943}, {4943, 4945}, {4945, 4947}, {4947, 4949},
+  {4949, 4951}, {4951, 4953}, {4953, 4955}, {4955, 4957}, {4957, 4959}, {4959, 4961},
+  {4961, 4963}, {4963, 4965}, {4965, 4967}, {4967, 4969}, {4969, 4971}, {4971, 4973},
+  {4973, 4975}, {4975, 4977}, {4977, 4979}, {4979, 4981}, {4981, 4983}, {4983, 4985},
+  {4985, 4987}, {4987, 4989}, {4989, 4991}, {4991, 4993}, {4993, 4995}, {4995, 4997},
+  {4997, 4999}, {4999, 5001}, {5001, 5003}, {5003, 5005}, {5005, 5007}, {5007, 5009},
+  {5009, 5011}, {5011, 5013}, {5013, 5015}, {5015, 5017}, {5017, 5019}, {5019, 5021},
+  {5021, 5023}, {5023, 5025}, {5025, 5027}, {5027, 5029}, {5029, 5031}, {5031, 5033},
+  {5033, 5035}, {5035, 5037}, {5037, 5039}, {5039, 5041}, {5041, 5043}, {5043, 5045},
+  {5045, 5047}, {5047, 5049}, {5049, 5051}, {5051, 5053}, {5053, 5055}, {5055, 5057},
+  {5057, 5059}, {5059, 5061}, {5061, 5063}, {5063, 5065}, {5065, 5067}, {5067, 5069},
+  {5069, 5071}, {5071, 5073}, {5073, 5075}, {5075, 5077}, {5077, 5079}, {5079, 5081},
+  {5081, 5083}, {5083, 5085}, {5085, 5087}, {5087, 5089}, {5089, 5091}, {5091, 5093},
+  {5093, 5095}, {5095, 5097}, {5097, 5099}, {5099, 5101}, {5101, 5103}, {5103, 5105},
+  {5105, 5107}, {5107, 5109}, {5109, 5111}, {5111, 5113}, {5113, 5115}, {5115, 5117},
+  {5117, 5119}, {5119, 5121}, {5121, 5123}, {5123, 5125}, {5125, 5127}, {5127, 5129},
+  {5129, 5131}, {5131, 5133}, {5133, 5135}, {5135, 5137}, {5137, 5139}, {5139, 5141},
+  {5141, 5143}, {5143, 5145}, {5145, 5147}, {5147, 5149}, {5149, 5151}, {5151, 5153},
+  {5153, 5155}, {5155, 5157}, {5157, 5159}, {5159, 5161}, {5161, 5163}, {5163, 5165},
+  {5165, 5167}, {5167, 5169}, {5169, 5171}, {5171, 5173}, {5173, 5175}, {5175, 5177},
+  {5177, 5179}, {5179, 5181}, {5181, 5183}, {5183, 5185}, {5185, 5187}, {5187, 5189},
+  {5189, 5191}, {5191, 5193}, {5193, 5195}, {5195, 5197}, {5197, 5199}, {5199, 5201},
+  {5201, 5203}, {5203, 5205}, {5205, 5207}, {5207, 5209}, {5209, 5211}, {5211, 5213},
+  {5213, 5215}, {5215, 5217}, {5217, 5219}, {5219, 5221}, {5221, 5223}, {5223, 5225},
+  {5225, 5227}, {5227, 5229}, {5229, 5231}, {5231, 5233}, {5233, 5235}, {5235, 5237},
+  {5237, 5239}, {5239, 5241}, {5241, 5243}, {5243, 5245}, {5245, 5247}, {5247, 5249},
+  {5249, 5251}, {5251, 5253}, {5253, 5255}, {5255, 5257}, {5257, 5259}, {5259, 5261},
+  {5261, 5263}, {5263, 5265}, {5265, 5267}, {5267, 5269}, {5269, 5271}, {5271, 5273},
+  {5273, 5275}, {5275, 5277}, {5277, 5279}, {5279, 5281}, {5281, 5283}, {5283, 5285},
+  {5285, 5287}, {5287, 5289}, {5289, 5291}, {5291, 5293}, {5293, 5295}, {5295, 5297},
+  {5297, 5299}, {5299, 5301}, {5301, 5303}, {5303, 5305}, {5305, 5307}, {5307, 5309},
+  {5309, 5311}, {5311, 5313}, {5313, 5315}, {5315, 5317}, {5317, 5319}, {5319, 5321},
+  {5321, 5323}, {5323, 5325}, {5325, 5327}, {5327, 5329}, {5329, 5331}, {5331, 5333},
+  {5333, 5335}, {5335, 5337}, {5337, 5339}, {5339, 5341}, {5341, 5343}, {5343, 5345},
+  {5345, 5347}, {5347, 5349}, {5349, 5351}, {5351, 5353}, {5353, 5355}, {5355, 5357},
+  {5357, 5359}, {5359, 5361}, {5361, 5363}, {5363, 5365}, {5365, 5367}, {5367, 5369},
+  {5369, 5371}, {5371, 5373}, {5373, 5375}, {5375, 5377}, {5377, 5379}, {5379, 5381},
+  {5381, 5383}, {5383, 5385}, {5385, 5387}, {5387, 5389}, {5389, 5391}, {5391, 5393},
+  {5393, 5395}, {5395, 5397}, {5397, 5399}, {5399, 5401}, {5401, 5403}, {5403, 5405},
+  {5405, 5407}, {5407, 5409}, {5409, 5411}, {5411, 5413}, {5413, 5415}, {5415, 5417},
+  {5417, 5419}, {5419, 5421}, {5421, 5423}, {5423, 5425}, {5425, 5427}, {5427, 5429},
+  {5429, 5431}, {5431, 5433}, {5433, 5435}, {5435, 5437}, {5437, 5439}, {5439, 5441},
+  {5441, 5443}, {5443, 5445}, {5445, 5447}, {5447, 5449}, {5449, 5451}, {5451, 5453},
+  {5453, 5455}, {5455, 5457}, {5457, 5459}, {5459, 5461}, {5461, 5463}, {5463, 5465},
+  {5465, 5467}, {5467, 5469}, {5469, 5471}, {5471, 5473}, {5473, 5475}, {5475, 5477},
+  {5477, 5479}, {5479, 5481}, {5481, 5483}, {5483, 5485}, {5485, 5487}, {5487, 5489},
+  {5489, 5491}, {5491, 5493}, {5493, 5495}, {5495, 5497}, {5497, 5499}, {5499, 5501},
+  {5501, 5503}, {5503, 5505}, {5505, 5507}, {5507, 5509}, {5509, 5511}, {5511, 5513},
+  {5513, 5515}, {5515, 5517}, {5517, 5519}, {5519, 5521}, {5521, 5523}, {5523, 5525},
+  {5525, 5527}, {5527, 5529}, {5529, 5531}, {5531, 5533}, {5533, 5535}, {5535, 5537},
+  {5537, 5539}, {5539, 5541}, {5541, 5543}, {5543, 5545}, {5545, 5547}, {5547, 5549},
+  {5549, 5551}, {5551, 5553}, {5553, 5555}, {5555, 5557}, {5557, 5559}, {5559, 5561},
+  {5561, 5563}, {5563, 5565}, {5565, 5567}, {5567, 5569}, {5569, 5571}, {5571, 5573},
+  {5573, 5575}, {5575, 5577}, {5577, 5579}, {5579, 5581}, {5581, 5583}, {5583, 5585},
+  {5585, 5587}, {5587, 5589}, {5589, 5591}, {5591, 5593}, {5593, 5595}, {5595, 5597},
+  {5597, 5599}, {5599, 5601}, {5601, 5603}, {5603, 5605}, {5605, 5607}, {5607, 5609},
+  {5609, 5611}, {5611, 5613}, {5613, 5615}, {5615, 5617}, {5617, 5619}, {5619, 5621},
+  {5621, 5623}, {5623, 5625}, {5625, 5627}, {5627, 5629}, {5629, 5631}, {5631, 5633},
+  {5633, 5635}, {5635, 5637}, {5637, 5639}, {5639, 5641}, {5641, 5643}, {5643, 5645},
+  {5645, 5647}, {5647, 5649}, {5649, 5651}, {5651, 5653}, {5653, 5655}, {5655, 5657},
+  {5657, 5659}, {5659, 5661}, {5661, 5663}, {5663, 5665}, {5665, 5667}, {5667, 5669},
+  {5669, 5671}, {5671, 5673}, {5673, 5675}, {5675, 5677}, {5677, 5679}, {5679, 5681},
+  {5681, 5683}, {5683, 5685}, {5685, 5687}, {5687, 5689}, {5689, 5691}, {5691, 5693},
+  {5693, 5695}, {5695, 5697}, {5697, 5699}, {5699, 5701}, {5701, 5703}, {5703, 5705},
+  {5705, 5707}, {5707, 5709}, {5709, 5711}, {5711, 5713}, {5713, 5715}, {5715, 5717},
+  {5717, 5719}, {5719, 5721}, {5721, 5723}, {5723, 5725}, {5725, 5727}, {5727, 5729},
+  {5729, 5731}, {5731, 5733}, {5733, 5735}, {5735, 5737}, {5737, 5739}, {5739, 5741},
+  {5741, 5743}, {5743, 5745}, {5745, 5747}, {5747, 5749}, {5749, 5751}, {5751, 5753},
+  {5753, 5755}, {5755, 5757}, {5757, 5759}, {5759, 5761}, {5761, 5763}, {5763, 5765},
+  {5765, 5767}, {5767, 5769}, {5769, 5771}, {5771, 5773}, {5773, 5775}, {5775, 5777},
+  {5777, 5779}, {5779, 5781}, {5781, 5783}, {5783, 5785}, {5785, 5787}, {5787, 5789},
+  {5789, 5791}, {5791, 5793}, {5793, 5795}, {5795, 5797}, {5797, 5799}, {5799, 5801},
+  {5801, 5803}, {5803, 5805}, {5805, 5807}, {5807, 5809}, {5809, 5811}, {5811, 5813},
+  {5813, 5815}, {5815, 5817}, {5817, 5819}, {5819, 5821}, {5821, 5823}, {5823, 5825},
+  {5825, 5827}, {5827, 5829}, {5829, 5831}, {5831, 5833}, {5833, 5835}, {5835, 5837},
+  {5837, 5839}, {5839, 5841}, {5841, 5843}, {5843, 5845}, {5845, 5847}, {5847, 5849},
+  {5849, 5851}, {5851, 5853}, {5853, 5855}, {5855, 5857}, {5857, 5859}, {5859, 5861},
+  {5861, 5863}, {5863, 5865}, {5865, 5867}, {5867, 5869}, {5869, 5871}, {5871, 5873},
+  {5873, 5875}, {5875, 5877}, {5877, 5879}, {5879, 5881}, {5881, 5883}, {5883, 5885},
+  {5885, 5887}, {5887, 5889}, {5889, 5891}, {5891, 5893}, {5893, 5895}, {5895, 5897},
+  {5897, 5899}, {5899, 5901}, {5901, 5903}, {5903, 5905}, {5905, 5907}, {5907, 5909},
+  {5909, 5911}, {5911, 5913}, {5913, 5915}, {5915, 5917}, {5917, 5919}, {5919, 5921},
+  {5921, 5923}, {5923, 5925}, {5925, 5927}, {5927, 5929}, {5929, 5931}, {5931, 5933},
+  {5933, 5935}, {5935, 5937}, {5937, 5939}, {5939, 5941}, {5941, 5943}, {5943, 5945},
+  {5945, 5947}, {5947, 5949}, {5949, 5951}, {5951, 5953}, {5953, 5955}, {5955, 5957},
+  {5957, 5959}, {5959, 5961}, {5961, 5963}, {5963, 5965}, {5965, 5967}, {5967, 5969},
+  {5969, 5971}, {5971, 5973}, {5973, 5975}, {5975, 5977}, {5977, 5979}, {5979, 5981},
+  {5981, 5983}, {5983, 5985}, {5985, 5987}, {5987, 5989}, {5989, 5991}, {5991, 5993},
+  {5993, 5995}, {5995, 5997}, {5997, 5999}, {5999, 6001}, {6001, 6003}, {6003, 6005},
+  {6005, 6007}, {6007, 6009}, {6009, 6011}, {6011, 6013}, {6013, 6015}, {6015, 6017},
+  {6017, 6019}, {6019, 6021}, {6021, 6023}, {6023, 6025}, {6025, 6027}, {6027, 6029},
+  {6029, 6031}, {6031, 6033}, {6033, 6035}, {6035, 6037}, {6037, 6039}, {6039, 6041},
+  {6041, 6043}, {6043, 6045}, {6045, 6047}, {6047, 6049}, {6049, 6051}, {6051, 6053},
+  {6053, 6055}, {6055, 6057}, {6057, 6059}, {6059, 6061}, {6061, 6063}, {6063, 6065},
+  {6065, 6067}, {6067, 6069}, {6069, 6071}, {6071, 6073}, {6073, 6075}, {6075, 6077},
+  {6077, 6079}, {6079, 6081}, {6081, 6083}, {6083, 6085}, {6085, 6087}, {6087, 6089},
+  {6089, 6091}, {6091, 6093}, {6093, 6095}, {6095, 6097}, {6097, 6099}, {6099, 6101},
+  {6101, 6103}, {6103, 6105}, {6105, 6107}, {6107, 6109}, {6109, 6111}, {6111, 6113},
+  {6113, 6115}, {6115, 6117}, {6117, 6119}, {6119, 6121}, {6121, 6123}, {6123, 6125},
+  {6125, 6127}, {6127, 6129}, {6129, 6131}, {6131, 6133}, {6133, 6135}, {6135, 6137},
+  {6137, 6139}, {6139, 6141}, {6141, 6143}, {6143, 6145}, {6145, 6147}, {6147, 6149},
+  {6149, 6151}, {6151, 6153}, {6153, 6155}, {6155, 6157}, {6157, 6159}, {6159, 6161},
+  {6161, 6163}, {6163, 6165}, {6165, 6167}, {6167, 6169}, {6169, 6171}, {6171, 6173},
+  {6173, 6175}, {6175, 6177}, {6177, 6179}, {6179, 6181}, {6181, 6183}, {6183, 6185},
+  {6185, 6187}, {6187, 6189}, {6189, 6191}, {6191, 6193}, {6193, 6195}, {6195, 6197},
+  {6197, 6199}, {6199, 6201}, {6201, 6203}, {6203, 6205}, {6205, 6207}, {6207, 6209},
+  {6209, 6211}, {6211, 6213}, {6213, 6215}, {6215, 6217}, {6217, 6219}, {6219, 6221},
+  {6221, 6223}, {6223, 6225}, {6225, 6227}, {6227, 6229}, {6229, 6231}, {6231, 6233},
+  {6233, 6235}, {6235, 6237}, {6237, 6239}, {6239, 6241}, {6241, 6243}, {6243, 6245},
+  {6245, 6247}, {6247, 6249}, {6249, 6251}, {6251, 6253}, {6253, 6255}, {6255, 6257},
+  {6257, 6259}, {6259, 6261}, {6261, 6263}, {6263, 6265}, {6265, 6267}, {6267, 6269},
+  {6269, 6271}, {6271, 6273}, {6273, 6275}, {6275, 6277}, {6277, 6279}, {6279, 6281},
+  {6281, 6283}, {6283, 6285}, {6285, 6287}, {6287, 6289}, {6289, 6291}, {6291, 6293},
+  {6293, 6295}, {6295, 6297}, {6297, 6299}, {6299, 6301}, {6301, 6303}, {6303, 6305},
+  {6305, 6307}, {6307, 6309}, {6309, 6311}, {6311, 6313}, {6313, 6315}, {6315, 6317},
+  {6317, 6319}, {6319, 6321}, {6321, 6323}, {6323, 6325}, {6325, 6327}, {6327, 6329},
+  {6329, 6331}, {6331, 6333}, {6333, 6335}, {6335, 6337}, {6337, 6339}, {6339, 6341},
+  {6341, 6343}, {6343, 6345}, {6345, 6347}, {6347, 6349}, {6349, 6351}, {6351, 6353},
+  {6353, 6355}, {6355, 6357}, {6357, 6359}, {6359, 6361}, {6361, 6363}, {6363, 6365},
+  {6365, 6367}, {6367, 6369}, {6369, 6371}, {6371, 6373}, {6373, 6375}, {6375, 6377},
+  {6377, 6379}, {6379, 6381}, {6381, 6383}, {6383, 6385}, {6385, 6387}, {6387, 6389},
+  {6389, 6391}, {6391, 6393}, {6393, 6395}, {6395, 6397}, {6397, 6399}, {6399, 6401},
+  {6401, 6403}, {6403, 6405}, {6405, 6407}, {6407, 6409}, {6409, 6411}, {6411, 6413},
+  {6413, 6415}, {6415, 6417}, {6417, 6419}, {6419, 6421}, {6421, 6423}, {6423, 6425},
+  {6425, 6427}, {6427, 6429}, {6429, 6431}, {6431, 6433}, {6433, 6435}, {6435, 6437},
+  {6437, 6439}, {6439, 6441}, {6441, 6443}, {6443, 6445}, {6445, 6447}, {6447, 6449},
+  {6449, 6451}, {6451, 6453}, {6453, 6455}, {6455, 6457}, {6457, 6459}, {6459, 6461},
+  {6461, 6463}, {6463, 6465}, {6465, 6467}, {6467, 6469}, {6469, 6471}, {6471, 6473},
+  {6473, 6475}, {6475, 6477}, {6477, 6479}, {6479, 6481}, {6481, 6483}, {6483, 6485},
+  {6485, 6487}, {6487, 6489}, {6489, 6491}, {6491, 6493}, {6493, 6495}, {6495, 6497},
+  {6497, 6499}, {6499, 6501}, {6501, 6503}, {6503, 6505}, {6505, 6507}, {6507, 6509},
+  {6509, 6511}, {6511, 6513}, {6513, 6515}, {6515, 6517}, {6517, 6519}, {6519, 6521},
+  {6521, 6523}, {6523, 6525}, {6525, 6527}, {6527, 6529}, {6529, 6531}, {6531, 6533},
+  {6533, 6535}, {6535, 6537}, {6537, 6539}, {6539, 6541}, {6541, 6542}
+};
+#else
+#error GMP_NUMB_BITS value not supported.
+#endif
+#endif /* GMP_NUMB_BITS */
+
+#endif
@@ -0,0 +1,352 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Génération de nombres premiers prouvés et certificats de primalité
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "anssipki-common.h"
+#include "anssipki-asn1.h"
+#include "anssipki-crypto.h"
+#include <cmath>
+
+using namespace ANSSIPKI_ASN1;
+
+/* Méthode de Maurer ("Fast generation of prime numbers and secure
+   public-key cryptographic parameters", 1995) : un premier p de k bits
+   est cherché sous la forme p = 2 R q + 1, où q est un premier prouvé
+   de taille relative r dans [1/2, 1) (lui-même obtenu de la même
+   façon, jusqu'à un premier de moins de 32 bits prouvé par divisions).
+   Comme q^2 > p, le critère de Pocklington suffit : s'il existe a tel
+   que
+     a^(p-1) = 1 mod p  et  pgcd (a^(2R) - 1, p) = 1,
+   tout facteur premier de p est congru à 1 modulo q, donc supérieur à
+   racine de p : p est premier. Chaque candidat ayant passé le crible ne
+   coûte qu'une exponentiation modulaire (un test de Fermat, à la même
+   taille que le premier tour de Miller-Rabin), sans les tours
+   supplémentaires ni le test de Lucas des premiers probables ; les
+   niveaux inférieurs, de taille moitié, coûtent une fraction du niveau
+   supérieur.
+
+   Le certificat est la chaîne des preuves, encodée en DER :
+     PrimeCertificate ::= SEQUENCE {
+       p0     INTEGER,                  -- premier < 2^32
+       steps  SEQUENCE { R INTEGER, a INTEGER } ... }
+   chaque étape donnant p_i = 2 R_i p_(i-1) + 1 et son témoin a_i. Sa
+   taille est de l'ordre de celle de p. La vérification ne demande
+   qu'une exponentiation par étape, et ne dépend ni des tables de petits
+   premiers ni d'aucun aléa.
+
+   Comme pour la méthode de Maurer, la taille relative r est tirée avec
+   la densité de 2^(s-1), s uniforme sur [0, 1), pour que les premiers
+   produits soient distribués presque uniformément. */
+
+// Taille maximale des premiers prouvés par divisions
+#define PROVABLE_PRIME_LEAF_BITS 32
+// Taille minimale de R, pour que chaque étape dispose d'assez de candidats
+#define PROVABLE_PRIME_MIN_R_BITS 20
+// Nombre de témoins essayés pour un candidat
+#define PROVABLE_PRIME_MAX_WITNESS 64
+// Candidats criblés ensemble (voir SIEVE_BATCH_CANDIDATES dans prime.cpp)
+#define PROVABLE_PRIME_BATCH 32
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Vérification d'un certificat
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// Primalité d'un entier < 2^32 par divisions
+static bool isSmallPrime (unsigned long n) {
+  if (n < 4)
+    return (n >= 2);
+  if ((n & 1) == 0)
+    return false;
+  for (unsigned long d = 3; d * d <= n; d += 2)
+    if (n % d == 0)
+      return false;
+  return true;
+}
+
+
+// Lecture d'un INTEGER strictement positif
+static bool getNextPositive (const String& DERString, mpz_t n) {
+  ASN1_BASIC asn1Integer (DERString);
+
+  if (asn1Integer.classe != C_UNIV || asn1Integer.tagNumber != T_INTG
+      || asn1Integer.value.size () == 0 || (asn1Integer.value.toChar ()[0] & 0x80))
+    return false;
+
+  mpz_import (n, asn1Integer.value.size (), 1, 1, 0, 0, asn1Integer.value.toChar ());
+  return (mpz_sgn (n) > 0);
+}
+
+
+/* Critère de Pocklington pour p = 2 R q + 1, q premier et q^2 > p :
+   y = a^(2R) mod p doit vérifier y^q = 1 mod p et pgcd (y - 1, p) = 1.
+   Retourne 1 si a prouve que p est premier, 0 si a prouve que p est
+   composé, et -1 si a ne permet pas de conclure (y = 1, ou a >= p). */
+static int pocklington (const mpz_t p, const mpz_t R, const mpz_t q, unsigned long a,
+			mpz_t y, mpz_t t) {
+  if (mpz_cmp_ui (p, a) <= 0)
+    return -1;
+
+  mpz_set_ui (t, a);
+  mpz_mul_2exp (y, R, 1);
+  mpz_powm (y, t, y, p);
+  mpz_powm (t, y, q, p);
+  if (mpz_cmp_ui (t, 1) != 0)
+    return 0;
+
+  mpz_sub_ui (t, y, 1);
+  mpz_gcd (t, t, p);
+  if (mpz_cmp_ui (t, 1) == 0)
+    return 1;
+  return (mpz_cmp (t, p) == 0) ? -1 : 0;
+}
+
+
+bool checkPrimeCertificate (mpz_t p, const String& certificate) {
+  mpz_t q, R, a, y, t;
+  bool res = false;
+
+  mpz_init (q);
+  mpz_init (R);
+  mpz_init (a);
+  mpz_init (y);
+  mpz_init (t);
+
+  try {
+    certificate.initIndex ();
+    String content (decapsulate (certificate, T_SEQU));
+
+    if (!certificate.eof () || !getNextPositive (content, p) || mpz_sizeinbase (p, 2) > PROVABLE_PRIME_LEAF_BITS
+	|| !isSmallPrime (mpz_get_ui (p)))
+      goto end;
+
+    while (!content.eof ()) {
+      String step (decapsulate (content, T_SEQU));
+      if (!getNextPositive (step, R) || !getNextPositive (step, a) || !step.eof ()
+	  || !mpz_fits_ulong_p (a))
+	goto end;
+
+      // p <- 2 R q + 1, avec (q + 1)^2 > p
+      mpz_swap (p, q);
+      mpz_mul (p, R, q);
+      mpz_mul_2exp (p, p, 1);
+      mpz_add_ui (p, p, 1);
+      mpz_add_ui (t, q, 1);
+      mpz_mul (t, t, t);
+      if (mpz_cmp (t, p) <= 0)
+	goto end;
+
+      if (pocklington (p, R, q, mpz_get_ui (a), y, t) != 1)
+	goto end;
+    }
+    res = true;
+  } catch (ANSSIPKIException& e) {
+    res = false;
+  }
+
+ end:
+  mpz_shred (q);
+  mpz_shred (R);
+  mpz_shred (a);
+  mpz_shred (y);
+  mpz_shred (t);
+
+  return res;
+}
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Génération
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// Premier de k bits (2 <= k <= PROVABLE_PRIME_LEAF_BITS), dont les
+// deux bits de poids fort valent 1 si topTwoBits
+static void genSmallPrime (mpz_t p, size_t k, PRNG& generator, bool topTwoBits) {
+  do {
+    generator.getRandomInt (p, k, false);
+    mpz_setbit (p, 0);
+    if (topTwoBits)
+      mpz_setbit (p, k - 2);
+  } while (!isSmallPrime (mpz_get_ui (p)));
+}
+
+
+// Taille de q pour un premier p de k bits : q^2 > p, et R d'au moins
+// PROVABLE_PRIME_MIN_R_BITS bits lorsque k le permet
+static size_t provableFactorSize (size_t k, PRNG& generator) {
+  const size_t minBits = (k + 1) / 2 + 1;
+  mpz_t u;
+  size_t bits;
+
+  if (k < minBits + PROVABLE_PRIME_MIN_R_BITS)
+    return minBits;
+
+  // r = 2^(s-1), s uniforme sur [0, 1)
+  mpz_init (u);
+  mpz_set_ui (u, 1);
+  mpz_mul_2exp (u, u, 32);
+  generator.getRandomIntNB (u, u, false);
+  double r = exp2 (mpz_get_d (u) / 4294967296.0 - 1.0);
+  mpz_clear (u);
+
+  bits = (size_t) (r * (double) k);
+  if (bits < minBits)
+    bits = minBits;
+  if (bits > k - PROVABLE_PRIME_MIN_R_BITS)
+    bits = k - PROVABLE_PRIME_MIN_R_BITS;
+  return bits;
+}
+
+
+/* Recherche de p = 2 R q + 1 de k bits (dont les deux bits de poids
+   fort valent 1 si topTwoBits), premier d'après le critère de
+   Pocklington (témoin a). Les candidats sont criblés par lots. */
+static void genProvableStep (mpz_t p, mpz_t R, unsigned long* a, const mpz_t q, size_t k,
+			     PRNG& generator, bool topTwoBits) {
+  const unsigned int B = PROVABLE_PRIME_BATCH;
+  mpz_t batch[PROVABLE_PRIME_BATCH], Rs[PROVABLE_PRIME_BATCH];
+  bool sieved[PROVABLE_PRIME_BATCH];
+  mpz_t lo, l, y, t;
+  bool found = false;
+
+  mpz_init (lo);
+  mpz_init (l);
+  mpz_init (y);
+  mpz_init (t);
+  for (unsigned int i = 0; i < B; i++) {
+    mpz_init (batch[i]);
+    mpz_init (Rs[i]);
+  }
+
+  // 2^(k-1) (ou 3 x 2^(k-2)) <= 2 R q + 1 < 2^k : R dans [lo, lo + l)
+  mpz_mul_2exp (t, q, 1);
+  mpz_set_ui (lo, 0);
+  mpz_setbit (lo, k - 1);
+  if (topTwoBits)
+    mpz_setbit (lo, k - 2);
+  mpz_sub_ui (lo, lo, 1);
+  mpz_cdiv_q (lo, lo, t);
+  mpz_set_ui (l, 0);
+  mpz_setbit (l, k);
+  mpz_sub_ui (l, l, 2);
+  mpz_fdiv_q (l, l, t);
+  mpz_sub (l, l, lo);
+  mpz_add_ui (l, l, 1);
+
+  while (!found) {
+    for (unsigned int i = 0; i < B; i++) {
+      generator.getRandomIntNB (Rs[i], l, false);
+      mpz_add (Rs[i], Rs[i], lo);
+      mpz_mul (batch[i], Rs[i], q);
+      mpz_mul_2exp (batch[i], batch[i], 1);
+      mpz_add_ui (batch[i], batch[i], 1);
+    }
+    // Les candidats dépassent 2^32 : aucun n'est l'un des premiers du
+    // crible
+    isPrime_SieveBatch (batch, B, sieved);
+
+    for (unsigned int i = 0; i < B && !found; i++) {
+      if (!sieved[i])
+	continue;
+      for (unsigned long w = 2; w < PROVABLE_PRIME_MAX_WITNESS; w++) {
+	int r = pocklington (batch[i], Rs[i], q, w, y, t);
+	if (r < 0)
+	  continue;
+	if (r == 1) {
+	  mpz_set (p, batch[i]);
+	  mpz_set (R, Rs[i]);
+	  *a = w;
+	  found = true;
+	}
+	break;
+      }
+    }
+  }
+
+  for (unsigned int i = 0; i < B; i++) {
+    mpz_shred (batch[i]);
+    mpz_shred (Rs[i]);
+  }
+  mpz_shred (lo);
+  mpz_shred (l);
+  mpz_shred (y);
+  mpz_shred (t);
+}
+
+
+static void genProvable (mpz_t p, const size_t nbits, PRNG& generator, bool init_mpz,
+			 String* certificate, bool topTwoBits) {
+  size_t* sizes;
+  size_t maxSteps;
+  unsigned int nSteps = 0;
+
+  if (nbits < 2)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Taille de premier trop petite");
+  if (init_mpz)
+    mpz_init (p);
+
+  // Tailles des premiers de la chaîne, du plus grand au plus petit.
+  // Tant que k >= (k+1)/2 + 1 + PROVABLE_PRIME_MIN_R_BITS, la taille
+  // diminue d'au moins PROVABLE_PRIME_MIN_R_BITS bits par étape ; au-delà
+  // (k < 42), une seule étape ramène sous PROVABLE_PRIME_LEAF_BITS.
+  maxSteps = nbits / PROVABLE_PRIME_MIN_R_BITS + 2;
+  sizes = new size_t[maxSteps + 1];
+  sizes[0] = nbits;
+  while (sizes[nSteps] > PROVABLE_PRIME_LEAF_BITS) {
+    if (nSteps == maxSteps) {
+      delete[] sizes;
+      throw CryptoInternalMayhem ("Chaîne de premiers prouvés trop longue");
+    }
+    sizes[nSteps + 1] = provableFactorSize (sizes[nSteps], generator);
+    nSteps++;
+  }
+
+  mpz_t* R = new mpz_t[nSteps + 1];
+  unsigned long* a = new unsigned long[nSteps + 1];
+  mpz_t q;
+
+  mpz_init (q);
+  for (unsigned int i = 0; i <= nSteps; i++)
+    mpz_init (R[i]);
+
+  genSmallPrime (p, sizes[nSteps], generator, topTwoBits && nSteps == 0);
+  if (certificate != NULL)
+    *certificate = ASN1_INTEGER (p).toDER ();
+
+  for (unsigned int i = nSteps; i-- > 0; ) {
+    mpz_swap (p, q);
+    genProvableStep (p, R[i], &a[i], q, sizes[i], generator, topTwoBits && i == 0);
+    if (certificate != NULL) {
+      mpz_set_ui (q, a[i]);
+      *certificate += encapsulate (ASN1_INTEGER (R[i]).toDER () + ASN1_INTEGER (q).toDER (), T_SEQU);
+    }
+  }
+  if (certificate != NULL)
+    *certificate = encapsulate (*certificate, T_SEQU);
+
+  for (unsigned int i = 0; i <= nSteps; i++)
+    mpz_shred (R[i]);
+  delete[] R;
+  delete[] a;
+  delete[] sizes;
+  mpz_shred (q);
+}
+
+
+void genProvablePrime (mpz_t p, const size_t nbits, PRNG& generator, bool init_mpz,
+		       String* certificate) {
+  genProvable (p, nbits, generator, init_mpz, certificate, false);
+}
+
+
+void findRSAFactorProvable (mpz_t factor, const size_t nbits, PRNG& generator, bool init_mpz,
+			    String* certificate) {
+  genProvable (factor, nbits, generator, init_mpz, certificate, true);
+}
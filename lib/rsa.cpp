@@ -14,31 +14,279 @@ using namespace ANSSIPKI_ASN1;
 
 
 #include "string.h"
+#include <new>
+#include <pthread.h>
+#include <unistd.h>
 
-/* Taille du tableau servant à cribler le module RSA pour le test de
-   friabilité (auto-test) */
-static const int trivialSieve_size = 100000;
+/* Borne des premiers cherchés dans le module RSA par le test de
+   friabilité (auto-test, voir isSmoothTrivial) */
+static const unsigned long trivialSieve_size = 1UL << 19;
 
 /* Nombre de vérifications chiffrement / déchiffrement réalisées avec
    la clé tout juste générées à des fins d'auto-test */
 static const int nEncryptionDecryptionVerif = 10;
 
+/* État de l'auto-test d'une clé (RSAKey::_selfTestState) : seules
+   les clés de niveau RSA_SELF_TEST_DEFERRED passent par l'état
+   SELF_TEST_PENDING, jusqu'à leur première opération privée. */
+#define SELF_TEST_DONE    0
+#define SELF_TEST_PENDING 1
+#define SELF_TEST_FAILED  2
+
+/* Taille maximale (en bits) de l'exposant public pour laquelle le
+   résultat des opérations privées CRT est systématiquement vérifié
+   par une exponentiation publique (contre-mesure aux attaques par
+   faute de type Bellcore). Au-delà, la vérification coûterait autant
+   que l'exponentiation complète que le CRT permet d'éviter. */
+static const size_t faultCheckMaxEBits = 64;
+
+
+/* Nombre de tirages d'un facteur r_i (i >= 3) d'un module
+   multi-premiers au-delà duquel la recherche reprend avec une
+   nouvelle paire p, q : le produit des facteurs précédents peut être
+   trop proche de sa borne basse pour que le module ait la taille
+   voulue. */
+static const int multiPrimeMaxTries = 64;
+
+
+/* Espace de travail des opérations privées. Les entiers GMP et le
+   tampon d'encodage sont dimensionnés une fois pour toutes d'après la
+   taille du module, puis effacés sans être libérés après chaque
+   opération. Chaque fil d'exécution dispose de son propre espace
+   (voir threadWorkspace). */
+class RSAWorkspace {
+ public:
+  RSAWorkspace ();
+  ~RSAWorkspace ();
+
+  /* Dimensionnement pour un module de modulusBits bits */
+  void reserve (size_t modulusBits);
+
+  /* Effacement des intermédiaires de calcul (m1, m2, h, x, y) */
+  void wipeTemporaries ();
+
+  /* Effacement de l'ensemble de l'espace de travail */
+  void wipe ();
+
+  mpz_t msg, sig;
+  mpz_t m1, m2, h, x, y;
+  unsigned char* em;
+  size_t emLen;
+  size_t nBits;
+
+ private:
+  RSAWorkspace (const RSAWorkspace&);
+  RSAWorkspace operator= (const RSAWorkspace&);
+};
+
+
+RSAWorkspace::RSAWorkspace () : em (NULL), emLen (0), nBits (0) {
+  mpz_init (msg);
+  mpz_init (sig);
+  mpz_init (m1);
+  mpz_init (m2);
+  mpz_init (h);
+  mpz_init (x);
+  mpz_init (y);
+}
+
+
+RSAWorkspace::~RSAWorkspace () {
+  mpz_shred (msg);
+  mpz_shred (sig);
+  mpz_shred (m1);
+  mpz_shred (m2);
+  mpz_shred (h);
+  mpz_shred (x);
+  mpz_shred (y);
+  if (em != NULL) {
+    shred ((char*) em, emLen);
+    delete[] em;
+  }
+}
+
+
+void RSAWorkspace::reserve (size_t modulusBits) {
+  if (modulusBits <= nBits)
+    return;
+
+  // Le plus grand intermédiaire est le produit qInv (m1 - m2) de la
+  // recombinaison de Garner, qui ne dépasse pas 2 x modulusBits bits
+  mp_bitcnt_t bits = 2 * modulusBits + 2 * GMP_NUMB_BITS;
+  mpz_realloc2 (msg, bits);
+  mpz_realloc2 (sig, bits);
+  mpz_realloc2 (m1, bits);
+  mpz_realloc2 (m2, bits);
+  mpz_realloc2 (h, bits);
+  mpz_realloc2 (x, bits);
+  mpz_realloc2 (y, bits);
+
+  if (em != NULL) {
+    shred ((char*) em, emLen);
+    delete[] em;
+    em = NULL;
+  }
+  emLen = (modulusBits + 7) / 8;
+  em = new unsigned char[emLen];
+  nBits = modulusBits;
+}
+
+
+void RSAWorkspace::wipeTemporaries () {
+  mpz_wipe (m1);
+  mpz_wipe (m2);
+  mpz_wipe (h);
+  mpz_wipe (x);
+  mpz_wipe (y);
+}
+
+
+void RSAWorkspace::wipe () {
+  wipeTemporaries ();
+  mpz_wipe (msg);
+  mpz_wipe (sig);
+  shred ((char*) em, emLen);
+}
+
+
+static pthread_key_t workspaceKey;
+static pthread_once_t workspaceKeyOnce = PTHREAD_ONCE_INIT;
+static bool workspaceKeyOK = false;
+
+static void deleteWorkspace (void* ws) {
+  delete (RSAWorkspace*) ws;
+}
+
+static void createWorkspaceKey () {
+  workspaceKeyOK = (pthread_key_create (&workspaceKey, deleteWorkspace) == 0);
+}
+
+
+/* Espace de travail du fil d'exécution appelant, créé au premier appel
+   (et libéré à la fin du fil), dimensionné pour le module n */
+static RSAWorkspace& threadWorkspace (const mpz_t n) {
+  pthread_once (&workspaceKeyOnce, createWorkspaceKey);
+  if (!workspaceKeyOK)
+    throw UnexpectedError ("Impossible de créer la clé de l'espace de travail RSA");
+
+  RSAWorkspace* ws = (RSAWorkspace*) pthread_getspecific (workspaceKey);
+  if (ws == NULL) {
+    ws = new RSAWorkspace ();
+    if (pthread_setspecific (workspaceKey, ws) != 0) {
+      delete ws;
+      throw UnexpectedError ("Impossible d'associer l'espace de travail RSA au fil d'exécution");
+    }
+  }
+
+  ws->reserve (mpz_sizeinbase (n, 2));
+  return *ws;
+}
 
 
 
 
-RSAKey::RSAKey (PRNG& prng, const size_t nBits, bool useF4) {
+
+unsigned int rsaMaxPrimes (const size_t nBits) {
+  if (nBits < 1024)
+    return 2;
+  if (nBits < 4096)
+    return 3;
+  return RSA_MAX_PRIMES;
+}
+
+
+/* Vrai si | a - b | > diffMin */
+static bool farEnough (const mpz_t a, const mpz_t b, const mpz_t diffMin) {
+  mpz_t diff;
+  bool res;
+
+  mpz_init (diff);
+  mpz_sub (diff, a, b);
+  mpz_abs (diff, diff);
+  res = (mpz_cmp (diff, diffMin) > 0);
+  mpz_shred (diff);
+  return res;
+}
+
+
+/* Recherche des facteurs d'un module de nBits bits : p et q par
+   findRSAFactorPair, puis, pour nPrimes > 2, r[0 .. nPrimes-3] par
+   genRSAFactor (p, q et les r_i devant être initialisés). Chaque
+   facteur fait nBits / nPrimes bits, les bits restants étant répartis
+   de sorte que p et q aient la même taille. Un r_i est retiré tant
+   que le produit des facteurs obtenus n'a pas exactement la somme de
+   leurs tailles, ou qu'il est à moins de diffMin d'un facteur
+   précédent. */
+static void findRSAFactors (mpz_t p, mpz_t q, mpz_t r[], const unsigned int nPrimes,
+			    const size_t nBits, PRNG& prng, const mpz_t diffMin,
+			    unsigned int nThreads, rsa_prime_strategy_t strategy) {
+  size_t sizes[RSA_MAX_PRIMES];
+  size_t rem = nBits % nPrimes, total;
+  unsigned int i, j;
+  mpz_t prod, t;
+  bool ok = false;
+
+  if (nPrimes == 2) {
+    findRSAFactorPair (p, q, nBits / 2, prng, diffMin, nThreads,
+		       RSA_FACTOR_SEARCH_RANDOM, NULL, strategy);
+    return;
+  }
+
+  // Un seul bit restant va au dernier facteur, sinon aux premiers
+  for (i = 0; i < nPrimes; i++)
+    sizes[i] = nBits / nPrimes;
+  if (rem == 1)
+    sizes[nPrimes - 1]++;
+  else
+    for (i = 0; i < rem; i++)
+      sizes[i]++;
+
+  mpz_init (prod);
+  mpz_init (t);
+  while (!ok) {
+    findRSAFactorPair (p, q, sizes[0], prng, diffMin, nThreads,
+		       RSA_FACTOR_SEARCH_RANDOM, NULL, strategy);
+    mpz_mul (prod, p, q);
+    total = 2 * sizes[0];
+
+    ok = true;
+    for (i = 2; ok && i < nPrimes; i++) {
+      total += sizes[i];
+      ok = false;
+      for (int tries = 0; !ok && tries < multiPrimeMaxTries; tries++) {
+	genRSAFactor (r[i - 2], sizes[i], prng, strategy, threadPrimeContext ());
+	mpz_mul (t, prod, r[i - 2]);
+	ok = (mpz_sizeinbase (t, 2) == total &&
+	      farEnough (r[i - 2], p, diffMin) && farEnough (r[i - 2], q, diffMin));
+	for (j = 0; ok && j + 2 < i; j++)
+	  ok = farEnough (r[i - 2], r[j], diffMin);
+      }
+      mpz_swap (prod, t);
+    }
+  }
+  mpz_shred (prod);
+  mpz_shred (t);
+}
+
+
+RSAKey::RSAKey (PRNG& prng, const size_t nBits, bool useF4, unsigned int nThreads,
+		rsa_prime_strategy_t strategy, rsa_self_test_t selfTest,
+		unsigned int nPrimes) {
   _initialized = false;
+  pthread_mutex_init (&_selfTestLock, NULL);
   // TODO: This line does not compile anymore. However, it seems this
   // constructor either throws an exception, or fills the fields with
   // real values
   //  _n = _d = _p = _q = _e = NULL;
 
+  if (nPrimes < 2 || nPrimes > rsaMaxPrimes (nBits))
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Nombre de facteurs premiers invalide pour cette taille de module");
+
   initPrimes (prng);
 
-  mpz_t p, q;
+  mpz_t p, q, r[RSA_MAX_PRIMES - 2];
   mpz_t n, e, d;
-  mpz_t diff, diff_min;
+  mpz_t diff_min;
   mpz_t p_minus_1, q_minus_1, phi;  
   mpz_t min_d_size_with_F4, min_exp_size_when_not_F4;
 
@@ -47,10 +295,11 @@ RSAKey::RSAKey (PRNG& prng, const size_t nBits, bool useF4) {
   mpz_init (d);
   mpz_init (p);
   mpz_init (q);
+  for (unsigned int i = 0; i < RSA_MAX_PRIMES - 2; i++)
+    mpz_init (r[i]);
   mpz_init (p_minus_1);
   mpz_init (q_minus_1);
   mpz_init (phi);
-  mpz_init (diff);
   mpz_init (diff_min);
   mpz_init (min_d_size_with_F4);
   mpz_init (min_exp_size_when_not_F4);
@@ -59,7 +308,9 @@ RSAKey::RSAKey (PRNG& prng, const size_t nBits, bool useF4) {
   // pas trop proches l'un de l'autre. En effet, certaines attaques
   // reposent sur une trop grande proximité entre p et q.
   // | p - q | doit être supérieur à 2 ^ ((nBits/2) - 20)
-  mpz_ui_pow_ui (diff_min, 2, (nBits / 2) - 20);
+  // (2 ^ ((nBits/nPrimes) - 20) entre deux facteurs d'un module
+  // multi-premiers)
+  mpz_ui_pow_ui (diff_min, 2, (nBits / nPrimes) - 20);
 
   // TODO: Pourquoi cette borne est inférieure à la suivante ?
   // TODO: Regrouper les deux bornes en une seule ?
@@ -80,24 +331,30 @@ RSAKey::RSAKey (PRNG& prng, const size_t nBits, bool useF4) {
 
   while (true) {
 
-    do {
-      findRSAFactor (p, nBits / 2, prng, false);
-      findRSAFactor (q, nBits / 2, prng, false);
+    // p et q sont cherchés en parallèle (nThreads fils d'exécution)
+    findRSAFactors (p, q, r, nPrimes, nBits, prng, diff_min, nThreads, strategy);
 
-      mpz_sub (diff, p, q);
-      mpz_abs (diff, diff);
-    } while (mpz_cmp(diff, diff_min) <= 0);
-    
     mpz_mul (n, p, q);
 
     mpz_sub_ui (p_minus_1, p, 1);
     mpz_sub_ui (q_minus_1, q, 1);
     mpz_mul (phi, p_minus_1, q_minus_1);
 
+    for (unsigned int i = 0; i + 2 < nPrimes; i++) {
+      mpz_mul (n, n, r[i]);
+      mpz_sub_ui (p_minus_1, r[i], 1);
+      mpz_mul (phi, phi, p_minus_1);
+    }
+
     if (useF4) {
       mpz_set_ui (e, 65537);
-      if (mpz_invert (d, e, phi) == 0)
-	throw CryptoInternalMayhem ("65537 et phi non premiers entre eux");
+      if (mpz_invert (d, e, phi) == 0) {
+	// Impossible pour des premiers sûrs ; sinon, 65537 divise p-1
+	// ou q-1 (ou r_i - 1) et les facteurs sont rejetés
+	if (rsaPrimeStrategyIsSafe (strategy))
+	  throw CryptoInternalMayhem ("65537 et phi non premiers entre eux");
+	continue;
+      }
 
       // Si d est trop petit, on regénère un module RSA
       // Cet événement est fort peu probable
@@ -130,11 +387,22 @@ RSAKey::RSAKey (PRNG& prng, const size_t nBits, bool useF4) {
   mpz_init_set (_p, p);
   mpz_init_set (_q, q);
   mpz_init_set (_e, e);
+  initOtherPrimes ();
+  _nPrimes = nPrimes;
+  for (unsigned int i = 0; i + 2 < nPrimes; i++)
+    mpz_set (_r[i], r[i]);
+
+  // Précalcul des paramètres CRT
+  mpz_init (_dP);
+  mpz_init (_dQ);
+  mpz_init (_qInv);
+  updateCRT ();
 
   // Vérifications sur la clé publique et création de l'objet _pubkey
   mpz_t seed;
+  mpz_init (_selfTestSeed);
   prng.getRandomInt (seed, GMP_RANDOM_SEED_SIZE, true);
-  checkKey (nBits, seed);
+  checkKey (nBits, seed, selfTest);
   mpz_shred (seed);
 
   // Tout s'est bien passé, il ne reste plus qu'à détruire tous ces
@@ -146,18 +414,21 @@ RSAKey::RSAKey (PRNG& prng, const size_t nBits, bool useF4) {
   mpz_shred (d);
   mpz_shred (p);
   mpz_shred (q);
+  for (unsigned int i = 0; i < RSA_MAX_PRIMES - 2; i++)
+    mpz_shred (r[i]);
   mpz_shred (p_minus_1);
   mpz_shred (q_minus_1);
   mpz_shred (phi);
-  mpz_shred (diff);
   mpz_shred (diff_min);
   mpz_shred (min_d_size_with_F4);
   mpz_shred (min_exp_size_when_not_F4);
 }
 
 
-RSAKey::RSAKey (PRNG& prng, mpz_t n, mpz_t d, mpz_t e, mpz_t p, mpz_t q) {
+RSAKey::RSAKey (PRNG& prng, mpz_t n, mpz_t d, mpz_t e, mpz_t p, mpz_t q,
+		rsa_self_test_t selfTest) {
   _initialized = false;
+  pthread_mutex_init (&_selfTestLock, NULL);
 
   mpz_init_set (_n, n);
   mpz_init_set (_d, d);
@@ -169,11 +440,18 @@ RSAKey::RSAKey (PRNG& prng, mpz_t n, mpz_t d, mpz_t e, mpz_t p, mpz_t q) {
   mpz_shred (e);
   mpz_shred (p);
   mpz_shred (q);
+  initOtherPrimes ();
+
+  mpz_init (_dP);
+  mpz_init (_dQ);
+  mpz_init (_qInv);
+  updateCRT ();
 
   // Vérifications sur la clé publique et création de l'objet _pubkey
   mpz_t seed;
+  mpz_init (_selfTestSeed);
   prng.getRandomInt (seed, GMP_RANDOM_SEED_SIZE, true);
-  checkKey (mpz_sizeinbase(_n, 2), seed);
+  checkKey (mpz_sizeinbase(_n, 2), seed, selfTest);
   mpz_shred (seed);
 
   _initialized = true;
@@ -187,8 +465,66 @@ static inline void getNextInt (const String& DERString, mpz_t i) {
 }
 
 
-RSAKey::RSAKey (PRNG& prng, const String& DERString) {
+/* Lecture des facteurs r_i du champ otherPrimeInfos d'une clé
+   multi-premiers, qui suit les paramètres CRT de p et q. Comme l'exige
+   PKCS#1 v2.x, version vaut 1 si et seulement si ce champ est présent.
+   Les paramètres CRT (d_i, t_i) des r_i sont lus et bornés par r_i,
+   mais ignorés, de même que ceux de p et q. r doit être initialisé ;
+   retourne le nombre de facteurs lus (0 pour une clé à deux
+   facteurs). */
+static unsigned int getOtherPrimes (const String& content,
+				    const ANSSIPKI_ASN1::ASN1_BASIC& version, mpz_t r[]) {
+  unsigned int k = 0;
+  mpz_t v, x, dR, tR;
+  bool ok, multiPrime;
+
+  if (version.tagNumber != T_INTG)
+    throw ANSSIPKIException (E_DER_INVALID_FILE, "Version de la clé RSA invalide");
+  mpz_init_set_str (v, version.value.toAsciiHexa (0).toChar (), 16);
+  multiPrime = (mpz_cmp_ui (v, 1) == 0);
+  ok = multiPrime || mpz_sgn (v) == 0;
+  mpz_clear (v);
+  if (!ok)
+    throw ANSSIPKIException (E_DER_INVALID_FILE, "Version de la clé RSA invalide");
+
+  if (!content.eof ()) {
+    ANSSIPKI_ASN1::ASN1_BASIC dP (content);
+    ANSSIPKI_ASN1::ASN1_BASIC dQ (content);
+    ANSSIPKI_ASN1::ASN1_BASIC qInv (content);
+  }
+  // Version 0 (deux facteurs) ou 1 (otherPrimeInfos présent)
+  if (content.eof () == multiPrime)
+    throw ANSSIPKIException (E_DER_INVALID_FILE, "Version de la clé RSA incohérente avec otherPrimeInfos");
+  if (content.eof ())
+    return 0;
+
+  String others (decapsulate (content, T_SEQU));
+  while (!others.eof ()) {
+    if (k == RSA_MAX_PRIMES - 2)
+      throw ANSSIPKIException (E_DER_INVALID_FILE, "Trop de facteurs premiers dans la clé RSA");
+    String info (decapsulate (others, T_SEQU));
+    getNextInt (info, x);
+    getNextInt (info, dR);
+    getNextInt (info, tR);
+    ok = info.eof () && mpz_cmp_ui (x, 1) > 0 &&
+      mpz_sgn (dR) >= 0 && mpz_cmp (dR, x) < 0 &&
+      mpz_sgn (tR) >= 0 && mpz_cmp (tR, x) < 0;
+    mpz_swap (r[k++], x);
+    mpz_shred (x);
+    mpz_shred (dR);
+    mpz_shred (tR);
+    if (!ok)
+      throw ANSSIPKIException (E_DER_INVALID_FILE, "Champ OtherPrimeInfo invalide");
+  }
+  if (k == 0)
+    throw ANSSIPKIException (E_DER_INVALID_FILE, "Champ otherPrimeInfos vide");
+  return k;
+}
+
+
+RSAKey::RSAKey (PRNG& prng, const String& DERString, rsa_self_test_t selfTest) {
   _initialized = false;
+  pthread_mutex_init (&_selfTestLock, NULL);
 
   String content (decapsulate (DERString, T_SEQU));
 
@@ -198,11 +534,21 @@ RSAKey::RSAKey (PRNG& prng, const String& DERString) {
   getNextInt (content, _d);
   getNextInt (content, _p);
   getNextInt (content, _q);
+  initOtherPrimes ();
+  _nPrimes = 2 + getOtherPrimes (content, version, _r);
+
+  // Les paramètres CRT présents dans l'encodage sont ignorés et
+  // recalculés à partir de p, q, des r_i et de d
+  mpz_init (_dP);
+  mpz_init (_dQ);
+  mpz_init (_qInv);
+  updateCRT ();
 
   // Vérifications sur la clé publique et création de l'objet _pubkey
   mpz_t seed;
+  mpz_init (_selfTestSeed);
   prng.getRandomInt (seed, GMP_RANDOM_SEED_SIZE, true);
-  checkKey (mpz_sizeinbase(_n, 2), seed);
+  checkKey (mpz_sizeinbase(_n, 2), seed, selfTest);
   mpz_shred (seed);
 
   _initialized = true;
@@ -213,11 +559,20 @@ RSAKey::RSAKey (PRNG& prng, const String& DERString) {
 RSAKey::RSAKey () 
 {
   _initialized = false;
+  pthread_mutex_init (&_selfTestLock, NULL);
   mpz_init (_n);
   mpz_init (_d);
   mpz_init (_e);
   mpz_init (_p);
   mpz_init (_q);
+  _crt = false;
+  mpz_init (_dP);
+  mpz_init (_dQ);
+  mpz_init (_qInv);
+  _selfTest = RSA_SELF_TEST_NONE;
+  _selfTestState = SELF_TEST_DONE;
+  mpz_init (_selfTestSeed);
+  initOtherPrimes ();
 }
 
 
@@ -225,16 +580,172 @@ void RSAKey::forgetKey () {
   mpz_shred (_n);
   mpz_shred (_d);
   mpz_shred (_e);
+  mpz_shred (_p);
+  mpz_shred (_q);
+  // L'objet est laissé dans l'état d'une clé construite vide : les
+  // accesseurs setX (qui recalculent les paramètres CRT) et
+  // setFromASN1PrivateKey peuvent être appelés ensuite
+  mpz_init (_n);
+  mpz_init (_d);
+  mpz_init (_e);
+  mpz_init (_p);
+  mpz_init (_q);
+  mpz_wipe (_dP);
+  mpz_wipe (_dQ);
+  mpz_wipe (_qInv);
+  for (unsigned int i = 0; i < RSA_MAX_PRIMES - 2; i++) {
+    mpz_wipe (_r[i]);
+    mpz_wipe (_dR[i]);
+    mpz_wipe (_tR[i]);
+  }
+  _nPrimes = 2;
+  _crt = false;
+  mpz_wipe (_selfTestSeed);
+  _selfTest = RSA_SELF_TEST_NONE;
+  _selfTestState = SELF_TEST_DONE;
   _initialized = false;
 }
 
 
 RSAKey::~RSAKey () {
   forgetKey ();
+  mpz_clear (_n);
+  mpz_clear (_d);
+  mpz_clear (_e);
+  mpz_clear (_p);
+  mpz_clear (_q);
+  mpz_clear (_dP);
+  mpz_clear (_dQ);
+  mpz_clear (_qInv);
+  for (unsigned int i = 0; i < RSA_MAX_PRIMES - 2; i++) {
+    mpz_clear (_r[i]);
+    mpz_clear (_dR[i]);
+    mpz_clear (_tR[i]);
+  }
+  mpz_clear (_selfTestSeed);
+  pthread_mutex_destroy (&_selfTestLock);
+}
+
+
+
+
+
+void RSAKey::initOtherPrimes () {
+  _nPrimes = 2;
+  for (unsigned int i = 0; i < RSA_MAX_PRIMES - 2; i++) {
+    mpz_init (_r[i]);
+    mpz_init (_dR[i]);
+    mpz_init (_tR[i]);
+  }
+}
+
+
+void RSAKey::updateCRT () {
+  mpz_t p_minus_1, q_minus_1, pq;
+  unsigned int i;
+
+  _crt = false;
+
+  if (mpz_cmp_ui (_p, 1) <= 0 || mpz_cmp_ui (_q, 1) <= 0 || mpz_sgn (_d) <= 0)
+    return;
+  for (i = 0; i + 2 < _nPrimes; i++)
+    if (mpz_cmp_ui (_r[i], 1) <= 0)
+      return;
+
+  mpz_init (p_minus_1);
+  mpz_init (q_minus_1);
+  mpz_init (pq);
+  mpz_sub_ui (p_minus_1, _p, 1);
+  mpz_sub_ui (q_minus_1, _q, 1);
+  mpz_mul (pq, _p, _q);
+  for (i = 0; i + 2 < _nPrimes; i++)
+    mpz_mul (pq, pq, _r[i]);
+
+  // Le CRT n'a de sens que si n = pq (r_3 ... r_nPrimes) (les
+  // accesseurs setX peuvent être appelés dans n'importe quel ordre)
+  if (mpz_cmp (pq, _n) == 0 &&
+      mpz_invert (_qInv, _q, _p) != 0) {
+    mpz_mod (_dP, _d, p_minus_1);
+    mpz_mod (_dQ, _d, q_minus_1);
+    _crt = true;
+
+    // Coefficients des facteurs suivants : t_i = (p q ... r_(i-1))^-1
+    // mod r_i, pq servant de produit partiel
+    mpz_mul (pq, _p, _q);
+    for (i = 0; _crt && i + 2 < _nPrimes; i++) {
+      mpz_sub_ui (p_minus_1, _r[i], 1);
+      mpz_mod (_dR[i], _d, p_minus_1);
+      _crt = (mpz_invert (_tR[i], pq, _r[i]) != 0);
+      mpz_mul (pq, pq, _r[i]);
+    }
+  }
+
+  mpz_shred (p_minus_1);
+  mpz_shred (q_minus_1);
+  mpz_shred (pq);
 }
 
 
+void RSAKey::crtExponentiation (mpz_t res, const mpz_t m, RSAWorkspace& ws) const {
+  // m1 = m ^ dP mod p et m2 = m ^ dQ mod q
+  mpz_powm (ws.m1, m, _dP, _p);
+  mpz_powm (ws.m2, m, _dQ, _q);
+
+  // Recombinaison de Garner : h = qInv (m1 - m2) mod p et res = m2 + h q
+  mpz_sub (ws.h, ws.m1, ws.m2);
+  mpz_mul (ws.h, ws.h, _qInv);
+  mpz_mod (ws.h, ws.h, _p);
+  mpz_mul (res, ws.h, _q);
+  mpz_add (res, res, ws.m2);
+
+  // Facteurs suivants (PKCS#1 v2.x) : avec R = p q ... r_(i-1),
+  // m_i = m ^ d_i mod r_i, h = t_i (m_i - res) mod r_i et res += h R
+  if (_nPrimes > 2) {
+    mpz_mul (ws.m2, _p, _q);
+    for (unsigned int i = 0; i + 2 < _nPrimes; i++) {
+      mpz_powm (ws.m1, m, _dR[i], _r[i]);
+      mpz_sub (ws.h, ws.m1, res);
+      mpz_mul (ws.h, ws.h, _tR[i]);
+      mpz_mod (ws.h, ws.h, _r[i]);
+      mpz_mul (ws.x, ws.h, ws.m2);
+      mpz_add (res, res, ws.x);
+      mpz_mul (ws.m2, ws.m2, _r[i]);
+    }
+  }
+}
+
+
+bool RSAKey::privateOperation (mpz_t res, const mpz_t m, RSAWorkspace& ws) const {
+  bool ok = true;
+
+  if (!_crt) {
+    mpz_powm (res, m, _d, _n);
+    return true;
+  }
+
+  crtExponentiation (res, m, ws);
+
+  // Une faute sur l'une des deux demi-exponentiations permettrait de
+  // factoriser n à partir du résultat : on vérifie donc que
+  // res ^ e = m mod n avant de le rendre.
+  if (mpz_sizeinbase (_e, 2) <= faultCheckMaxEBits) {
+    publicOperation (ws.x, res);
+    mpz_mod (ws.y, m, _n);
+    ok = (mpz_cmp (ws.x, ws.y) == 0);
+  }
+
+  ws.wipeTemporaries ();
 
+  if (!ok)
+    mpz_set_ui (res, 0);
+
+  return ok;
+}
+
+
+void RSAKey::publicOperation (mpz_t res, const mpz_t m) const {
+  mpz_powm (res, m, _e, _n);
+}
 
 
 bool RSAKey::verify (const mpz_t msg, const mpz_t sig) const {
@@ -242,7 +753,7 @@ bool RSAKey::verify (const mpz_t msg, const mpz_t sig) const {
   bool res;
 
   mpz_init (x);
-  mpz_powm (x, sig, _e, _n);
+  publicOperation (x, sig);
   res = (mpz_cmp (msg, x) == 0);
   mpz_shred (x);
   return res;
@@ -251,127 +762,312 @@ bool RSAKey::verify (const mpz_t msg, const mpz_t sig) const {
 
 const String RSAKey::sign (const TBS& tbs) const {
   char hash[64];
-  size_t hashlen = 0;
+  ANSSIPKI_HASH::hash_function_t hashFunc = ANSSIPKI_HASH::invalid;
   hash_algo ha = hash_algo (tbs.get_sign_algo());
   String tbsString = tbs.toDER();
 
   switch (ha) {
   case H_ALGO_SHA1:
     sha1 (tbsString.toChar(), tbsString.size(), hash);
-    hashlen = 20;
+    hashFunc = ANSSIPKI_HASH::sha1;
     break;
 
   case H_ALGO_SHA256:
     sha256 (tbsString.toChar(), tbsString.size(), hash);
-    hashlen = 32;
+    hashFunc = ANSSIPKI_HASH::sha256;
     break;
 
   case H_ALGO_SHA512:
     sha512 (tbsString.toChar(), tbsString.size(), hash);
-    hashlen = 64;
+    hashFunc = ANSSIPKI_HASH::sha512;
     break;
 
   default:
     throw NotImplemented ("Fonction de hachage inconnue");
   }
 
-  /*
-    SEQUENCE
-    | SEQUENCE
-    | | OBJECT IDENTIFIER hash algorithm
-    | | NULL
-    | OCTET STRING condensat calculé sur le bloc de données
-  */
-  String blockToSign = encapsulate  (encapsulate (ASN1_HASH_ALGO(ha).toDER(), T_SEQU) +
-				     ANSSIPKI_ASN1::ASN1_BASIC(C_UNIV, M_PRIM, T_OSTR, String (hash, hashlen)).toDER(), T_SEQU);
-
-  uint modulusSize = (uint)((mpz_sizeinbase (_n, 16) + 1) / 2);
-  
-  // PKCS#1 indique que la taille du bourrage doit être au moins de 8
-  // octets (auquels on ajoute les 0x00 0x01 correspondant au bloc de
-  // type 1 et le 0x00 terminant le bourrage)
-  if (blockToSign.size() + 11 > modulusSize)
+  uint modulusSize = (uint)((mpz_sizeinbase (_n, 2) + 7) / 8);
+  unsigned char* sig = new unsigned char[modulusSize];
+  size_t sigLen = modulusSize;
+  int rv = signDigest (hashFunc, (const unsigned char*) hash, sig, &sigLen);
+
+  if (rv != 0) {
+    delete[] sig;
+    if (rv == -5)
+      throw CryptoInternalMayhem ("la signature calculée est incohérente (faute détectée)");
+    if (rv == -6)
+      throw CryptoInternalMayhem ("l'auto-test différé de la clé a échoué");
     throw UnexpectedError ("Le bloc haché à signer a une taille incorrecte.");
-  
-  String tmp;
-  tmp.resize (modulusSize);
-  
-  // On bourre le tampon tmp avec le padding requis par PKCS#1 v1.5
-  tmp.pushChar ('\x00');
-  tmp.pushChar ('\x01');
-  for (uint i=2; i < (modulusSize - blockToSign.size() - 1); i++)
-    tmp.pushChar ('\xff');
-  tmp.pushChar ('\x00');
-
-  // Enfin, on recopie le bloc tbs
-  tmp.pushString (blockToSign);
+  }
 
-  // On crée le grand entier GMP correspondant au message
-  tmp.bignumToAsciiHexa ();
+  String res ((const char*) sig, sigLen);
+  delete[] sig;
 
-  mpz_t msg;
-  mpz_init_set_str(msg, tmp.toChar(), 16);
+  return tbs.appendSignatureToDER (res);
+}
 
 
-  if (mpz_cmp(msg, _n) >= 0) {
-    mpz_shred (msg);
-    throw UnexpectedError ("Le bloc haché à signer a une taille incorrecte.");
+/* Longueur du condensat produit par une fonction de hachage (0 si
+   elle est inconnue) */
+static size_t digestLength (ANSSIPKI_HASH::hash_function_t hashFunc) {
+  switch (hashFunc) {
+  case ANSSIPKI_HASH::sha1:
+    return 20;
+  case ANSSIPKI_HASH::sha256:
+    return 32;
+  case ANSSIPKI_HASH::sha384:
+    return 48;
+  case ANSSIPKI_HASH::sha512:
+    return 64;
+  default:
+    return 0;
   }
-  
-  // Enfin, on élève le message à la puissance d modulo N
-  mpz_t sig;
-  mpz_init (sig);
-  mpz_powm (sig, msg, _d, _n);
-  
-  String res_unpadded (sig, String::ENC_BINARY);
+}
 
-  String res;
-  res.resize (modulusSize);
-  for (uint i=0; i < (modulusSize - res_unpadded.size()); i++)
-    res.pushChar ('\x00');
-  res.pushString (res_unpadded);
 
-  // On efface les entiers GMP utilisés
-  mpz_shred (sig);
-  mpz_shred (msg);
+int RSAKey::signDigest (ANSSIPKI_HASH::hash_function_t hashFunc, const unsigned char *digest,
+			unsigned char *out, size_t *outLen) const
+{
+  size_t digestLen = digestLength (hashFunc);
+  size_t dihLen = 0;
+  size_t modulusSize, sigSize, count = 0;
+  int rv = 0;
 
-  return tbs.appendSignatureToDER (res);
+  if (!digest || !out || !outLen)
+    return -1;
+
+  if (digestLen == 0 ||
+      ANSSIPKI_HASH::copyDigestInfoHeader (NULL, &dihLen, hashFunc) != 1)
+    return -2;
+
+  modulusSize = (mpz_sizeinbase (_n, 2) + 7) / 8;
+  if (*outLen < modulusSize)
+    {
+      *outLen = modulusSize;
+      return -3;
+    }
+
+  // PKCS#1 impose au moins 8 octets de bourrage, auxquels s'ajoutent
+  // les octets 0x00 0x01 de tête et le 0x00 terminant le bourrage
+  if (modulusSize < dihLen + digestLen + 11)
+    return -4;
+
+  if (!runDeferredSelfTest ())
+    return -6;
+
+  RSAWorkspace& ws = threadWorkspace (_n);
+
+  // EM = 0x00 | 0x01 | PS | 0x00 | DigestInfo, importé directement
+  // dans les limbes de msg
+  if (pkcs1_v1_5_encode (ws.em, modulusSize, digest, digestLen, hashFunc) != 0)
+    rv = -2;
+  else
+    {
+      mpz_import (ws.msg, modulusSize, 1, sizeof (unsigned char), 0, 0, ws.em);
+
+      if (mpz_cmp (ws.msg, _n) >= 0)
+	rv = -4;
+      else if (!privateOperation (ws.sig, ws.msg, ws))
+	rv = -5;
+      else
+	{
+	  // Signature de la taille du module, complétée à gauche par des 0
+	  sigSize = (mpz_sizeinbase (ws.sig, 2) + 7) / 8;
+	  memset (out, 0, modulusSize);
+	  mpz_export (out + modulusSize - sigSize, &count, 1, sizeof (unsigned char), 0, 0, ws.sig);
+	  *outLen = modulusSize;
+	}
+    }
+
+  ws.wipe ();
+  return rv;
 }
 
 
+/* Contexte partagé par les fils d'exécution de signBatch */
+typedef struct {
+  const RSAKey* key;
+  const TBS* const* tbs;
+  RSABatchSignResult* results;
+  size_t count;
+  size_t next;        /* Prochain bloc à traiter (accès atomique) */
+  int outOfMemory;    /* Positionné si un fil a rencontré std::bad_alloc */
+} batchSignContext;
+
+
+// Chaque fil prend le prochain bloc non traité jusqu'à épuisement du
+// lot. Les résultats sont rangés à l'indice du bloc, ce qui préserve
+// l'ordre de l'entrée quel que soit l'ordonnancement.
+static void* batchSignWorker (void* arg) {
+  batchSignContext* ctx = (batchSignContext*) arg;
+  size_t i;
+
+  while (!ctx->outOfMemory &&
+	 (i = __sync_fetch_and_add (&ctx->next, 1)) < ctx->count) {
+    RSABatchSignResult& res = ctx->results[i];
+    res.ok = false;
+
+    try {
+      if (ctx->tbs[i] == NULL)
+	throw UnexpectedError ("Pointeur non nul attendu");
+      res.signedDER = ctx->key->sign (*(ctx->tbs[i]));
+      res.ok = true;
+    } catch (ANSSIPKIException& e) {
+      res.errNo = e.errNo ();
+      res.details = e.details ();
+    } catch (std::bad_alloc& e) {
+      // Erreur fatale (voir barak_halevi.cpp) : elle sera relancée
+      // dans le fil appelant
+      __sync_fetch_and_or (&ctx->outOfMemory, 1);
+    } catch (std::exception& e) {
+      res.errNo = E_UNKNOWN_ERROR;
+      res.details = String (e.what ());
+    }
+  }
 
+  return NULL;
+}
 
 
+void RSAKey::signBatch (const TBS* const tbs[], RSABatchSignResult results[],
+			const size_t count, unsigned int nThreads) const {
+  batchSignContext ctx;
+  pthread_t* threads;
+  unsigned int i, nStarted = 0;
 
-// Cette fonction réalise un rapide crible pour vérifier par une
-// implémentation triviale indépendante que le module n'est pas
-// friable.
-static bool isSmoothTrivial (mpz_t n) {
-  static bool pr[trivialSieve_size];
-  static bool init=false;
+  if (count == 0)
+    return;
 
-  int i, j;
+  if (tbs == NULL || results == NULL)
+    throw UnexpectedError ("Pointeur non nul attendu");
 
-  if (!init) {
-    for (i=0; i<trivialSieve_size; i++)
-      pr[i] = true;
+  if (nThreads == 0) {
+    long nCPU = sysconf (_SC_NPROCESSORS_ONLN);
+    nThreads = (nCPU > 0) ? (unsigned int) nCPU : 1;
+  }
+  if (nThreads > count)
+    nThreads = (unsigned int) count;
+
+  // Un auto-test différé mené par les fils les sérialiserait ; son
+  // échec éventuel est rapporté bloc par bloc
+  runDeferredSelfTest ();
+
+  ctx.key = this;
+  ctx.tbs = tbs;
+  ctx.results = results;
+  ctx.count = count;
+  ctx.next = 0;
+  ctx.outOfMemory = 0;
+
+  // Le fil appelant participe au travail : on ne crée que nThreads - 1
+  // fils supplémentaires. Si la création d'un fil échoue, les fils
+  // existants se répartissent simplement le reste du lot.
+  threads = new pthread_t[nThreads];
+  for (i = 1; i < nThreads; i++) {
+    if (pthread_create (&threads[nStarted], NULL, batchSignWorker, &ctx) != 0)
+      break;
+    nStarted++;
+  }
 
-    pr[0] = pr[1] = false;
+  batchSignWorker (&ctx);
 
-    for (i=2; i<trivialSieve_size; i++) {
-      if (pr[i]) {
-	for (j=2; i*j<trivialSieve_size; j++)
-	  pr[i*j] = false;
-      }
+  for (i = 0; i < nStarted; i++)
+    pthread_join (threads[i], NULL);
+  delete[] threads;
+
+  if (ctx.outOfMemory)
+    throw std::bad_alloc ();
+}
+
+
+
+
+
+
+/* Produit des premiers inférieurs à trivialSieve_size (environ 740 000
+   bits), calculé une seule fois au premier usage (voir
+   initTrivialSieve) et partagé par tous les appels. */
+static mpz_t trivialSieveProduct;
+static pthread_once_t trivialSieveOnce = PTHREAD_ONCE_INIT;
+static bool trivialSieveOK = false;
+
+// Crible d'Ératosthène, puis produit des premiers : ceux-ci sont
+// d'abord regroupés en produits tenant dans un mot machine, eux-mêmes
+// multipliés deux à deux (arbre des produits).
+static void initTrivialSieve () {
+  bool* composite = new (std::nothrow) bool[trivialSieve_size];
+  unsigned long* words = new (std::nothrow) unsigned long[trivialSieve_size / 2];
+  mpz_t* tree;
+  unsigned long w = 1;
+  unsigned int nWords = 0, m, i;
+
+  if (composite == NULL || words == NULL) {
+    delete[] composite;
+    delete[] words;
+    return;
+  }
+
+  memset (composite, 0, trivialSieve_size);
+  for (unsigned long p = 2; p < trivialSieve_size; p++) {
+    if (composite[p])
+      continue;
+    for (unsigned long k = p * p; k < trivialSieve_size; k += p)
+      composite[k] = true;
+    if (w > ~0UL / p) {
+      words[nWords++] = w;
+      w = 1;
     }
+    w *= p;
   }
+  words[nWords++] = w;
+  delete[] composite;
 
-  for(i=2; i<trivialSieve_size; i++) {
-    if (pr[i] && mpz_fdiv_ui (n, i) == 0)
-	return true;
+  tree = new (std::nothrow) mpz_t[nWords];
+  if (tree == NULL) {
+    delete[] words;
+    return;
+  }
+  for (i = 0; i < nWords; i++)
+    mpz_init_set_ui (tree[i], words[i]);
+  delete[] words;
+
+  for (m = nWords; m > 1; m = (m + 1) / 2) {
+    for (i = 0; i < m / 2; i++)
+      mpz_mul (tree[i], tree[2*i], tree[2*i + 1]);
+    if (m & 1)
+      mpz_swap (tree[m / 2], tree[m - 1]);
   }
 
-  return false;
+  mpz_init_set (trivialSieveProduct, tree[0]);
+  for (i = 0; i < nWords; i++)
+    mpz_clear (tree[i]);
+  delete[] tree;
+  trivialSieveOK = true;
+}
+
+
+// Cette fonction vérifie par une implémentation triviale indépendante
+// (sans les tables de prime.cpp) que le module n > 0 n'a pas de
+// facteur premier inférieur à trivialSieve_size : c'est le cas si et
+// seulement si pgcd (P mod n, n) = 1, P étant le produit de ces
+// premiers. Une seule réduction de P, de taille fixe, remplace une
+// division de n par premier : le coût est celui de l'ancien crible
+// par divisions jusqu'à 100 000, pour une borne cinq fois plus grande.
+static bool isSmoothTrivial (const mpz_t n) {
+  mpz_t r;
+  bool res;
+
+  pthread_once (&trivialSieveOnce, initTrivialSieve);
+  if (!trivialSieveOK)
+    throw std::bad_alloc ();
+
+  mpz_init (r);
+  mpz_tdiv_r (r, trivialSieveProduct, n);
+  mpz_gcd (r, r, n);
+  res = (mpz_cmp_ui (r, 1) != 0);
+  mpz_clear (r);
+
+  return res;
 }
 
 
@@ -412,25 +1108,34 @@ const String RSAKey::ASN1PrivateKeyInfo () const
 
 const String RSAKey::ASN1PrivateKey () const {
   mpz_t _d_mod_p_minus_1, _d_mod_q_minus_1, _invq;
+  mpz_t _d_mod_r_minus_1, _coef, _prod;
   mpz_t zero;
+  String otherPrimeInfos;
   mpz_t p_minus_1, q_minus_1;  
 
   mpz_init (_d_mod_p_minus_1);
   mpz_init (_d_mod_q_minus_1);
   mpz_init (_invq);
-  mpz_init_set_ui (zero, 0);
+  // Version 1 pour une clé multi-premiers
+  mpz_init_set_ui (zero, (_nPrimes > 2) ? 1 : 0);
 
   mpz_init (p_minus_1);
   mpz_init (q_minus_1);
   mpz_sub_ui (p_minus_1, _p, 1);
   mpz_sub_ui (q_minus_1, _q, 1);
 
-  if (mpz_invert (_d_mod_p_minus_1, _e, p_minus_1) == 0 ||
-      mpz_invert (_d_mod_q_minus_1, _e, q_minus_1) == 0)
-    throw CryptoInternalMayhem ("En fait, d est pas vraiment inversible modulo p-1 ou q-1");
-
-  if (mpz_invert (_invq, _q, _p) == 0)
-    throw CryptoInternalMayhem ("q et p-1 non premiers entre eux");
+  if (_crt) {
+    mpz_set (_d_mod_p_minus_1, _dP);
+    mpz_set (_d_mod_q_minus_1, _dQ);
+    mpz_set (_invq, _qInv);
+  } else {
+    if (mpz_invert (_d_mod_p_minus_1, _e, p_minus_1) == 0 ||
+	mpz_invert (_d_mod_q_minus_1, _e, q_minus_1) == 0)
+      throw CryptoInternalMayhem ("En fait, d est pas vraiment inversible modulo p-1 ou q-1");
+
+    if (mpz_invert (_invq, _q, _p) == 0)
+      throw CryptoInternalMayhem ("q et p-1 non premiers entre eux");
+  }
 
   ANSSIPKI_ASN1::ASN1_INTEGER version (zero);
   ANSSIPKI_ASN1::ASN1_INTEGER n (_n);
@@ -442,12 +1147,41 @@ const String RSAKey::ASN1PrivateKey () const {
   ANSSIPKI_ASN1::ASN1_INTEGER d_mod_q (_d_mod_q_minus_1);
   ANSSIPKI_ASN1::ASN1_INTEGER invq (_invq);
 
+  // otherPrimeInfos : r_i, d mod (r_i - 1) et (p q ... r_(i-1))^-1
+  // mod r_i
+  mpz_init (_d_mod_r_minus_1);
+  mpz_init (_coef);
+  mpz_init (_prod);
+  mpz_mul (_prod, _p, _q);
+  for (unsigned int i = 0; i + 2 < _nPrimes; i++) {
+    if (_crt) {
+      mpz_set (_d_mod_r_minus_1, _dR[i]);
+      mpz_set (_coef, _tR[i]);
+    } else {
+      mpz_sub_ui (p_minus_1, _r[i], 1);
+      if (mpz_invert (_d_mod_r_minus_1, _e, p_minus_1) == 0 ||
+	  mpz_invert (_coef, _prod, _r[i]) == 0)
+	throw CryptoInternalMayhem ("En fait, d est pas vraiment inversible modulo r_i - 1");
+    }
+    mpz_mul (_prod, _prod, _r[i]);
+
+    ANSSIPKI_ASN1::ASN1_INTEGER r (_r[i]);
+    ANSSIPKI_ASN1::ASN1_INTEGER d_mod_r (_d_mod_r_minus_1);
+    ANSSIPKI_ASN1::ASN1_INTEGER coef (_coef);
+    otherPrimeInfos += encapsulate (r.toDER () + d_mod_r.toDER () + coef.toDER (), T_SEQU);
+  }
+  if (_nPrimes > 2)
+    otherPrimeInfos = encapsulate (otherPrimeInfos, T_SEQU);
+
   mpz_shred (zero);
   mpz_shred (_d_mod_p_minus_1);
   mpz_shred (_d_mod_q_minus_1);
   mpz_shred (p_minus_1);
   mpz_shred (q_minus_1);
   mpz_shred (_invq);
+  mpz_shred (_d_mod_r_minus_1);
+  mpz_shred (_coef);
+  mpz_shred (_prod);
 
   return (encapsulate (version.toDER() +
 		       n.toDER () +
@@ -457,7 +1191,8 @@ const String RSAKey::ASN1PrivateKey () const {
 		       q.toDER () +
 		       d_mod_p.toDER () +
 		       d_mod_q.toDER () +
-		       invq.toDER (), T_SEQU));
+		       invq.toDER () +
+		       otherPrimeInfos, T_SEQU));
 }
 
 bool RSAKey::setFromASN1PrivateKey (const String& DERString)
@@ -475,11 +1210,13 @@ bool RSAKey::setFromASN1PrivateKey (const String& DERString)
       getNextInt (content, _d);
       getNextInt (content, _p);
       getNextInt (content, _q);
+      _nPrimes = 2 + getOtherPrimes (content, version, _r);
     }
   catch (ANSSIPKIException &e)
     {
       return false;
     }
+  updateCRT ();
   /*
   // Vérifications sur la clé publique et création de l'objet _pubkey
   mpz_t seed;
@@ -487,6 +1224,8 @@ bool RSAKey::setFromASN1PrivateKey (const String& DERString)
   checkKey (mpz_sizeinbase(_n, 2), seed);
   mpz_shred (seed);
   */
+  _selfTest = RSA_SELF_TEST_NONE;
+  _selfTestState = SELF_TEST_DONE;
   _initialized = true;
   return true;
 }
@@ -522,7 +1261,14 @@ const String RSAKey::ASN1PublicKey () const {
 }
 
 
-void RSAKey::checkKey (const size_t nBits, const mpz_t seed) {
+void RSAKey::checkKey (const size_t nBits, const mpz_t seed, rsa_self_test_t selfTest) {
+  if (selfTest != RSA_SELF_TEST_FULL && selfTest != RSA_SELF_TEST_FAST &&
+      selfTest != RSA_SELF_TEST_DEFERRED)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "niveau d'auto-test RSA invalide");
+
+  _selfTest = selfTest;
+  _selfTestState = SELF_TEST_DONE;
+
   if (mpz_cmp_ui (_n, 0) < 0)
     throw CryptoInternalMayhem ("le module RSA est négatif");
 
@@ -547,12 +1293,74 @@ void RSAKey::checkKey (const size_t nBits, const mpz_t seed) {
   if (mpz_sizeinbase(_n, 2) != nBits) 
     throw CryptoInternalMayhem ("le module RSA n'a pas la bonne taille");
 
-  if (isSmoothTrivial (_n))
-    throw CryptoInternalMayhem ("le module RSA est friable");
+  switch (selfTest) {
+  case RSA_SELF_TEST_FAST:
+    if (isSmoothTrivial (_n))
+      throw CryptoInternalMayhem ("le module RSA est friable");
+    checkKeyStructure ();
+    checkKeyRoundTrips (seed, 1);
+    break;
+
+  case RSA_SELF_TEST_DEFERRED:
+    // Le test de friabilité et les chiffrements / déchiffrements
+    // sont laissés à la première opération privée
+    mpz_set (_selfTestSeed, seed);
+    _selfTestState = SELF_TEST_PENDING;
+    break;
+
+  default:
+    if (isSmoothTrivial (_n))
+      throw CryptoInternalMayhem ("le module RSA est friable");
+
+    // Terminons par quelques tests de chiffrement / déchiffrement
+    checkKeyRoundTrips (seed, nEncryptionDecryptionVerif);
+  }
+}
+
+
+void RSAKey::checkKeyStructure () const {
+  mpz_t x, lambda;
+  unsigned int i;
+
+  // Sans p ni q, seuls les chiffrements / déchiffrements peuvent
+  // valider la clé
+  if (mpz_cmp_ui (_p, 1) <= 0 || mpz_cmp_ui (_q, 1) <= 0)
+    return;
+
+  mpz_init (x);
+  mpz_mul (x, _p, _q);
+  for (i = 0; i + 2 < _nPrimes; i++)
+    mpz_mul (x, x, _r[i]);
+  if (mpz_cmp (x, _n) != 0) {
+    mpz_shred (x);
+    throw CryptoInternalMayhem ("le module RSA n'est pas le produit de ses facteurs");
+  }
 
-  // Terminons par quelques tests de chiffrement / déchiffrement
+  // lambda(n) = ppcm (p-1, q-1, r_3 - 1, ...)
+  mpz_init (lambda);
+  mpz_sub_ui (x, _p, 1);
+  mpz_sub_ui (lambda, _q, 1);
+  mpz_lcm (lambda, lambda, x);
+  for (i = 0; i + 2 < _nPrimes; i++) {
+    mpz_sub_ui (x, _r[i], 1);
+    mpz_lcm (lambda, lambda, x);
+  }
+  mpz_mul (x, _e, _d);
+  mpz_mod (x, x, lambda);
+  bool ok = (mpz_cmp_ui (x, 1) == 0);
+
+  mpz_shred (x);
+  mpz_shred (lambda);
+
+  if (!ok)
+    throw CryptoInternalMayhem ("ed n'est pas congru à 1 modulo lambda(n)");
+}
+
+
+void RSAKey::checkKeyRoundTrips (const mpz_t seed, int nRounds) const {
   gmp_randstate_t GMP_state;
   mpz_t m, c, x;
+  bool ok = true;
   
   if (gmp_randinit_lc_2exp_size (GMP_state, GMP_RANDOM_INITIALIZER_SIZE) == 0)
     throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "GMP_RANDOM_INITIALIZER_SIZE est trop grand");
@@ -562,17 +1370,60 @@ void RSAKey::checkKey (const size_t nBits, const mpz_t seed) {
   mpz_init (c);
   mpz_init (x);
 
-  for (int i=0; i<nEncryptionDecryptionVerif; i++) {
+  RSAWorkspace& ws = threadWorkspace (_n);
+
+  for (int i=0; ok && i<nRounds; i++) {
     mpz_urandomm (m, GMP_state, _n);
-    mpz_powm (c, m, _e, _n);
-    mpz_powm (x, c, _d, _n);
-    if (mpz_cmp (m, x) != 0)
-      throw CryptoInternalMayhem ("la succession chiffrement / déchiffrement n'est pas l'identité");
+    publicOperation (c, m);
+    if (_crt)
+      crtExponentiation (x, c, ws);
+    else
+      mpz_powm (x, c, _d, _n);
+    ok = (mpz_cmp (m, x) == 0);
   }
+  ws.wipeTemporaries ();
 
+  gmp_randclear (GMP_state);
   mpz_shred (m);
   mpz_shred (c);
   mpz_shred (x);
+
+  if (!ok)
+    throw CryptoInternalMayhem ("la succession chiffrement / déchiffrement n'est pas l'identité");
+}
+
+
+bool RSAKey::runDeferredSelfTest () const {
+  int state = __sync_fetch_and_add (&_selfTestState, 0);
+
+  if (state != SELF_TEST_PENDING)
+    return (state == SELF_TEST_DONE);
+
+  pthread_mutex_lock (&_selfTestLock);
+  if (_selfTestState == SELF_TEST_PENDING) {
+    state = SELF_TEST_FAILED;
+    try {
+      if (!isSmoothTrivial (_n)) {
+	checkKeyRoundTrips (_selfTestSeed, nEncryptionDecryptionVerif);
+	state = SELF_TEST_DONE;
+      }
+    } catch (CryptoInternalMayhem& e) {
+      state = SELF_TEST_FAILED;
+    } catch (std::exception& e) {
+      // Faute de mémoire : l'auto-test sera retenté au prochain appel
+      state = SELF_TEST_PENDING;
+    }
+    __sync_val_compare_and_swap (&_selfTestState, SELF_TEST_PENDING, state);
+  }
+  state = _selfTestState;
+  pthread_mutex_unlock (&_selfTestLock);
+
+  return (state == SELF_TEST_DONE);
+}
+
+
+bool RSAKey::selfTestPending () const {
+  return (__sync_fetch_and_add (&_selfTestState, 0) == SELF_TEST_PENDING);
 }
 
 
@@ -633,6 +1484,7 @@ void RSAKey::setN (const mpz_t *newN)
       mpz_shred (_n);
     }
   mpz_init_set (_n, *newN);
+  updateCRT ();
 }
 
 void RSAKey::setE (const mpz_t *newE)
@@ -652,6 +1504,7 @@ void RSAKey::setD (const mpz_t *newD)
       mpz_shred (_d);
     }
   mpz_init_set (_d, *newD);
+  updateCRT ();
 }
 
 
@@ -662,6 +1515,7 @@ void RSAKey::setP (const mpz_t *newP)
       mpz_shred (_p);
     }
   mpz_init_set (_p, *newP);
+  updateCRT ();
 }
 
 
@@ -672,6 +1526,7 @@ void RSAKey::setQ (const mpz_t *newQ)
       mpz_shred (_q);
     }
   mpz_init_set (_q, *newQ);
+  updateCRT ();
 }
 
 
@@ -693,9 +1548,13 @@ int RSAKey::private_exponentiation (mpz_t *res, mpz_t *data)
       return -1;
     }
 
+  if (!runDeferredSelfTest ())
+    return -5;
+
   // calculer res
   mpz_init (*res);
-  mpz_powm (*res, *data, _d, _n);
+  if (!privateOperation (*res, *data, threadWorkspace (_n)))
+    return -4;
 
   return 0;
 }
@@ -760,7 +1619,7 @@ int RSAKey::public_exponentiation (mpz_t *res, mpz_t *data)
 
   // calculer res
   mpz_init (*res);
-  mpz_powm (*res, *data, _e, _n);
+  publicOperation (*res, *data);
 
   return 0;
 }
@@ -805,7 +1664,7 @@ int RSAKey::public_exponentiation (unsigned char *res, size_t *resLen, const uns
   return rv;
 }
 
-int RSAKey::pkcs1_v1_5_encode (unsigned char *res, const size_t emLen, const unsigned char *data, const size_t dataLen, ANSSIPKI_HASH::hash_function_t hashFunc)
+int RSAKey::pkcs1_v1_5_encode (unsigned char *res, const size_t emLen, const unsigned char *data, const size_t dataLen, ANSSIPKI_HASH::hash_function_t hashFunc) const
 {
   int rv = 0;
   size_t psLen = 0;
@@ -819,16 +1678,16 @@ int RSAKey::pkcs1_v1_5_encode (unsigned char *res, const size_t emLen, const uns
       goto end;
     }
 
-  if (emLen < dataLen + 11)
+  // hashFunc == (ANSSIPKI_HASH::sha1) ? dihLen = ANSSIPKI_HASH::digestInfoHeader_sha1_len : dihLen = 0;
+  if (ANSSIPKI_HASH::copyDigestInfoHeader (NULL, &dihLen, hashFunc) != 1)
     {
-      rv = -2;
+      rv = -3;
       goto end;
     }
 
-  // hashFunc == (ANSSIPKI_HASH::sha1) ? dihLen = ANSSIPKI_HASH::digestInfoHeader_sha1_len : dihLen = 0;
-  if (!ANSSIPKI_HASH::copyDigestInfoHeader (NULL, &dihLen, hashFunc))
+  if (emLen < dataLen + dihLen + 11)
     {
-      rv = -3;
+      rv = -2;
       goto end;
     }
 
@@ -848,7 +1707,7 @@ int RSAKey::pkcs1_v1_5_encode (unsigned char *res, const size_t emLen, const uns
   res[i] = 0x00;
   i ++;
   // dih
-  if (!ANSSIPKI_HASH::copyDigestInfoHeader (&(res[i]), &dihLen, hashFunc))
+  if (ANSSIPKI_HASH::copyDigestInfoHeader (&(res[i]), &dihLen, hashFunc) != 1)
     {
       rv = -3;
       goto end;
@@ -0,0 +1,328 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Crible par lots : division de plusieurs candidats à la fois par les
+// premiers impairs inférieurs à 2^16
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "anssipki-common.h"
+#include "anssipki-crypto.h"
+#include "prime_tables.h"
+#include <pthread.h>
+
+/* La mise en oeuvre scalaire est isPrime_TrialDivision, appliquée à
+   chaque candidat. La mise en oeuvre vectorielle traite quatre candidats
+   à la fois, un par mot de 64 bits d'un registre AVX2, contre le même
+   module M, produit de premiers consécutifs inférieur à 2^32 - 2^17.
+
+   AVX2 n'ayant pas de multiplication 64 x 64 -> 128 bits, la réduction
+   procède par mots de 32 bits, de poids faible en poids fort, avec une
+   réduction de Montgomery : pour n = somme des w_k 2^(32k), k < L,
+     r <- (r + w_k + mu (r + w_k) M) / 2^32, avec mu = -M^-1 mod 2^32
+   donne r = n 2^(-32L) mod M, à M près (r <= M + 1 < 2^32, et les
+   calculs intermédiaires tiennent sur 64 bits grâce à la borne sur M).
+   2^32 étant inversible modulo M, p | M divise n si et seulement s'il
+   divise r, ce qui se vérifie sans division (voir sieve_kernel.h) :
+   r p^-1 mod 2^32 <= floor ((2^32 - 1) / p).
+   SB_INTERLEAVE modules sont traités ensemble pour masquer la latence
+   des multiplications.
+   La plupart des candidats sont éliminés par les tout premiers
+   modules, alors qu'un lot de quatre n'est abandonné qu'une fois tous
+   ses candidats éliminés. Le crible se fait donc par phases, sur des
+   tranches de modules de plus en plus longues (sbPhases) : les
+   survivants d'une phase sont regroupés en lots complets pour la
+   suivante, chaque module étant traité indépendamment des autres. Un
+   groupe (m et 2m+1 par exemple) est écarté à la fin de la phase où l'un
+   de ses entiers est éliminé.
+
+   Le choix est fait à l'exécution (__builtin_cpu_supports) : le code
+   AVX2 est compilé avec l'attribut target, sans option de compilation
+   particulière pour le reste de la bibliothèque. */
+
+#if defined (__GNUC__) && defined (__x86_64__)
+#define SIEVE_BATCH_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+/* Vérification à la compilation du nombre de premiers du crible */
+typedef char sieveBatchPrimesCheck[(sizeof (primes) / sizeof (primes[0]) - 1
+				    == SIEVE_BATCH_PRIMES) ? 1 : -1];
+
+#ifdef SIEVE_BATCH_HAVE_AVX2
+static const unsigned int SB_LANES = 4;
+static const unsigned int SB_INTERLEAVE = 4;
+static const uint64_t SB_MODULUS_LIMIT = (1ULL << 32) - (1ULL << 17);
+static const unsigned int SB_MAX_MODULI = SIEVE_BATCH_PRIMES + SB_INTERLEAVE;
+
+/* Modules (leur nombre est complété à un multiple de SB_INTERLEAVE par
+   des modules égaux à 1, sans premier) : le module i est le produit des
+   premiers d'indices sbModuliEnd[i-1] (0 pour i = 0) à sbModuliEnd[i]
+   exclu, le premier d'indice j étant primes[j+1]. */
+static unsigned int sbNbModuli = 0;
+static uint64_t sbModuli[SB_MAX_MODULI];
+static uint64_t sbMu[SB_MAX_MODULI];
+static unsigned int sbModuliEnd[SB_MAX_MODULI];
+/* Fins des phases, en nombre de modules ; la dernière phase va jusqu'au
+   dernier module */
+static const unsigned int sbPhases[] = {SB_INTERLEAVE, 4 * SB_INTERLEAVE,
+					16 * SB_INTERLEAVE, 64 * SB_INTERLEAVE,
+					256 * SB_INTERLEAVE};
+static const unsigned int SB_NB_PHASES = sizeof (sbPhases) / sizeof (sbPhases[0]) + 1;
+static uint64_t sbInv[SIEVE_BATCH_PRIMES];
+static uint64_t sbLim[SIEVE_BATCH_PRIMES];
+static pthread_once_t sbOnce = PTHREAD_ONCE_INIT;
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Construction des tables
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// Inverse de a impair modulo 2^32 (itération de Newton)
+static uint32_t inverse32 (uint32_t a) {
+  uint32_t x = a;
+  for (unsigned int bits=3; bits<32; bits*=2)
+    x *= 2 - a * x;
+  return x;
+}
+
+
+static void buildBatchTables () {
+  unsigned int i = 0;
+  unsigned int nModuli = 0;
+
+  while (i < SIEVE_BATCH_PRIMES) {
+    uint64_t m = primes[++i];
+    while (i < SIEVE_BATCH_PRIMES && m * primes[i+1] < SB_MODULUS_LIMIT)
+      m *= primes[++i];
+    sbModuli[nModuli] = m;
+    sbModuliEnd[nModuli] = i;
+    nModuli++;
+  }
+  while (nModuli % SB_INTERLEAVE != 0) {
+    sbModuli[nModuli] = 1;
+    sbModuliEnd[nModuli] = SIEVE_BATCH_PRIMES;
+    nModuli++;
+  }
+
+  for (unsigned int k = 0; k < nModuli; k++)
+    sbMu[k] = (uint32_t) -inverse32 ((uint32_t) sbModuli[k]);
+  for (unsigned int j = 0; j < SIEVE_BATCH_PRIMES; j++) {
+    sbInv[j] = inverse32 ((uint32_t) primes[j+1]);
+    sbLim[j] = 0xFFFFFFFFU / (uint32_t) primes[j+1];
+  }
+  sbNbModuli = nModuli;
+}
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Crible vectoriel
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// Masque des candidats du lot r (un par mot) divisibles par l'un des
+// premiers du module k
+__attribute__ ((target ("avx2")))
+static inline __m256i dividesModulus (__m256i r, unsigned int k) {
+  const __m256i low = _mm256_set1_epi64x (0xFFFFFFFFLL);
+  __m256i notDivisible = _mm256_set1_epi64x (-1);
+
+  for (unsigned int j = (k == 0) ? 0 : sbModuliEnd[k-1]; j < sbModuliEnd[k]; j++) {
+    __m256i x = _mm256_and_si256 (_mm256_mul_epu32 (r, _mm256_set1_epi64x ((long long) sbInv[j])), low);
+    notDivisible = _mm256_and_si256 (notDivisible,
+				     _mm256_cmpgt_epi64 (x, _mm256_set1_epi64x ((long long) sbLim[j])));
+  }
+
+  return _mm256_xor_si256 (notDivisible, _mm256_set1_epi64x (-1));
+}
+
+
+// Un pas de réduction de Montgomery : (r + w) 2^-32 mod M
+#define SB_REDC(r, w, m, mu) do {					\
+    __m256i x_ = _mm256_add_epi64 (r, w);				\
+    __m256i q_ = _mm256_mul_epu32 (x_, mu);				\
+    r = _mm256_srli_epi64 (_mm256_add_epi64 (x_, _mm256_mul_epu32 (q_, m)), 32); \
+  } while (0)
+
+
+// Crible de SB_LANES candidats par les modules d'indices kBegin à kEnd
+// exclu (multiples de SB_INTERLEAVE), words[SB_LANES i + c] étant le
+// mot i (de 32 bits) du candidat c. Seuls les candidats dont le bit est
+// mis dans alive sont examinés ; retourne les bits des survivants.
+__attribute__ ((target ("avx2")))
+static unsigned int sieveLanesAVX2 (const uint64_t* words, unsigned int nWords,
+				    unsigned int alive, unsigned int kBegin, unsigned int kEnd) {
+  __m256i live = _mm256_set_epi64x ((alive & 8) ? -1 : 0, (alive & 4) ? -1 : 0,
+				    (alive & 2) ? -1 : 0, (alive & 1) ? -1 : 0);
+
+  for (unsigned int k = kBegin; k < kEnd; k += SB_INTERLEAVE) {
+    const __m256i m0 = _mm256_set1_epi64x ((long long) sbModuli[k]);
+    const __m256i m1 = _mm256_set1_epi64x ((long long) sbModuli[k+1]);
+    const __m256i m2 = _mm256_set1_epi64x ((long long) sbModuli[k+2]);
+    const __m256i m3 = _mm256_set1_epi64x ((long long) sbModuli[k+3]);
+    const __m256i mu0 = _mm256_set1_epi64x ((long long) sbMu[k]);
+    const __m256i mu1 = _mm256_set1_epi64x ((long long) sbMu[k+1]);
+    const __m256i mu2 = _mm256_set1_epi64x ((long long) sbMu[k+2]);
+    const __m256i mu3 = _mm256_set1_epi64x ((long long) sbMu[k+3]);
+    __m256i r0 = _mm256_setzero_si256 ();
+    __m256i r1 = r0, r2 = r0, r3 = r0;
+
+    for (unsigned int i = 0; i < nWords; i++) {
+      __m256i w = _mm256_loadu_si256 ((const __m256i*) (words + SB_LANES * i));
+      SB_REDC (r0, w, m0, mu0);
+      SB_REDC (r1, w, m1, mu1);
+      SB_REDC (r2, w, m2, mu2);
+      SB_REDC (r3, w, m3, mu3);
+    }
+
+    __m256i dead = _mm256_or_si256 (_mm256_or_si256 (dividesModulus (r0, k),
+						     dividesModulus (r1, k+1)),
+				    _mm256_or_si256 (dividesModulus (r2, k+2),
+						     dividesModulus (r3, k+3)));
+    live = _mm256_andnot_si256 (dead, live);
+    if (_mm256_testz_si256 (live, live))
+      break;
+  }
+
+  return (unsigned int) _mm256_movemask_pd (_mm256_castsi256_pd (live));
+}
+
+#undef SB_REDC
+
+
+// Nombre de mots de 32 bits de |n|
+static unsigned int nbWords (const mpz_t n) {
+  return (unsigned int) mpz_size (n) * (GMP_NUMB_BITS / 32);
+}
+
+
+// Transposition des candidats n[idx[c]], c < lanes, complétés par des
+// mots nuls (ce qui revient à multiplier r par une puissance de 2^-32)
+static void transposeLanes (uint64_t* words, unsigned int nWords, mpz_t* n,
+			    const unsigned int* idx, unsigned int lanes) {
+  for (size_t i = 0; i < (size_t) SB_LANES * nWords; i++)
+    words[i] = 0;
+
+  for (unsigned int c = 0; c < lanes; c++) {
+    mpz_srcptr x = n[idx[c]];
+    size_t size = mpz_size (x);
+    for (size_t l = 0; l < size; l++) {
+      mp_limb_t limb = mpz_getlimbn (x, (mp_size_t) l);
+      for (unsigned int h = 0; h < GMP_NUMB_BITS / 32; h++)
+	words[SB_LANES * (l * (GMP_NUMB_BITS / 32) + h) + c] = (uint32_t) (limb >> (32 * h));
+    }
+  }
+}
+
+
+static void sieveBatchAVX2 (mpz_t* n, unsigned int count, unsigned int width, bool* res) {
+  pthread_once (&sbOnce, buildBatchTables);
+
+  // Groupes encore en lice (ceux pour lesquels res est vrai), et
+  // entiers de ces groupes soumis à la phase courante
+  unsigned int total = count * width;
+  unsigned int* groups = new unsigned int[count];
+  unsigned int* members = new unsigned int[total];
+  unsigned int nGroups = 0;
+  unsigned int maxWords = 0;
+
+  for (unsigned int i = 0; i < total; i++)
+    if (nbWords (n[i]) > maxWords)
+      maxWords = nbWords (n[i]);
+  for (unsigned int g = 0; g < count; g++) {
+    res[g] = true;
+    for (unsigned int j = 0; j < width; j++)
+      if (!mpz_odd_p (n[g + j * count]))
+	res[g] = false;
+    if (res[g])
+      groups[nGroups++] = g;
+  }
+
+  size_t len = (size_t) SB_LANES * maxWords;
+  uint64_t* words = new uint64_t[len];
+  unsigned int kBegin = 0;
+
+  for (unsigned int phase = 0; phase < SB_NB_PHASES && nGroups > 0; phase++) {
+    unsigned int kEnd = (phase < SB_NB_PHASES - 1 && sbPhases[phase] < sbNbModuli)
+      ? sbPhases[phase] : sbNbModuli;
+    unsigned int nMembers = 0;
+
+    for (unsigned int a = 0; a < nGroups; a++)
+      for (unsigned int j = 0; j < width; j++)
+	members[nMembers++] = groups[a] + j * count;
+
+    for (unsigned int first = 0; first < nMembers; first += SB_LANES) {
+      unsigned int lanes = (nMembers - first < SB_LANES) ? nMembers - first : SB_LANES;
+
+      transposeLanes (words, maxWords, n, members + first, lanes);
+      unsigned int survivors = sieveLanesAVX2 (words, maxWords, (1U << lanes) - 1,
+					       kBegin, kEnd);
+      for (unsigned int c = 0; c < lanes; c++)
+	if (((survivors >> c) & 1) == 0)
+	  res[members[first + c] % count] = false;
+    }
+
+    unsigned int nSurvivors = 0;
+    for (unsigned int a = 0; a < nGroups; a++)
+      if (res[groups[a]])
+	groups[nSurvivors++] = groups[a];
+    nGroups = nSurvivors;
+
+    kBegin = kEnd;
+    if (kBegin == sbNbModuli)
+      break;
+  }
+
+  // Les candidats peuvent être des facteurs secrets
+  volatile uint64_t* v = words;
+  for (size_t i = 0; i < len; i++)
+    v[i] = 0;
+  delete[] words;
+  delete[] members;
+  delete[] groups;
+}
+#endif
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Interface
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+bool isSieveBatchSupported (sieve_batch_t impl) {
+  switch (impl) {
+  case SIEVE_BATCH_AUTO:
+  case SIEVE_BATCH_SCALAR:
+    return true;
+  case SIEVE_BATCH_AVX2:
+#ifdef SIEVE_BATCH_HAVE_AVX2
+    return __builtin_cpu_supports ("avx2");
+#else
+    return false;
+#endif
+  }
+  return false;
+}
+
+
+void isPrime_SieveBatch (mpz_t* n, unsigned int count, bool* res, sieve_batch_t impl,
+			 unsigned int width) {
+  if (impl == SIEVE_BATCH_AUTO)
+    impl = isSieveBatchSupported (SIEVE_BATCH_AVX2) ? SIEVE_BATCH_AVX2 : SIEVE_BATCH_SCALAR;
+  else if (!isSieveBatchSupported (impl))
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Crible par lots non disponible sur ce processeur");
+
+#ifdef SIEVE_BATCH_HAVE_AVX2
+  if (impl == SIEVE_BATCH_AVX2) {
+    sieveBatchAVX2 (n, count, width, res);
+    return;
+  }
+#endif
+
+  for (unsigned int g = 0; g < count; g++) {
+    res[g] = true;
+    for (unsigned int j = 0; j < width && res[g]; j++)
+      res[g] = isPrime_TrialDivision (n[g + j * count], SIEVE_BATCH_PRIMES, TRIAL_DIVISION_MOD_1);
+  }
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+#ifndef SIEVE_KERNEL_H
+#define SIEVE_KERNEL_H
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Réduction d'un limbe modulo un petit premier impair à l'aide de
+// constantes précalculées
+//
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/* Pour p impair et B = 2^GMP_NUMB_BITS, on précalcule
+   + inv = p^-1 mod B ;
+   + lim = floor ((B-1) / p).
+   Un limbe r est divisible par p si et seulement si r inv mod B <= lim
+   (Granlund et Montgomery, "Division by invariant integers using
+   multiplication", 1994, section 9) : une multiplication remplace la
+   division.
+   lim sert aussi de constante de Barrett : q = floor (r lim / B) vaut
+   floor (r / p) ou floor (r / p) - 1, d'où r mod p avec une
+   multiplication, une soustraction et au plus une correction.
+   Les tableaux de premiers sont accompagnés de tableaux distincts pour
+   inv et lim, parcourus dans le même ordre. */
+
+#include <gmp.h>
+
+#if GMP_NUMB_BITS == 32 || defined (__SIZEOF_INT128__)
+#define SIEVE_KERNEL_BARRETT 1
+#endif
+
+
+static inline mp_limb_t smallPrimeInverse (mp_limb_t p) {
+  // Itération de Newton (voir MontgomeryModulus::init)
+  mp_limb_t x = p;
+  for (unsigned int bits=3; bits<GMP_NUMB_BITS; bits*=2)
+    x *= 2 - p * x;
+  return x;
+}
+
+
+static inline mp_limb_t smallPrimeLimit (mp_limb_t p) {
+  return GMP_NUMB_MAX / p;
+}
+
+
+static inline bool smallPrimeDivides (mp_limb_t r, mp_limb_t inv, mp_limb_t lim) {
+  return r * inv <= lim;
+}
+
+
+static inline mp_limb_t smallPrimeMod (mp_limb_t r, mp_limb_t p, mp_limb_t lim) {
+#ifdef SIEVE_KERNEL_BARRETT
+#if GMP_NUMB_BITS == 32
+  mp_limb_t q = (mp_limb_t) (((unsigned long long) r * lim) >> 32);
+#else
+  mp_limb_t q = (mp_limb_t) (((unsigned __int128) r * lim) >> 64);
+#endif
+  r -= q * p;
+  if (r >= p)
+    r -= p;
+  return r;
+#else
+  (void) lim;
+  return r % p;
+#endif
+}
+
+#endif
@@ -0,0 +1,497 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Division par les petits premiers, à borne et méthode réglables
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "anssipki-common.h"
+#include "anssipki-crypto.h"
+#include "trial_division_tuning.h"
+#include "prime_tables.h"
+#include "sieve_kernel.h"
+#include <pthread.h>
+
+/* Le crible de isPrime_Sieve par les premiers inférieurs à 2^16 convient
+   aux entiers de quelques centaines de bits. Pour des entiers plus
+   grands, un test de Miller-Rabin coûte beaucoup plus cher qu'une
+   division courte, et il est rentable de diviser par davantage de
+   premiers ; la façon de diviser compte aussi :
+   + TRIAL_DIVISION_MOD_1 : une division mpn_mod_1 de n par produit de
+   premiers tenant dans un limbe, puis des divisions courtes. Coût
+   proportionnel à (taille de n) x (nombre de produits), arrêt dès le
+   premier facteur trouvé.
+   + TRIAL_DIVISION_GCD : un pgcd de n avec le produit P de tous les
+   premiers (précalculé). Coût quasi linéaire en max (n, P), sans arrêt
+   anticipé.
+   + TRIAL_DIVISION_TREE : arbre des restes. n est réduit modulo P, puis
+   modulo chacun des deux moitiés de P, etc. jusqu'aux produits tenant
+   dans un limbe. Le parcours se fait en profondeur, de façon à
+   s'arrêter au premier facteur trouvé.
+   Le meilleur choix dépend de la taille de n et de la machine : il est
+   lu dans trial_division_tuning.h, produit par test_prime_perfs. */
+
+
+/* Premiers impairs inférieurs à 2^20, et leurs produits tenant dans un
+   limbe : le produit i contient les premiers d'indices
+   tdProductsEnd[i-1] (0 pour i = 0) à tdProductsEnd[i] exclu.
+   Les tables sont construites en deux temps : les premiers inférieurs à
+   2^16 sont repris de prime_tables.h (sans calcul), ceux compris entre
+   2^16 et 2^20 ne sont criblés que si une borne plus grande est
+   demandée. Un produit ne chevauche pas les deux parties, de sorte que
+   la seconde ne modifie pas la première.
+   tdInv et tdLim sont les constantes de sieve_kernel.h associées à
+   chaque premier, qui évitent les divisions courtes. */
+static const unsigned int TD_PRIMES_LIMIT = 1U << 20;
+static const unsigned int TD_SMALL_PRIMES = sizeof (primes) / sizeof (primes[0]) - 1;
+static const unsigned int TD_SEGMENT_LENGTH = 1U << 15;
+static unsigned int tdPrimes[TRIAL_DIVISION_MAX_PRIMES];
+static mp_limb_t tdInv[TRIAL_DIVISION_MAX_PRIMES];
+static mp_limb_t tdLim[TRIAL_DIVISION_MAX_PRIMES];
+static mp_limb_t tdProducts[TRIAL_DIVISION_MAX_PRIMES];
+static unsigned int tdProductsEnd[TRIAL_DIVISION_MAX_PRIMES];
+static unsigned int tdNbSmallProducts = 0;
+static unsigned int tdNbProducts = 0;
+static pthread_once_t tdSmallOnce = PTHREAD_ONCE_INIT;
+static pthread_once_t tdLargeOnce = PTHREAD_ONCE_INIT;
+static const char* tdError = NULL;
+
+
+/* Arbre des produits au-dessus des tdProducts[0 .. nProducts-1] :
+   levels[0][i] = tdProducts[i], et levels[l][i] est le produit de
+   levels[l-1][2i] et levels[l-1][2i+1] (s'il existe). La racine
+   levels[nLevels-1][0] est le produit de tous les premiers. Les arbres
+   déjà construits sont conservés (au plus TD_TREE_CACHE_SIZE bornes
+   distinctes) ; comme pour les paramètres de Fouque-Tibouchi, un arbre
+   publié n'est plus modifié. */
+typedef struct {
+  unsigned int nProducts;
+  unsigned int nLevels;
+  unsigned int* levelSize;
+  mpz_t** levels;
+} tdTree;
+
+static const unsigned int TD_TREE_CACHE_SIZE = 16;
+static tdTree tdTrees[TD_TREE_CACHE_SIZE];
+static unsigned int tdTreesCount = 0;
+static pthread_mutex_t tdTreesLock = PTHREAD_MUTEX_INITIALIZER;
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Construction des tables
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// Regroupement des premiers d'indices first à end exclu en produits
+// tenant dans un limbe, ajoutés à partir du produit *nProducts, et
+// calcul de leurs constantes de division
+static void buildProducts (unsigned int first, unsigned int end, unsigned int* nProducts) {
+  unsigned int i = first;
+
+  for (unsigned int j = first; j < end; j++) {
+    tdInv[j] = smallPrimeInverse (tdPrimes[j]);
+    tdLim[j] = smallPrimeLimit (tdPrimes[j]);
+  }
+
+  while (i < end) {
+    mp_limb_t p = tdPrimes[i++];
+    while (i < end && p <= GMP_NUMB_MAX / tdPrimes[i])
+      p *= tdPrimes[i++];
+    tdProducts[*nProducts] = p;
+    tdProductsEnd[*nProducts] = i;
+    (*nProducts)++;
+  }
+}
+
+
+static void buildSmallTables () {
+  for (unsigned int i = 0; i < TD_SMALL_PRIMES; i++)
+    tdPrimes[i] = (unsigned int) primes[i+1];
+  buildProducts (0, TD_SMALL_PRIMES, &tdNbSmallProducts);
+}
+
+
+// Crible d'Ératosthène segmenté des impairs entre le dernier premier de
+// prime_tables.h et 2^20, les premiers de crible (inférieurs à 2^10) étant
+// déjà connus
+static void buildLargeTables () {
+  unsigned char* composite = new unsigned char[TD_SEGMENT_LENGTH];
+  unsigned int n = TD_SMALL_PRIMES;
+  unsigned int nProducts = tdNbSmallProducts;
+
+  for (unsigned int lo = (unsigned int) primes[TD_SMALL_PRIMES] + 2; lo < TD_PRIMES_LIMIT;
+       lo += 2 * TD_SEGMENT_LENGTH) {
+    // composite[k] pour lo + 2k
+    unsigned int hi = lo + 2 * TD_SEGMENT_LENGTH;
+    if (hi > TD_PRIMES_LIMIT)
+      hi = TD_PRIMES_LIMIT;
+    unsigned int len = (hi - lo + 1) / 2;
+
+    for (unsigned int k = 0; k < len; k++)
+      composite[k] = 0;
+    for (unsigned int i = 0; tdPrimes[i] * tdPrimes[i] < hi; i++) {
+      unsigned int p = tdPrimes[i];
+      unsigned int m = ((lo + p - 1) / p) * p;
+      if ((m & 1) == 0)
+	m += p;
+      for (unsigned int k = (m - lo) / 2; k < len; k += p)
+	composite[k] = 1;
+    }
+
+    for (unsigned int k = 0; k < len; k++)
+      if (!composite[k]) {
+	if (n == TRIAL_DIVISION_MAX_PRIMES) {
+	  tdError = "TRIAL_DIVISION_MAX_PRIMES est trop petit";
+	  delete[] composite;
+	  return;
+	}
+	tdPrimes[n++] = lo + 2 * k;
+      }
+  }
+  delete[] composite;
+
+  if (n != TRIAL_DIVISION_MAX_PRIMES) {
+    tdError = "TRIAL_DIVISION_MAX_PRIMES est trop grand";
+    return;
+  }
+
+  buildProducts (TD_SMALL_PRIMES, n, &nProducts);
+  tdNbProducts = nProducts;
+}
+
+
+static void ensureTrialDivisionTables (unsigned int nPrimes) {
+  pthread_once (&tdSmallOnce, buildSmallTables);
+  if (nPrimes > TD_SMALL_PRIMES) {
+    pthread_once (&tdLargeOnce, buildLargeTables);
+    if (tdError != NULL)
+      throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, tdError);
+  }
+}
+
+
+// Nombre de produits couvrant les nPrimes premiers premiers impairs
+static unsigned int nbProducts (unsigned int nPrimes) {
+  unsigned int a = 0;
+  unsigned int b = ((nPrimes > TD_SMALL_PRIMES) ? tdNbProducts : tdNbSmallProducts) - 1;
+
+  while (a < b) {
+    unsigned int i = (a + b) / 2;
+    if (tdProductsEnd[i] >= nPrimes)
+      b = i;
+    else
+      a = i + 1;
+  }
+
+  return a + 1;
+}
+
+
+static void buildTree (tdTree* t, unsigned int nProducts) {
+  unsigned int size = nProducts;
+
+  t->nProducts = nProducts;
+  t->nLevels = 1;
+  while (size > 1) {
+    size = (size + 1) / 2;
+    t->nLevels++;
+  }
+
+  t->levelSize = new unsigned int[t->nLevels];
+  t->levels = new mpz_t*[t->nLevels];
+
+  t->levelSize[0] = nProducts;
+  t->levels[0] = new mpz_t[nProducts];
+  for (unsigned int i = 0; i < nProducts; i++)
+    mpz_init_set_ui (t->levels[0][i], tdProducts[i]);
+
+  for (unsigned int l = 1; l < t->nLevels; l++) {
+    unsigned int below = t->levelSize[l-1];
+    t->levelSize[l] = (below + 1) / 2;
+    t->levels[l] = new mpz_t[t->levelSize[l]];
+    for (unsigned int i = 0; i < t->levelSize[l]; i++) {
+      mpz_init_set (t->levels[l][i], t->levels[l-1][2*i]);
+      if (2*i + 1 < below)
+	mpz_mul (t->levels[l][i], t->levels[l][i], t->levels[l-1][2*i+1]);
+    }
+  }
+}
+
+
+static void clearTree (tdTree* t) {
+  for (unsigned int l = 0; l < t->nLevels; l++) {
+    for (unsigned int i = 0; i < t->levelSize[l]; i++)
+      mpz_clear (t->levels[l][i]);
+    delete[] t->levels[l];
+  }
+  delete[] t->levels;
+  delete[] t->levelSize;
+}
+
+
+// Arbre pour nProducts produits, pris dans le cache ou construit dans
+// local si le cache est plein (voir getParamFT)
+static const tdTree* getTree (unsigned int nProducts, tdTree* local) {
+  const tdTree* res = NULL;
+
+  pthread_mutex_lock (&tdTreesLock);
+  for (unsigned int i = 0; i < tdTreesCount; i++)
+    if (tdTrees[i].nProducts == nProducts) {
+      res = &tdTrees[i];
+      break;
+    }
+  if (res == NULL && tdTreesCount < TD_TREE_CACHE_SIZE) {
+    buildTree (&tdTrees[tdTreesCount], nProducts);
+    res = &tdTrees[tdTreesCount];
+    tdTreesCount++;
+  }
+  pthread_mutex_unlock (&tdTreesLock);
+
+  if (res == NULL) {
+    buildTree (local, nProducts);
+    res = local;
+  }
+
+  return res;
+}
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Méthodes de division
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+// Le reste r du produit i est-il premier avec les premiers de ce produit
+// (limités aux nPrimes premiers) ?
+static bool productCoprime (mp_limb_t r, unsigned int i, unsigned int nPrimes) {
+  unsigned int end = (tdProductsEnd[i] < nPrimes) ? tdProductsEnd[i] : nPrimes;
+
+  for (unsigned int j = (i == 0) ? 0 : tdProductsEnd[i-1]; j < end; j++)
+    if (smallPrimeDivides (r, tdInv[j], tdLim[j]))
+      return false;
+
+  return true;
+}
+
+
+static bool trialDivisionMod1 (const mpz_t n, unsigned int nPrimes) {
+  unsigned int nProd = nbProducts (nPrimes);
+
+  for (unsigned int i = 0; i < nProd; i++) {
+    mp_limb_t r = mpn_mod_1 (n->_mp_d, (mp_size_t) n->_mp_size, tdProducts[i]);
+    if (!productCoprime (r, i, nPrimes))
+      return false;
+  }
+
+  return true;
+}
+
+
+static bool trialDivisionGcd (const mpz_t n, const tdTree* t) {
+  mpz_srcptr P = t->levels[t->nLevels-1][0];
+  mpz_t r;
+  bool res;
+
+  // Pgcd calculé sur le plus petit des deux opérandes
+  mpz_init (r);
+  if (mpz_cmp (n, P) < 0) {
+    mpz_tdiv_r (r, P, n);
+    mpz_gcd (r, r, n);
+  } else {
+    mpz_tdiv_r (r, n, P);
+    mpz_gcd (r, r, P);
+  }
+  res = (mpz_cmp_ui (r, 1) == 0);
+  mpz_shred (r);
+
+  return res;
+}
+
+
+// r = n mod levels[l][i] ; tmp[0 .. l-1] sont des espaces de travail
+static bool treeDescend (const tdTree* t, unsigned int l, unsigned int i,
+			 const mpz_t r, mpz_t* tmp) {
+  if (l == 0)
+    return productCoprime (mpz_get_ui (r), i, tdProductsEnd[t->nProducts-1]);
+
+  for (unsigned int c = 2*i; c < 2*i + 2 && c < t->levelSize[l-1]; c++) {
+    mpz_tdiv_r (tmp[l-1], r, t->levels[l-1][c]);
+    if (!treeDescend (t, l - 1, c, tmp[l-1], tmp))
+      return false;
+  }
+
+  return true;
+}
+
+
+static bool trialDivisionTree (const mpz_t n, const tdTree* t) {
+  unsigned int top = t->nLevels - 1;
+  mpz_t* tmp = new mpz_t[t->nLevels];
+  bool res;
+
+  for (unsigned int l = 0; l <= top; l++)
+    mpz_init (tmp[l]);
+
+  mpz_tdiv_r (tmp[top], n, t->levels[top][0]);
+  res = treeDescend (t, top, 0, tmp[top], tmp);
+
+  for (unsigned int l = 0; l <= top; l++)
+    mpz_shred (tmp[l]);
+  delete[] tmp;
+
+  return res;
+}
+
+
+// Borne et méthode de la table de réglage pour un entier de nbits bits
+static const trialDivisionTuning& tunedTrialDivision (size_t nbits) {
+  unsigned int i, a = 0, b = trial_division_table_len;
+  while (b-a > 1) {
+    i = (a + b) / 2;
+    if (nbits < trial_division_table[i].nbits)
+      b = i;
+    else
+      a = i;
+  }
+  return trial_division_table[a];
+}
+
+
+bool isPrime_TrialDivision (mpz_t n, unsigned int nPrimes, trial_division_t method) {
+  if (nPrimes == 0) {
+    const trialDivisionTuning& tuning = tunedTrialDivision (mpz_sizeinbase (n, 2));
+    nPrimes = tuning.nPrimes;
+    method = tuning.method;
+  }
+  if (nPrimes > TRIAL_DIVISION_MAX_PRIMES)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Pas assez de nombres premiers précalculés");
+
+  ensureTrialDivisionTables (nPrimes);
+
+  if ((mpz_get_ui (n) & 1) == 0)
+    return false;
+
+  switch (method) {
+  case TRIAL_DIVISION_MOD_1:
+    return trialDivisionMod1 (n, nPrimes);
+
+  case TRIAL_DIVISION_GCD:
+  case TRIAL_DIVISION_TREE: {
+    tdTree local;
+    const tdTree* t = getTree (nbProducts (nPrimes), &local);
+    bool res = (method == TRIAL_DIVISION_GCD) ? trialDivisionGcd (n, t) : trialDivisionTree (n, t);
+    if (t == &local)
+      clearTree (&local);
+    return res;
+  }
+
+  default:
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Méthode de division inconnue");
+  }
+}
+
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Parties friables d'un lot d'entiers
+//
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/* Méthode de Bernstein ("How to find smooth parts of integers", 2004).
+   Soit P le produit des premiers impairs (racine de l'arbre ci-dessus)
+   et x_1, ..., x_k les parties impaires des entiers du lot :
+   + l'arbre des produits des x_i donne X = x_1 ... x_k ;
+   + l'arbre des restes donne z_i = P mod x_i : P est réduit modulo X,
+   puis modulo chacun des deux sous-produits, etc. ;
+   + pgcd (x_i, z_i) est le produit des premiers de P divisant x_i,
+   dont les puissances sont ensuite retirées de x_i par quelques pgcd et
+   divisions exactes, sur des opérandes en général petits (Bernstein
+   élève plutôt z_i au carré modulo x_i, ce qui coûte plus cher ici).
+   Le coût est quasi linéaire en la taille totale du lot et de P, au lieu
+   de (taille de x_i) x (nombre de premiers) par entier : la borne peut
+   être relevée jusqu'à 2^20 sans que le coût par entier n'explose. */
+void smoothParts (mpz_t* s, mpz_t* n, unsigned int count, unsigned int nPrimes) {
+  if (nPrimes == 0 || nPrimes > TRIAL_DIVISION_MAX_PRIMES)
+    throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Pas assez de nombres premiers précalculés");
+  for (unsigned int i = 0; i < count; i++)
+    if (mpz_sgn (n[i]) <= 0)
+      throw ANSSIPKIException (E_CRYPTO_BAD_PARAMETER, "Entier non strictement positif");
+  if (count == 0)
+    return;
+
+  ensureTrialDivisionTables (nPrimes);
+  tdTree local;
+  const tdTree* t = getTree (nbProducts (nPrimes), &local);
+  mpz_srcptr P = t->levels[t->nLevels-1][0];
+
+  // Arbre des produits des parties impaires, x étant le niveau 0
+  unsigned long* twos = new unsigned long[count];
+  unsigned int nLevels = 1, size = count;
+  while (size > 1) {
+    size = (size + 1) / 2;
+    nLevels++;
+  }
+  unsigned int* levelSize = new unsigned int[nLevels];
+  mpz_t** levels = new mpz_t*[nLevels];
+
+  levelSize[0] = count;
+  levels[0] = new mpz_t[count];
+  for (unsigned int i = 0; i < count; i++) {
+    twos[i] = mpz_scan1 (n[i], 0UL);
+    mpz_init (levels[0][i]);
+    mpz_tdiv_q_2exp (levels[0][i], n[i], twos[i]);
+  }
+  for (unsigned int l = 1; l < nLevels; l++) {
+    unsigned int below = levelSize[l-1];
+    levelSize[l] = (below + 1) / 2;
+    levels[l] = new mpz_t[levelSize[l]];
+    for (unsigned int i = 0; i < levelSize[l]; i++) {
+      mpz_init_set (levels[l][i], levels[l-1][2*i]);
+      if (2*i + 1 < below)
+	mpz_mul (levels[l][i], levels[l][i], levels[l-1][2*i+1]);
+    }
+  }
+
+  // Arbre des restes : chaque produit (hors niveau 0) est remplacé par
+  // P modulo ce produit, une fois le reste de son parent connu
+  mpz_tdiv_r (levels[nLevels-1][0], P, levels[nLevels-1][0]);
+  for (unsigned int l = nLevels - 1; l > 1; l--)
+    for (unsigned int i = 0; i < levelSize[l-1]; i++)
+      mpz_tdiv_r (levels[l-1][i], levels[l][i/2], levels[l-1][i]);
+
+  // Pgcd puis retrait des puissances : g = pgcd (x_i, z_i) est le
+  // produit des premiers de P divisant x_i, que l'on retire du cofacteur
+  // c tant qu'ils le divisent encore
+  mpz_t c, g;
+  mpz_init (c);
+  mpz_init (g);
+  for (unsigned int i = 0; i < count; i++) {
+    mpz_srcptr x = levels[0][i];
+
+    if (nLevels == 1)
+      mpz_tdiv_r (g, P, x);
+    else
+      mpz_tdiv_r (g, levels[1][i/2], x);
+    mpz_gcd (g, g, x);
+    mpz_set (c, x);
+    while (mpz_cmp_ui (g, 1) != 0) {
+      mpz_divexact (c, c, g);
+      mpz_gcd (g, g, c);
+    }
+    mpz_divexact (s[i], x, c);
+    mpz_mul_2exp (s[i], s[i], twos[i]);
+  }
+  mpz_shred (c);
+  mpz_shred (g);
+
+  for (unsigned int l = 0; l < nLevels; l++) {
+    for (unsigned int i = 0; i < levelSize[l]; i++)
+      mpz_shred (levels[l][i]);
+    delete[] levels[l];
+  }
+  delete[] levels;
+  delete[] levelSize;
+  delete[] twos;
+  if (t == &local)
+    clearTree (&local);
+}
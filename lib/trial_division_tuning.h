@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright © 2000-2018 ANSSI. All Rights Reserved.
+#ifndef TRIAL_DIVISION_TUNING_H
+#define TRIAL_DIVISION_TUNING_H
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Réglage de la division par les petits premiers (isPrime_TrialDivision)
+//
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+/* Une entrée {k, b, m} de la table indique que, pour des entiers de
+   longueur supérieure ou égale à k bits, on divise par les b premiers
+   nombres premiers impairs avec la méthode m. Ce choix minimise le coût
+   moyen par candidat impair de la division suivie d'un test de
+   Miller-Rabin sur les survivants.
+   Table générée par "test_prime_perfs 128 <répétitions> 0" ; elle peut
+   être régénérée sur la machine cible. */
+
+typedef struct {
+  size_t nbits;
+  unsigned int nPrimes;
+  trial_division_t method;
+} trialDivisionTuning;
+
+static const unsigned int trial_division_table_len = 8;
+
+static const trialDivisionTuning trial_division_table[trial_division_table_len] = {
+{0, 256, TRIAL_DIVISION_MOD_1},
+{384, 1024, TRIAL_DIVISION_MOD_1},
+{640, 1024, TRIAL_DIVISION_MOD_1},
+{896, 4096, TRIAL_DIVISION_MOD_1},
+{1280, 12250, TRIAL_DIVISION_MOD_1},
+{1792, 12250, TRIAL_DIVISION_MOD_1},
+{2560, 22999, TRIAL_DIVISION_MOD_1},
+{3584, 82024, TRIAL_DIVISION_MOD_1}};
+
+#endif
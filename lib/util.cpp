@@ -90,6 +90,18 @@ void mpz_shred (mpz_t n) {
 }
 
 
+void mpz_wipe (mpz_t n) {
+  int i;
+
+  volatile mp_limb_t* tab = n[0]._mp_d;
+
+  for(i=0; i<n[0]._mp_alloc; i++)
+    tab[i]=0;
+
+  n[0]._mp_size = 0;
+}
+
+
 void shred (char* buf, size_t len) {
   volatile char* s = buf;
   for (size_t i=0; i < len; i++) s[i]='\xff';  